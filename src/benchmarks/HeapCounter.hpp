@@ -0,0 +1,88 @@
+#ifndef HOST_HEAP_COUNTER
+#define HOST_HEAP_COUNTER
+
+// Counts every heap allocation made by the process (malloc, realloc, calloc and
+// operator new, which glibc's libstdc++ routes to malloc).
+// The allocator functions are interposed by defining them in the executable and
+// forwarding to glibc's internal entry points. Include from a single translation unit.
+
+#include <stddef.h>
+#include <malloc.h>
+
+extern "C" {
+  void * __libc_malloc(size_t size);
+  void * __libc_calloc(size_t count, size_t size);
+  void * __libc_realloc(void * ptr, size_t size);
+  void __libc_free(void * ptr);
+}
+
+struct HeapStats {
+  size_t allocations; // number of malloc/calloc calls and growing reallocs
+  size_t frees;
+  size_t allocated_bytes; // total bytes requested
+  size_t current_bytes;   // bytes currently in use (usable size)
+  size_t peak_bytes;      // high watermark of current_bytes
+  size_t current_blocks;  // number of blocks currently in use
+};
+
+static HeapStats heap_stats = {0, 0, 0, 0, 0, 0};
+
+inline void heap_stats_reset() {
+  size_t current = heap_stats.current_bytes;
+  heap_stats.allocations = 0;
+  heap_stats.frees = 0;
+  heap_stats.allocated_bytes = 0;
+  heap_stats.peak_bytes = current;
+}
+
+inline void heap_stats_on_alloc(void * ptr, size_t requested) {
+  if (!ptr)
+    return;
+  heap_stats.allocations++;
+  heap_stats.allocated_bytes += requested;
+  heap_stats.current_bytes += malloc_usable_size(ptr);
+  heap_stats.current_blocks++;
+  if (heap_stats.current_bytes > heap_stats.peak_bytes)
+    heap_stats.peak_bytes = heap_stats.current_bytes;
+}
+
+inline void heap_stats_on_free(void * ptr) {
+  if (!ptr)
+    return;
+  heap_stats.frees++;
+  heap_stats.current_bytes -= malloc_usable_size(ptr);
+  heap_stats.current_blocks--;
+}
+
+extern "C" void * malloc(size_t size) {
+  void * ptr = __libc_malloc(size);
+  heap_stats_on_alloc(ptr, size);
+  return ptr;
+}
+
+extern "C" void * calloc(size_t count, size_t size) {
+  void * ptr = __libc_calloc(count, size);
+  heap_stats_on_alloc(ptr, count * size);
+  return ptr;
+}
+
+extern "C" void * realloc(void * ptr, size_t size) {
+  if (ptr == NULL)
+    return malloc(size);
+  size_t old_size = malloc_usable_size(ptr);
+  void * new_ptr = __libc_realloc(ptr, size);
+  if (new_ptr) {
+    heap_stats.current_bytes -= old_size;
+    heap_stats.current_blocks--;
+    heap_stats_on_alloc(new_ptr, size);
+    heap_stats.frees++; // the previous block is released
+  }
+  return new_ptr;
+}
+
+extern "C" void free(void * ptr) {
+  heap_stats_on_free(ptr);
+  __libc_free(ptr);
+}
+
+#endif // HOST_HEAP_COUNTER
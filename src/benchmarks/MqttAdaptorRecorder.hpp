@@ -0,0 +1,177 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_ADAPTOR_RECORDER
+#define HA_MQTT_DISCOVERY_MQTT_ADAPTOR_RECORDER
+
+#include "HaMqttDiscovery/HaMqttDiscovery.hpp"
+#include "HaMqttDiscovery/MqttAdaptor.hpp"
+
+namespace HaMqttDiscovery {
+
+// A MqttAdaptor stand-in for host builds.
+// Every transaction is counted and the last published message is copied in
+// a fixed size buffer so that recording never allocates on the heap.
+// setDisconnectAfter() simulates a broker dropping the connection.
+class MqttAdaptorRecorder : public virtual MqttAdaptor {
+  public:
+    static const size_t MAX_RECORDED_TOPIC_SIZE = 128;
+    static const size_t MAX_RECORDED_PAYLOAD_SIZE = 4096;
+
+    MqttAdaptorRecorder() {
+      is_connected = true;
+      disconnect_countdown = 0;
+      stream_expected_size = 0;
+      stream_written_size = 0;
+      reset();
+    }
+    virtual ~MqttAdaptorRecorder() {}
+
+    void reset() {
+      publish_count = 0;
+      subscribe_count = 0;
+      unsubscribe_count = 0;
+      published_bytes = 0;
+      write_count = 0;
+      streaming = false;
+      last_topic[0] = '\0';
+      last_payload_size = 0;
+      last_retained = false;
+    }
+
+    void setConnected(bool value) {
+      is_connected = value;
+      disconnect_countdown = 0;
+    }
+
+    // The given number of publications succeed, then the connection drops during the next one.
+    void setDisconnectAfter(size_t publications) {
+      disconnect_countdown = publications + 1;
+    }
+
+    virtual bool connected() {
+      return is_connected;
+    }
+
+    virtual bool publish(const char* topic, const char* payload) {
+      return publish(topic, (const uint8_t*)payload, strlen(payload), false);
+    }
+
+    virtual bool publish(const char* topic, const char* payload, bool retained) {
+      return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+    }
+
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length) {
+      return publish(topic, payload, length, false);
+    }
+
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained) {
+      if (!is_connected) return false;
+      if (disconnect_countdown > 0 && --disconnect_countdown == 0) {
+        is_connected = false;
+        return false;
+      }
+
+      size_t topic_length = strlen(topic);
+      publish_count++;
+      published_bytes += topic_length + length;
+
+      record(topic, topic_length, payload, length);
+      last_retained = retained;
+      return true;
+    }
+
+    virtual bool beginPublish(const char* topic, size_t length, bool retained) {
+      if (!is_connected) return false;
+      if (streaming) return false;
+
+      size_t topic_length = strlen(topic);
+      record(topic, topic_length, NULL, 0);
+      last_retained = retained;
+      published_bytes += topic_length;
+      stream_expected_size = length;
+      streaming = true;
+      return true;
+    }
+
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+      if (!is_connected || !streaming) return 0;
+
+      write_count++;
+      published_bytes += size;
+      size_t copy_size = size;
+      if (last_payload_size + copy_size > MAX_RECORDED_PAYLOAD_SIZE)
+        copy_size = MAX_RECORDED_PAYLOAD_SIZE - last_payload_size;
+      memcpy(last_payload + last_payload_size, buffer, copy_size);
+      last_payload_size += copy_size;
+      stream_written_size += size;
+      return size;
+    }
+
+    virtual bool endPublish() {
+      if (!streaming) return false;
+      streaming = false;
+      bool complete = (stream_written_size == stream_expected_size);
+      stream_written_size = 0;
+      if (!is_connected || !complete) return false;
+      publish_count++;
+      return true;
+    }
+
+    virtual bool subscribe(const char* topic) {
+      if (!is_connected) return false;
+      subscribe_count++;
+      return true;
+    }
+
+    virtual bool unsubscribe(const char* topic) {
+      if (!is_connected) return false;
+      unsubscribe_count++;
+      return true;
+    }
+
+    size_t getPublishCount() const { return publish_count; }
+    size_t getSubscribeCount() const { return subscribe_count; }
+    size_t getUnsubscribeCount() const { return unsubscribe_count; }
+    size_t getPublishedBytes() const { return published_bytes; }
+    size_t getWriteCount() const { return write_count; }
+
+    const char * getLastTopic() const { return last_topic; }
+    const uint8_t * getLastPayload() const { return last_payload; }
+    size_t getLastPayloadSize() const { return last_payload_size; }
+    bool getLastRetained() const { return last_retained; }
+
+  private:
+    void record(const char* topic, size_t topic_length, const uint8_t* payload, size_t length) {
+      if (topic_length >= MAX_RECORDED_TOPIC_SIZE)
+        topic_length = MAX_RECORDED_TOPIC_SIZE - 1;
+      memcpy(last_topic, topic, topic_length);
+      last_topic[topic_length] = '\0';
+
+      if (payload == NULL)
+        length = 0;
+      if (length > MAX_RECORDED_PAYLOAD_SIZE)
+        length = MAX_RECORDED_PAYLOAD_SIZE;
+      if (length > 0)
+        memcpy(last_payload, payload, length);
+      last_payload_size = length;
+    }
+
+    bool is_connected;
+    size_t disconnect_countdown; // 0 to stay connected
+    size_t publish_count;
+    size_t subscribe_count;
+    size_t unsubscribe_count;
+    size_t published_bytes;
+    size_t write_count;
+
+    bool streaming;
+    size_t stream_expected_size;
+    size_t stream_written_size;
+
+    char last_topic[MAX_RECORDED_TOPIC_SIZE];
+    uint8_t last_payload[MAX_RECORDED_PAYLOAD_SIZE];
+    size_t last_payload_size;
+    bool last_retained;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_ADAPTOR_RECORDER
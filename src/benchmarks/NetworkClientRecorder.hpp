@@ -0,0 +1,128 @@
+#ifndef HA_MQTT_DISCOVERY_NETWORK_CLIENT_RECORDER
+#define HA_MQTT_DISCOVERY_NETWORK_CLIENT_RECORDER
+
+#include "HaMqttDiscovery/HaMqttDiscovery.hpp"
+#include <Client.h>
+
+namespace HaMqttDiscovery {
+
+// A network Client stand-in for host builds, written to by the PubSubClient shim and by
+// MqttAdaptorPubSubClient's batches. The writes are counted and the bytes are hashed.
+// The stream is split into MQTT packets with the decoding rules of the specification,
+// independently of MqttPacketBatch: a wrong remaining length makes the stream malformed.
+// Writes fail while setConnected(false), or while setWritable(false) with the connection up.
+class NetworkClientRecorder : public Client {
+  public:
+    NetworkClientRecorder() {
+      is_connected = true;
+      is_writable = true;
+      reset();
+    }
+    virtual ~NetworkClientRecorder() {}
+
+    void reset() {
+      write_count = 0;
+      failed_write_count = 0;
+      hash = FNV_OFFSET_BASIS;
+      packet_count = 0;
+      publish_count = 0;
+      malformed = false;
+      state = STATE_TYPE;
+      remaining_length = 0;
+      length_digits = 0;
+    }
+
+    void setConnected(bool value) {
+      is_connected = value;
+    }
+
+    void setWritable(bool value) {
+      is_writable = value;
+    }
+
+    virtual uint8_t connected() {
+      return is_connected ? 1 : 0;
+    }
+
+    virtual size_t write(const uint8_t * buffer, size_t size) {
+      if (!is_connected || !is_writable) {
+        failed_write_count++;
+        return 0;
+      }
+      write_count++;
+      hash = fnv1a(buffer, size, hash);
+      for(size_t i=0; i<size; i++)
+        decode(buffer[i]);
+      return size;
+    }
+
+    size_t getWriteCount() const { return write_count; }
+    size_t getFailedWriteCount() const { return failed_write_count; }
+    uint32_t getHash() const { return hash; }
+    size_t getPacketCount() const { return packet_count; }
+    size_t getPublishCount() const { return publish_count; }
+
+    // True if every packet has a valid fixed header and the stream ends on a packet boundary.
+    bool isWellFormed() const { return !malformed && state == STATE_TYPE; }
+
+  private:
+    enum DECODER_STATE {
+      STATE_TYPE,
+      STATE_LENGTH,
+      STATE_BODY,
+    };
+
+    void decode(uint8_t value) {
+      switch(state) {
+        case STATE_TYPE:
+          if ((value >> 4) == 3)
+            publish_count++;
+          else if (value >> 4 == 0 || value >> 4 == 15)
+            malformed = true; // reserved packet types
+          remaining_length = 0;
+          length_digits = 0;
+          state = STATE_LENGTH;
+          break;
+        case STATE_LENGTH:
+          remaining_length |= (size_t)(value & 0x7F) << (7 * length_digits);
+          length_digits++;
+          if ((value & 0x80) && length_digits == 4)
+            malformed = true; // at most 4 digits
+          if ((value & 0x80) == 0 || length_digits == 4)
+            endLength();
+          break;
+        case STATE_BODY:
+          if (--remaining_length == 0)
+            endPacket();
+          break;
+      };
+    }
+
+    void endLength() {
+      if (remaining_length == 0)
+        endPacket();
+      else
+        state = STATE_BODY;
+    }
+
+    void endPacket() {
+      packet_count++;
+      state = STATE_TYPE;
+    }
+
+    bool is_connected;
+    bool is_writable;
+    size_t write_count;
+    size_t failed_write_count;
+    uint32_t hash;
+    size_t packet_count;
+    size_t publish_count;
+    bool malformed;
+    DECODER_STATE state;
+    size_t remaining_length;
+    size_t length_digits;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_NETWORK_CLIENT_RECORDER
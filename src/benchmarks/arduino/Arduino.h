@@ -0,0 +1,375 @@
+#ifndef HOST_ARDUINO_SHIM
+#define HOST_ARDUINO_SHIM
+
+// Minimal Arduino API shim for compiling the HaMqttDiscovery library on a Linux host.
+// Only the subset used by the library and the benchmarks is implemented.
+// The String class mimics the ESP8266 core: small strings (up to 11 characters) are
+// stored inline and heap buffers are grown to the exact size required by each concat().
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte_near(addr) (*(const uint8_t *)(addr))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+#define strlen_P strlen
+#define strncmp_P strncmp
+#define memcpy_P memcpy
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// Added to the monotonic clock. Lets host scenarios fast forward time.
+inline unsigned long host_clock_offset_us = 0;
+
+inline unsigned long micros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)(ts.tv_sec * 1000000UL + ts.tv_nsec / 1000UL) + host_clock_offset_us;
+}
+
+inline unsigned long millis() {
+  return micros() / 1000UL;
+}
+
+inline void delay(unsigned long ms) {
+  usleep(ms * 1000UL);
+}
+
+inline void yield() {
+}
+
+// Buzzer stand-ins. Only the number of calls is recorded.
+inline size_t host_tone_count = 0;
+inline void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0) {
+  host_tone_count++;
+}
+inline void noTone(uint8_t pin) {
+}
+
+class String {
+  public:
+    String() {
+      init();
+    }
+
+    String(const char * cstr) {
+      init();
+      if (cstr)
+        copy(cstr, strlen(cstr));
+    }
+
+    String(const String & other) {
+      init();
+      copy(other.c_str(), other.length());
+    }
+
+    String(String && other) {
+      init();
+      move(other);
+    }
+
+    explicit String(char c) {
+      init();
+      copy(&c, 1);
+    }
+
+    explicit String(int value) { init(); fromFormat("%d", value); }
+    explicit String(unsigned int value) { init(); fromFormat("%u", value); }
+    explicit String(long value) { init(); fromFormat("%ld", value); }
+    explicit String(unsigned long value) { init(); fromFormat("%lu", value); }
+
+    ~String() {
+      if (!isSSO())
+        free(heap_buffer);
+    }
+
+    String & operator = (const String & rhs) {
+      if (this != &rhs)
+        copy(rhs.c_str(), rhs.length());
+      return *this;
+    }
+
+    String & operator = (String && rhs) {
+      if (this != &rhs)
+        move(rhs);
+      return *this;
+    }
+
+    String & operator = (const char * cstr) {
+      if (cstr)
+        copy(cstr, strlen(cstr));
+      else
+        clear();
+      return *this;
+    }
+
+    bool reserve(unsigned int size) {
+      if (capacity() >= size)
+        return true;
+      return changeBuffer(size);
+    }
+
+    unsigned int length() const {
+      return len;
+    }
+
+    bool isEmpty() const {
+      return len == 0;
+    }
+
+    void clear() {
+      setLen(0);
+    }
+
+    const char * c_str() const {
+      return isSSO() ? sso_buffer : heap_buffer;
+    }
+
+    bool concat(const String & str) { return concat(str.c_str(), str.length()); }
+    bool concat(const char * cstr) { return cstr ? concat(cstr, strlen(cstr)) : false; }
+    bool concat(char c) { return concat(&c, 1); }
+    bool concat(unsigned int num) {
+      char buf[11];
+      snprintf(buf, sizeof(buf), "%u", num);
+      return concat(buf);
+    }
+    bool concat(const char * cstr, unsigned int length) {
+      if (length == 0)
+        return true;
+      unsigned int new_len = len + length;
+      if (!reserve(new_len))
+        return false;
+      memmove(wbuffer() + len, cstr, length);
+      setLen(new_len);
+      return true;
+    }
+
+    String & operator += (const String & rhs) { concat(rhs); return *this; }
+    String & operator += (const char * cstr) { concat(cstr); return *this; }
+    String & operator += (char c) { concat(c); return *this; }
+    String & operator += (unsigned int num) { concat(num); return *this; }
+
+    bool equals(const char * cstr) const {
+      if (cstr == NULL)
+        return len == 0;
+      return strcmp(c_str(), cstr) == 0;
+    }
+    bool equals(const String & str) const {
+      return len == str.len && memcmp(c_str(), str.c_str(), len) == 0;
+    }
+
+    bool operator == (const String & rhs) const { return equals(rhs); }
+    bool operator == (const char * cstr) const { return equals(cstr); }
+    bool operator != (const String & rhs) const { return !equals(rhs); }
+    bool operator != (const char * cstr) const { return !equals(cstr); }
+
+    char operator [] (unsigned int index) const {
+      return (index < len ? c_str()[index] : '\0');
+    }
+
+    void remove(unsigned int index, unsigned int count) {
+      if (index >= len || count == 0)
+        return;
+      if (count > len - index)
+        count = len - index;
+      char * buffer = wbuffer();
+      memmove(buffer + index, buffer + index + count, len - index - count);
+      setLen(len - count);
+    }
+
+    void replace(const char * find, const char * replace_with) {
+      size_t find_len = strlen(find);
+      if (find_len == 0)
+        return;
+      String result;
+      const char * read = c_str();
+      const char * found = NULL;
+      while((found = strstr(read, find)) != NULL) {
+        result.concat(read, (unsigned int)(found - read));
+        result.concat(replace_with);
+        read = found + find_len;
+      }
+      result.concat(read);
+      *this = result;
+    }
+
+  private:
+    // Same layout budget as the ESP8266 core: 11 characters + null inline.
+    static const unsigned int SSO_CAPACITY = 11;
+
+    void init() {
+      heap_buffer = NULL;
+      heap_capacity = 0;
+      len = 0;
+      sso = true;
+      sso_buffer[0] = '\0';
+    }
+
+    bool isSSO() const { return sso; }
+    unsigned int capacity() const { return sso ? SSO_CAPACITY : heap_capacity; }
+    char * wbuffer() { return sso ? sso_buffer : heap_buffer; }
+
+    void setLen(unsigned int new_len) {
+      len = new_len;
+      wbuffer()[len] = '\0';
+    }
+
+    // Called by reserve() only when growing past the current capacity.
+    bool changeBuffer(unsigned int max_str_len) {
+      char * new_buffer = NULL;
+      if (sso) {
+        new_buffer = (char *)malloc(max_str_len + 1);
+        if (!new_buffer)
+          return false;
+        memcpy(new_buffer, sso_buffer, len + 1);
+      } else {
+        new_buffer = (char *)realloc(heap_buffer, max_str_len + 1);
+        if (!new_buffer)
+          return false;
+      }
+      heap_buffer = new_buffer;
+      heap_capacity = max_str_len;
+      sso = false;
+      return true;
+    }
+
+    void copy(const char * cstr, unsigned int length) {
+      if (!reserve(length)) {
+        clear();
+        return;
+      }
+      memmove(wbuffer(), cstr, length);
+      setLen(length);
+    }
+
+    void move(String & rhs) {
+      if (rhs.sso) {
+        copy(rhs.sso_buffer, rhs.len);
+      } else {
+        if (!sso)
+          free(heap_buffer);
+        heap_buffer = rhs.heap_buffer;
+        heap_capacity = rhs.heap_capacity;
+        len = rhs.len;
+        sso = false;
+        rhs.init();
+      }
+      rhs.clear();
+    }
+
+    void fromFormat(const char * format, ...);
+
+    char * heap_buffer;
+    unsigned int heap_capacity;
+    unsigned int len;
+    bool sso;
+    char sso_buffer[SSO_CAPACITY + 1];
+};
+
+inline void String::fromFormat(const char * format, ...) {
+  char tmp[32];
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(tmp, sizeof(tmp), format, args);
+  va_end(args);
+  if (written > 0)
+    copy(tmp, (unsigned int)written);
+}
+
+// Classic Arduino string concatenation helper: the left hand side is copied once
+// into a temporary and every following operator+ appends in place.
+class StringSumHelper : public String {
+  public:
+    StringSumHelper(const String & s) : String(s) {}
+    StringSumHelper(const char * p) : String(p) {}
+    StringSumHelper(char c) : String(c) {}
+    StringSumHelper(int value) : String(value) {}
+    StringSumHelper(unsigned int value) : String(value) {}
+    StringSumHelper(long value) : String(value) {}
+    StringSumHelper(unsigned long value) : String(value) {}
+};
+
+inline StringSumHelper & operator + (const StringSumHelper & lhs, const String & rhs) {
+  StringSumHelper & a = const_cast<StringSumHelper &>(lhs);
+  a.concat(rhs);
+  return a;
+}
+
+inline StringSumHelper & operator + (const StringSumHelper & lhs, const char * cstr) {
+  StringSumHelper & a = const_cast<StringSumHelper &>(lhs);
+  a.concat(cstr);
+  return a;
+}
+
+inline StringSumHelper & operator + (const StringSumHelper & lhs, char c) {
+  StringSumHelper & a = const_cast<StringSumHelper &>(lhs);
+  a.concat(c);
+  return a;
+}
+
+inline bool operator == (const char * cstr, const String & rhs) { return rhs.equals(cstr); }
+
+class HostSerial {
+  public:
+    HostSerial() {
+      output = stdout;
+    }
+
+    void begin(unsigned long) {}
+
+    // Set to NULL to discard all output (default for benchmarks).
+    void setOutput(FILE * f) {
+      output = f;
+    }
+
+    size_t write(const uint8_t * buffer, size_t size) {
+      if (output)
+        return fwrite(buffer, 1, size, output);
+      return size;
+    }
+
+    size_t print(const char * cstr) { return write((const uint8_t *)cstr, strlen(cstr)); }
+    size_t print(const String & s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(char c) { return write((const uint8_t *)&c, 1); }
+    size_t print(int value) { return printFormat("%d", value); }
+    size_t print(unsigned int value) { return printFormat("%u", value); }
+    size_t print(long value) { return printFormat("%ld", value); }
+    size_t print(unsigned long value) { return printFormat("%lu", value); }
+
+    size_t println() { return print('\n'); }
+    template<typename T>
+    size_t println(const T & value) {
+      size_t n = print(value);
+      return n + println();
+    }
+
+  private:
+    size_t printFormat(const char * format, ...) {
+      char tmp[32];
+      va_list args;
+      va_start(args, format);
+      int written = vsnprintf(tmp, sizeof(tmp), format, args);
+      va_end(args);
+      if (written <= 0)
+        return 0;
+      return write((const uint8_t *)tmp, (size_t)written);
+    }
+
+    FILE * output;
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_SHIM
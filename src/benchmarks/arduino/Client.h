@@ -0,0 +1,16 @@
+#ifndef HOST_ARDUINO_CLIENT_SHIM
+#define HOST_ARDUINO_CLIENT_SHIM
+
+// Minimal Arduino Client shim: the network interface written to by PubSubClient
+// and by MqttAdaptorPubSubClient's batches. Only the subset used by the library is declared.
+
+#include <Arduino.h>
+
+class Client {
+  public:
+    virtual ~Client() {}
+    virtual size_t write(const uint8_t * buffer, size_t size) = 0;
+    virtual uint8_t connected() = 0;
+};
+
+#endif // HOST_ARDUINO_CLIENT_SHIM
@@ -0,0 +1,122 @@
+#ifndef HOST_PUBSUBCLIENT_SHIM
+#define HOST_PUBSUBCLIENT_SHIM
+
+// Host stand-in for the PubSubClient library, limited to the API used by MqttAdaptorPubSubClient.
+// PUBLISH packets are serialized and written to the network client the way PubSubClient 2.8 does:
+// publish() builds the whole packet in its buffer and writes it once, beginPublish() writes the
+// fixed header and the topic, each write() goes straight to the network client.
+// The connection is the network client's, there is no CONNECT handshake.
+
+#include <Arduino.h>
+#include <Client.h>
+
+#define MQTT_MAX_PACKET_SIZE 256
+#define MQTT_MAX_HEADER_SIZE 5
+
+class PubSubClient {
+  public:
+    PubSubClient(Client & client) {
+      this->client = &client;
+      buffer = NULL;
+      buffer_size = 0;
+      setBufferSize(MQTT_MAX_PACKET_SIZE);
+    }
+    ~PubSubClient() {
+      free(buffer);
+    }
+  private:
+    // Disable copy ctor
+    PubSubClient(const PubSubClient & copy) {}
+  public:
+
+    bool setBufferSize(uint16_t size) {
+      if (size == 0)
+        return false;
+      uint8_t * resized = (uint8_t *)realloc(buffer, size);
+      if (resized == NULL)
+        return false;
+      buffer = resized;
+      buffer_size = size;
+      return true;
+    }
+    uint16_t getBufferSize() { return buffer_size; }
+
+    bool connected() {
+      return client->connected() != 0;
+    }
+
+    bool publish(const char * topic, const uint8_t * payload, unsigned int length, bool retained) {
+      size_t topic_length = strlen(topic);
+      if (!connected() || MQTT_MAX_HEADER_SIZE + 2 + topic_length + length > buffer_size)
+        return false;
+      size_t offset = MQTT_MAX_HEADER_SIZE;
+      offset = writeString(topic, topic_length, offset);
+      memcpy(buffer + offset, payload, length);
+      offset += length;
+      return writePacket(0x30 | (retained ? 0x01 : 0x00), offset - MQTT_MAX_HEADER_SIZE);
+    }
+
+    bool beginPublish(const char * topic, unsigned int length, bool retained) {
+      size_t topic_length = strlen(topic);
+      if (!connected() || MQTT_MAX_HEADER_SIZE + 2 + topic_length > buffer_size)
+        return false;
+      size_t offset = writeString(topic, topic_length, MQTT_MAX_HEADER_SIZE);
+      size_t header_size = buildHeader(0x30 | (retained ? 0x01 : 0x00), offset - MQTT_MAX_HEADER_SIZE + length);
+      size_t start = MQTT_MAX_HEADER_SIZE - header_size;
+      return client->write(buffer + start, offset - start) == offset - start;
+    }
+
+    size_t write(const uint8_t * data, size_t size) {
+      return client->write(data, size);
+    }
+
+    int endPublish() {
+      return 1;
+    }
+
+    bool subscribe(const char * topic) {
+      return connected();
+    }
+
+    bool unsubscribe(const char * topic) {
+      return connected();
+    }
+
+  private:
+    size_t writeString(const char * str, size_t length, size_t offset) {
+      buffer[offset++] = (uint8_t)(length >> 8);
+      buffer[offset++] = (uint8_t)(length & 0xFF);
+      memcpy(buffer + offset, str, length);
+      return offset + length;
+    }
+
+    // Writes the fixed header just before the variable header, returns its size.
+    size_t buildHeader(uint8_t type, size_t length) {
+      uint8_t digits[4];
+      size_t count = 0;
+      do {
+        uint8_t digit = length % 128;
+        length = length / 128;
+        if (length > 0)
+          digit |= 128;
+        digits[count++] = digit;
+      } while(length > 0 && count < sizeof(digits));
+      size_t start = MQTT_MAX_HEADER_SIZE - 1 - count;
+      buffer[start] = type;
+      memcpy(buffer + start + 1, digits, count);
+      return 1 + count;
+    }
+
+    bool writePacket(uint8_t type, size_t length) {
+      size_t header_size = buildHeader(type, length);
+      size_t start = MQTT_MAX_HEADER_SIZE - header_size;
+      size_t size = header_size + length;
+      return client->write(buffer + start, size) == size;
+    }
+
+    Client * client;
+    uint8_t * buffer;
+    uint16_t buffer_size;
+};
+
+#endif // HOST_PUBSUBCLIENT_SHIM
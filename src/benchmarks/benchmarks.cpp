@@ -0,0 +1,1282 @@
+// Host benchmarks for the HaMqttDiscovery library.
+// Build and run with `make run` from this directory.
+// The device built here mirrors the entities configured by setup_device() in doorbell.ino.
+
+#include <Arduino.h>
+#include <chrono>
+
+#include "HeapCounter.hpp"
+
+#include "HaMqttDiscovery/HaMqttDiscovery.hpp"
+#include "HaMqttDiscovery/HaMqttEntity.hpp"
+#include "HaMqttDiscovery/HaMqttDevice.hpp"
+#include "HaMqttDiscovery/HaMqttEntityTable.hpp"
+#include "HaMqttDiscovery/MqttCommandDispatcher.hpp"
+#include "HaMqttDiscovery/MqttPublishScheduler.hpp"
+#include "HaMqttDiscovery/MqttEventQueue.hpp"
+#include "HaMqttDiscovery/MqttAdaptorPubSubClient.hpp"
+#include "MqttAdaptorRecorder.hpp"
+#include "NetworkClientRecorder.hpp"
+#include "MelodyCatalog.hpp"
+#include "BinaryMelodyPlayer.hpp"
+#include "LatencyHistogram.hpp"
+#include "SpscRingBuffer.hpp"
+#include "DeadlineScheduler.hpp"
+#include "FastBootCache.hpp"
+#include "BrokerList.hpp"
+#include "LogBuffer.hpp"
+#include "DeviceDiagnostics.hpp"
+#include "rtttl_library.h"
+
+using namespace HaMqttDiscovery;
+
+HostSerial Serial;
+LogBuffer<16, 64> log_buffer;
+
+//************************************************************
+//   Benchmark device
+//************************************************************
+
+static constexpr size_t melodies_count = countMelodies(rtttl_library_names);
+typedef MelodyCatalog<melodies_count> DoorbellMelodyCatalog;
+static_assert(DoorbellMelodyCatalog::isValid(rtttl_library_names), "Each melody must be named and the catalog must be smaller than 64 KB.");
+static constexpr DoorbellMelodyCatalog::TABLE melodies_table PROGMEM = DoorbellMelodyCatalog::buildTable(rtttl_library_names);
+const DoorbellMelodyCatalog melody_catalog(rtttl_library_names, &melodies_table);
+
+static const String device_identifier = "doorbell-97BC";
+
+MqttAdaptorRecorder recorder;
+HaMqttDevice this_device;
+HaMqttEntity bell_sensor;
+HaMqttEntity melody_selector;
+HaMqttEntity test_button;
+HaMqttEntity identify;
+MqttCommandDispatcher command_dispatcher;
+
+static size_t handled_commands = 0;
+void on_command(HaMqttEntity & entity, const uint8_t * payload, size_t length) {
+  handled_commands++;
+}
+
+void serialize_melody_names(JsonWriter & writer) {
+  melody_catalog.serializeNames(writer);
+}
+
+void configure_device(HaMqttDevice & device) {
+  device.addIdentifier(device_identifier);
+  device.setName("Smart doorbell 97BC");
+  device.setManufacturer("end2endzone");
+  device.setModel("ESP8266");
+  device.setHardwareVersion("1.0");
+  device.setSoftwareVersion("2024-06-17, 12:00:00");
+  device.setMqttAdaptor(&recorder);
+}
+
+// Configures the entities like setup_device() in doorbell.ino did before HaMqttEntityTable.
+void configure_entities(HaMqttDevice & device, HaMqttEntity & bell_sensor, HaMqttEntity & melody_selector, HaMqttEntity & test_button, HaMqttEntity & identify) {
+  bell_sensor.setIntegrationType(HA_MQTT_BINARY_SENSOR);
+  bell_sensor.setName("Bell");
+  bell_sensor.setStateTopic(device_identifier + "/doorbell/state");
+  bell_sensor.addKeyValue("device_class","sound");
+  bell_sensor.setDevice(&device);
+  bell_sensor.setMqttAdaptor(&recorder);
+
+  melody_selector.setIntegrationType(HA_MQTT_SELECT);
+  melody_selector.setName("Melody");
+  melody_selector.setCommandTopic(device_identifier + "/melody/set");
+  melody_selector.setCommandHandler(on_command);
+  melody_selector.setStateTopic(device_identifier + "/melody/state");
+  melody_selector.addArraySerializer("options", serialize_melody_names);
+  melody_selector.setDevice(&device);
+  melody_selector.setMqttAdaptor(&recorder);
+
+  test_button.setIntegrationType(HA_MQTT_BUTTON);
+  test_button.setName("Test");
+  test_button.setCommandTopic(device_identifier + "/test/set");
+  test_button.setCommandHandler(on_command);
+  test_button.setStateTopic(  device_identifier + "/test/set");
+  test_button.setDevice(&device);
+  test_button.setMqttAdaptor(&recorder);
+
+  identify.setIntegrationType(HA_MQTT_SWITCH);
+  identify.setName("Identify");
+  identify.setCommandTopic(device_identifier + "/identify/set");
+  identify.setCommandHandler(on_command);
+  identify.setStateTopic(device_identifier + "/identify/state");
+  identify.addKeyValue("device_class","switch");
+  identify.setDevice(&device);
+  identify.setMqttAdaptor(&recorder);
+}
+
+void setup_device() {
+  configure_device(this_device);
+  configure_entities(this_device, bell_sensor, melody_selector, test_button, identify);
+  command_dispatcher.addEntities(this_device);
+}
+
+// The same entities, declared with HaMqttEntityTable
+static constexpr HA_MQTT_ENTITY_DEFINITION entity_definitions[] = {
+  {HA_MQTT_BINARY_SENSOR, "Bell",         "",               "/doorbell/state", HA_MQTT_KEY_VALUE("device_class","sound")},
+  {HA_MQTT_SELECT,        "Melody",       "/melody/set",    "/melody/state",   ""},
+  {HA_MQTT_BUTTON,        "Test",         "/test/set",      "/test/set",       ""},
+  {HA_MQTT_SWITCH,        "Identify",     "/identify/set",  "/identify/state", HA_MQTT_KEY_VALUE("device_class","switch")},
+};
+typedef HaMqttEntityTable<sizeof(entity_definitions)/sizeof(entity_definitions[0])> BenchmarkEntityTable;
+static_assert(BenchmarkEntityTable::isValid(entity_definitions), "Each entity must have a unique name.");
+static_assert(BenchmarkEntityTable::hasUniqueTopics(entity_definitions), "Two entities share the same topic.");
+static constexpr BenchmarkEntityTable::TABLE entities_table PROGMEM = BenchmarkEntityTable::buildTable(entity_definitions);
+const BenchmarkEntityTable entity_table(entity_definitions, &entities_table);
+
+// Duplicate topics are detected by the compiler
+static constexpr HA_MQTT_ENTITY_DEFINITION duplicate_definitions[] = {
+  {HA_MQTT_SENSOR, "Latency",  "",          "/latency/state", ""},
+  {HA_MQTT_SENSOR, "Duration", "",          "/latency/state", ""},
+};
+static_assert(!HaMqttEntityTable<2>::hasUniqueTopics(duplicate_definitions), "Duplicate state topics must be detected.");
+static constexpr HA_MQTT_ENTITY_DEFINITION duplicate_attributes_definitions[] = {
+  {HA_MQTT_SENSOR, "Latency",  "", "/latency/state", HA_MQTT_KEY_VALUE("json_attributes_topic","~/latency/attributes")},
+  {HA_MQTT_SWITCH, "Identify", "/latency/attributes", "/identify/state", ""},
+};
+static_assert(!HaMqttEntityTable<2>::hasUniqueTopics(duplicate_attributes_definitions), "Topics of key values must be detected.");
+
+// Topic resolution used by mqtt_subscription_callback() before MqttCommandDispatcher.
+// Kept as a baseline for the dispatcher benchmarks.
+HaMqttEntity * find_entity_by_command_topic(const char * topic) {
+  if (melody_selector.getCommandTopic() == topic)
+    return &melody_selector;
+  if (test_button.getCommandTopic() == topic)
+    return &test_button;
+  if (identify.getCommandTopic() == topic)
+    return &identify;
+  return NULL;
+}
+
+//************************************************************
+//   Benchmark runner
+//************************************************************
+
+static volatile size_t benchmark_sink = 0; // prevents the compiler from discarding results
+
+template<typename Function>
+void run_benchmark(const char * name, size_t iterations, Function func) {
+  // warm up
+  for(size_t i=0; i<iterations/10+1; i++)
+    func();
+
+  heap_stats_reset();
+  size_t heap_before = heap_stats.current_bytes;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(size_t i=0; i<iterations; i++)
+    func();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  double elapsed_ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  double ns_per_call = elapsed_ns / iterations;
+  double allocs_per_call = (double)heap_stats.allocations / iterations;
+  double bytes_per_call = (double)heap_stats.allocated_bytes / iterations;
+  size_t peak = heap_stats.peak_bytes - heap_before;
+
+  printf("%-52s %10.1f %10.2f %10.1f %10zu\n", name, ns_per_call, allocs_per_call, bytes_per_call, peak);
+}
+
+void print_header(const char * title) {
+  printf("\n%s\n", title);
+  printf("%-52s %10s %10s %10s %10s\n", "benchmark", "ns/call", "allocs", "bytes", "peak");
+}
+
+//************************************************************
+//   Benchmarks
+//************************************************************
+
+void benchmark_discovery() {
+  print_header("Discovery");
+
+  HaMqttEntity * entities[] = { &bell_sensor, &melody_selector, &test_button, &identify };
+  const char * names[] = {
+    "getDiscoveryPayload(binary_sensor)",
+    "getDiscoveryPayload(select)",
+    "getDiscoveryPayload(button)",
+    "getDiscoveryPayload(switch)",
+  };
+  for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++) {
+    HaMqttEntity * entity = entities[i];
+    run_benchmark(names[i], 20000, [entity]() {
+      String payload;
+      entity->getDiscoveryPayload(payload);
+      benchmark_sink += payload.length();
+    });
+  }
+
+  run_benchmark("getDiscoveryTopic(select)", 100000, []() {
+    String topic;
+    melody_selector.getDiscoveryTopic(topic);
+    benchmark_sink += topic.length();
+  });
+
+  run_benchmark("publishMqttDiscovery(all entities)", 5000, [&entities]() {
+    for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++)
+      benchmark_sink += entities[i]->publishMqttDiscovery();
+  });
+
+  run_benchmark("publishMqttDiscoveryIfChanged(all entities)", 100000, [&entities]() {
+    for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++)
+      benchmark_sink += entities[i]->publishMqttDiscoveryIfChanged();
+  });
+
+}
+
+void benchmark_discovery_size() {
+  printf("\nDiscovery payload size\n");
+  printf("%-52s %10s %10s %10s\n", "entity", "full", "compact", "saved");
+
+  HaMqttEntity * entities[] = { &bell_sensor, &melody_selector, &test_button, &identify };
+  size_t total_full = 0;
+  size_t total_compact = 0;
+  for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++) {
+    HaMqttEntity * entity = entities[i];
+
+    this_device.setCompactDiscovery(false);
+    size_t full = entity->getDiscoveryPayloadLength();
+    this_device.setCompactDiscovery(true);
+    size_t compact = entity->getDiscoveryPayloadLength();
+
+    printf("%-52s %10zu %10zu %9.1f%%\n", toString(entity->getIntegrationType()), full, compact, 100.0 * (full - compact) / full);
+    total_full += full;
+    total_compact += compact;
+  }
+  printf("%-52s %10zu %10zu %9.1f%%\n", "total", total_full, total_compact, 100.0 * (total_full - total_compact) / total_full);
+
+  run_benchmark("publishMqttDiscovery(all entities, compact)", 5000, [&entities]() {
+    for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++)
+      benchmark_sink += entities[i]->publishMqttDiscovery();
+  });
+
+  this_device.setCompactDiscovery(false);
+}
+
+void benchmark_state() {
+  print_header("State");
+
+  // States alternate between two values, identical values are not published again.
+  run_benchmark("setState+publishMqttState(binary_sensor)", 200000, []() {
+    bell_sensor.setState((benchmark_sink & 1) ? "ON" : "OFF");
+    benchmark_sink += bell_sensor.publishMqttState();
+  });
+
+  run_benchmark("setState+publishMqttState(select)", 200000, []() {
+    melody_selector.setState((benchmark_sink & 1) ? "Super Mario Bros. 3 Level 1 (short)" : "Star Wars Imperial March");
+    benchmark_sink += melody_selector.publishMqttState();
+  });
+
+  run_benchmark("setState(same value)+publishMqttState", 1000000, []() {
+    identify.setState("OFF");
+    benchmark_sink += identify.publishMqttState();
+  });
+
+  static MqttState state;
+  static const uint8_t binary_value[] = {0x01, 0x02, 0x03, 0x04};
+  run_benchmark("MqttState::set(binary, 4 bytes)", 1000000, []() {
+    state.set(binary_value, sizeof(binary_value));
+    benchmark_sink += state.getSize();
+  });
+
+  static const String long_value(String("Super Mario Bros. 3 Level 1 (short)") + " / " + "Super Mario Bros. 3 Level 1 (short)");
+  run_benchmark("MqttState::set(string, 73 bytes, heap)", 1000000, []() {
+    state.set(long_value);
+    benchmark_sink += state.getSize();
+  });
+
+  run_benchmark("MqttState move", 1000000, []() {
+    MqttState moved(std::move(state));
+    state = std::move(moved);
+    benchmark_sink += state.getSize();
+  });
+  printf("%-52s %10zu\n", "sizeof(MqttState)", sizeof(MqttState));
+
+  // Flip-flops that end on the published value are not published.
+  bell_sensor.setState("OFF");
+  bell_sensor.publishMqttState();
+  recorder.reset();
+  bell_sensor.setState("ON");
+  bell_sensor.setState("OFF");
+  bell_sensor.publishMqttState();
+  printf("%-52s %10zu\n", "publications after ON, OFF on a published OFF", recorder.getPublishCount());
+
+  run_benchmark("publishMqttState(not dirty)", 1000000, []() {
+    benchmark_sink += identify.publishMqttState();
+  });
+
+  run_benchmark("publishMqttDeviceStatus", 200000, []() {
+    benchmark_sink += this_device.publishMqttDeviceStatus(true);
+  });
+
+  // Idle loop(): no entity is dirty.
+  static HaMqttEntity * publishable_entities[] = {&bell_sensor, &melody_selector, &identify};
+  run_benchmark("find dirty entities, scan isDirty() (idle)", 10000000, []() {
+    for(size_t i=0; i<sizeof(publishable_entities)/sizeof(publishable_entities[0]); i++) {
+      if (publishable_entities[i]->getState().isDirty())
+        benchmark_sink++;
+    }
+  });
+
+  static uint32_t publishable_entities_mask = 0;
+  for(size_t i=0; i<sizeof(publishable_entities)/sizeof(publishable_entities[0]); i++)
+    publishable_entities_mask |= this_device.getEntityBit(publishable_entities[i]);
+  run_benchmark("find dirty entities, getDirtyEntities() (idle)", 10000000, []() {
+    if ((this_device.getDirtyEntities() & publishable_entities_mask) != 0)
+      benchmark_sink++;
+  });
+
+  bell_sensor.setState("ON");
+  printf("%-52s %10s\n", "dirty set follows setState()", (this_device.getDirtyEntities() == this_device.getEntityBit(&bell_sensor) ? "yes" : "NO"));
+  bell_sensor.publishMqttState();
+  printf("%-52s %10s\n", "dirty set cleared by publishMqttState()", (this_device.getDirtyEntities() == 0 ? "yes" : "NO"));
+}
+
+void benchmark_entities() {
+  print_header("Entities");
+
+  run_benchmark("getEntityIndexForIntegrationType(first)", 1000000, []() {
+    benchmark_sink += bell_sensor.getEntityIndexForIntegrationType();
+  });
+
+  run_benchmark("getEntityIndexForIntegrationType(last)", 1000000, []() {
+    benchmark_sink += identify.getEntityIndexForIntegrationType();
+  });
+}
+
+void benchmark_entity_table() {
+  print_header("Entity table");
+
+  run_benchmark("configure 4 entities with setters", 20000, []() {
+    HaMqttDevice device;
+    HaMqttEntity bell, melody, test, identify;
+    configure_device(device);
+    configure_entities(device, bell, melody, test, identify);
+    benchmark_sink += device.getEntities().size();
+  });
+
+  run_benchmark("HaMqttEntityTable::configure(4 entities)", 20000, []() {
+    HaMqttDevice device;
+    HaMqttEntity bell, melody, test, identify;
+    HaMqttEntity * table_entities[] = { &bell, &melody, &test, &identify };
+    configure_device(device);
+    entity_table.configure(device, table_entities);
+    benchmark_sink += device.getEntities().size();
+  });
+
+  // Both configurations must produce the same discovery payloads
+  HaMqttDevice device;
+  HaMqttEntity bell, melody, test, identify;
+  HaMqttEntity * table_entities[] = { &bell, &melody, &test, &identify };
+  configure_device(device);
+  bool configured = entity_table.configure(device, table_entities);
+  melody.addArraySerializer("options", serialize_melody_names);
+  bool rejected = !entity_table.configure(device, table_entities); // the device already has entities
+
+  HaMqttEntity * entities[] = { &bell_sensor, &melody_selector, &test_button, &identify };
+  bool identical = true;
+  for(size_t i=0; i<sizeof(entities)/sizeof(entities[0]); i++) {
+    String expected;
+    String payload;
+    entities[i]->getDiscoveryPayload(expected);
+    table_entities[i]->getDiscoveryPayload(payload);
+    if (payload != expected || table_entities[i]->getDiscoveryTopic() != entities[i]->getDiscoveryTopic())
+      identical = false;
+  }
+  printf("%-52s %10s\n", "configured from the table", (configured ? "yes" : "NO"));
+  printf("%-52s %10s\n", "second configuration rejected", (rejected ? "yes" : "NO"));
+  printf("%-52s %10s\n", "discovery topics and payloads unchanged", (identical ? "yes" : "NO"));
+}
+
+void benchmark_dispatch() {
+  print_header("Subscription dispatch");
+
+  const String melody_topic = melody_selector.getCommandTopic().c_str();
+  const String identify_topic = identify.getCommandTopic().c_str();
+  const String unknown_topic = device_identifier + "/unknown/set";
+
+  run_benchmark("string compare chain(melody)", 1000000, [&melody_topic]() {
+    benchmark_sink += (size_t)find_entity_by_command_topic(melody_topic.c_str());
+  });
+
+  run_benchmark("string compare chain(identify)", 1000000, [&identify_topic]() {
+    benchmark_sink += (size_t)find_entity_by_command_topic(identify_topic.c_str());
+  });
+
+  run_benchmark("string compare chain(unknown)", 1000000, [&unknown_topic]() {
+    benchmark_sink += (size_t)find_entity_by_command_topic(unknown_topic.c_str());
+  });
+
+  run_benchmark("MqttCommandDispatcher::findEntity(melody)", 1000000, [&melody_topic]() {
+    benchmark_sink += (size_t)command_dispatcher.findEntity(melody_topic.c_str());
+  });
+
+  run_benchmark("MqttCommandDispatcher::findEntity(identify)", 1000000, [&identify_topic]() {
+    benchmark_sink += (size_t)command_dispatcher.findEntity(identify_topic.c_str());
+  });
+
+  run_benchmark("MqttCommandDispatcher::findEntity(unknown)", 1000000, [&unknown_topic]() {
+    benchmark_sink += (size_t)command_dispatcher.findEntity(unknown_topic.c_str());
+  });
+
+  run_benchmark("MqttCommandDispatcher::dispatch(identify)", 1000000, [&identify_topic]() {
+    benchmark_sink += command_dispatcher.dispatch(identify_topic.c_str(), (const uint8_t*)"ON", 2);
+  });
+
+  // Scaling with the number of entities: resolve the last of 32 command topics
+  static const size_t MANY_ENTITIES_COUNT = 32;
+  static HaMqttEntity many_entities[MANY_ENTITIES_COUNT];
+  MqttCommandDispatcher many_dispatcher;
+  for(size_t i=0; i<MANY_ENTITIES_COUNT; i++) {
+    many_entities[i].setCommandTopic(device_identifier + "/input" + String(i) + "/set");
+    many_entities[i].setCommandHandler(on_command);
+    many_dispatcher.addEntity(&many_entities[i]);
+  }
+  const String last_topic = many_entities[MANY_ENTITIES_COUNT-1].getCommandTopic().c_str();
+
+  run_benchmark("string compare chain(32 entities, last)", 1000000, [&last_topic]() {
+    for(size_t i=0; i<MANY_ENTITIES_COUNT; i++) {
+      if (many_entities[i].getCommandTopic() == last_topic.c_str()) {
+        benchmark_sink += i;
+        break;
+      }
+    }
+  });
+
+  run_benchmark("MqttCommandDispatcher::findEntity(32 entities, last)", 1000000, [&many_dispatcher, &last_topic]() {
+    benchmark_sink += (size_t)many_dispatcher.findEntity(last_topic.c_str());
+  });
+}
+
+void benchmark_melodies() {
+  print_header("Melodies");
+
+  static const uint8_t selected_name[] = "Super Mario Bros. 3 Level 1 (short)";
+  run_benchmark("MelodyCatalog::find(payload)", 1000000, []() {
+    benchmark_sink += melody_catalog.find(selected_name, sizeof(selected_name) - 1);
+  });
+
+  run_benchmark("MelodyCatalog::getMelody(index)", 1000000, []() {
+    benchmark_sink += (size_t)melody_catalog.getMelody(benchmark_sink % melody_catalog.getCount());
+  });
+
+  run_benchmark("MelodyCatalog::getName(index, buffer)", 1000000, []() {
+    char name[64];
+    benchmark_sink += melody_catalog.getName(benchmark_sink % melody_catalog.getCount(), name, sizeof(name));
+  });
+
+  run_benchmark("MelodyCatalog::serializeNames()", 10000, []() {
+    JsonWriter writer;
+    writer.beginArray();
+    melody_catalog.serializeNames(writer);
+    writer.endArray();
+    benchmark_sink += writer.length();
+  });
+
+  // Every call to play() fast forwards the clock to the end of the current note.
+  size_t melody_index = melody_catalog.find("Super Mario Bros. 3 Level 1 (short)");
+  const uint8_t * melody = rtttl_library_data + pgm_read_word(&rtttl_library_offsets[melody_index]);
+  BinaryMelodyPlayer player;
+  run_benchmark("BinaryMelodyPlayer::play(whole melody)", 100000, [melody, &player]() {
+    player.begin(0, melody, RTTTL_LIBRARY_NOTE_BITS);
+    while(player.isPlaying()) {
+      player.play();
+      host_clock_offset_us += 10000000UL;
+    }
+  });
+
+  String name_string;
+  char name_buffer[64];
+  char short_buffer[8];
+  melody_catalog.getName(melody_index, name_string);
+  size_t name_length = melody_catalog.getName(melody_index, name_buffer, sizeof(name_buffer));
+  size_t short_length = melody_catalog.getName(melody_index, short_buffer, sizeof(short_buffer));
+  bool same_name = (name_length == name_string.length() && name_string == name_buffer &&
+    short_length == sizeof(short_buffer) - 1 && strncmp(short_buffer, name_buffer, short_length) == 0 && short_buffer[short_length] == '\0');
+
+  printf("%-52s %10zu\n", "melodies in library", melody_catalog.getCount());
+  printf("%-52s %10s\n", "name copied to a buffer, truncated to fit", (same_name ? "yes" : "NO"));
+  printf("%-52s %10u\n", "notes in melody (Super Mario Bros. 3 Level 1)", (unsigned)pgm_read_word(melody + 2));
+  printf("%-52s %10zu\n", "library size in bytes (names, table, notes)", sizeof(rtttl_library_names) + sizeof(melodies_table) + sizeof(rtttl_library_offsets) + sizeof(rtttl_library_data));
+}
+
+void benchmark_latency() {
+  print_header("Latency histogram");
+
+  static LatencyHistogram histogram;
+  run_benchmark("LatencyHistogram::record()", 1000000, []() {
+    histogram.record((uint32_t)(benchmark_sink++ * 2654435761UL) >> 12);
+  });
+
+  run_benchmark("LatencyHistogram::getPercentile(95)", 1000000, []() {
+    benchmark_sink += histogram.getPercentile(95);
+  });
+
+  printf("%-52s %10zu\n", "histogram size in bytes", sizeof(LatencyHistogram));
+}
+
+void benchmark_edges() {
+  print_header("Doorbell edge queue");
+
+  struct PIN_EDGE {
+    uint32_t time;
+    bool pressed;
+  };
+  static SpscRingBuffer<PIN_EDGE, 16> edges;
+  run_benchmark("SpscRingBuffer::push() + pop()", 1000000, []() {
+    PIN_EDGE edge = {(uint32_t)benchmark_sink, true};
+    edges.push(edge);
+    edges.pop(edge);
+    benchmark_sink += edge.time + 1;
+  });
+
+  // A stalled loop() must not lose the edges pushed by the interrupt until the queue is full.
+  size_t pushed = 0;
+  while(edges.push(PIN_EDGE{(uint32_t)pushed, (pushed % 2) == 0}))
+    pushed++;
+  size_t popped = 0;
+  PIN_EDGE edge;
+  bool ordered = true;
+  while(edges.pop(edge))
+    ordered = ordered && (edge.time == popped++);
+  printf("%-52s %10zu\n", "edges kept while loop() is stalled", popped);
+  printf("%-52s %10s\n", "edges popped in order", (ordered && popped == pushed ? "yes" : "NO"));
+}
+
+typedef DeadlineScheduler<8> BenchmarkTimers;
+static BenchmarkTimers deadline_timers;
+static String deadline_fired; // names of the fired timers, in order
+static BenchmarkTimers::TimerId deadline_periodic;
+void on_deadline_a() { deadline_fired += 'A'; }
+void on_deadline_b() { deadline_fired += 'B'; }
+void on_deadline_c() { deadline_fired += 'C'; }
+void on_deadline_periodic() {
+  deadline_fired += 'P';
+  deadline_timers.start(deadline_periodic, 0, 0); // expired again, must wait for the next update()
+}
+
+void benchmark_deadlines() {
+  print_header("Deadline scheduler");
+
+  // The device's 8 timeouts, all armed: the cost of a loop() where nothing expires
+  static BenchmarkTimers timers;
+  for(size_t i=0; i<8; i++)
+    timers.start(timers.add(NULL), 0, 1000 + (uint32_t)i * 100);
+  run_benchmark("DeadlineScheduler::update(idle, 8 timers)", 10000000, []() {
+    benchmark_sink += timers.update(500);
+  });
+  run_benchmark("DeadlineScheduler::start() + update()", 1000000, []() {
+    uint32_t now = (uint32_t)benchmark_sink;
+    timers.start((BenchmarkTimers::TimerId)(now % 8), now, 1);
+    benchmark_sink += timers.update(now + 1) + 1;
+  });
+
+  // Timers fire in deadline order, across the millis() overflow
+  BenchmarkTimers::TimerId a = deadline_timers.add(on_deadline_a);
+  BenchmarkTimers::TimerId b = deadline_timers.add(on_deadline_b);
+  BenchmarkTimers::TimerId c = deadline_timers.add(on_deadline_c);
+  deadline_periodic = deadline_timers.add(on_deadline_periodic);
+  uint32_t now = 0xFFFFFF00;
+  deadline_timers.start(a, now, 300);
+  deadline_timers.start(b, now, 100);
+  deadline_timers.start(c, now, 200);
+  bool next_ok = (deadline_timers.getTimeUntilNext(now) == 100);
+  deadline_timers.start(b, now, 400); // pushed back
+  deadline_timers.stop(c);
+  next_ok = next_ok && (deadline_timers.getTimeUntilNext(now) == 300) && !deadline_timers.isPending(c);
+  deadline_timers.update(now + 299);
+  deadline_timers.update(now + 400);
+  next_ok = next_ok && (deadline_timers.getTimeUntilNext(now + 400) == BenchmarkTimers::NO_DEADLINE);
+  printf("%-52s %10s\n", "timers fire in deadline order across overflow", (deadline_fired == "AB" ? "yes" : "NO"));
+  printf("%-52s %10s\n", "time until next deadline", (next_ok ? "yes" : "NO"));
+
+  // A callback which restarts its own timer does not loop forever
+  deadline_fired = "";
+  deadline_timers.start(deadline_periodic, 0, 0);
+  deadline_timers.update(0);
+  deadline_timers.update(0);
+  printf("%-52s %10s\n", "restarted timer fires once per update()", (deadline_fired == "PP" ? "yes" : "NO"));
+  deadline_timers.stop(deadline_periodic);
+}
+
+void benchmark_fast_boot() {
+  print_header("Fast boot cache");
+
+  uint32_t config_hash = FastBootCache::hashConfig("broker.local", FastBootCache::hashConfig("my-ssid"));
+  static FastBootCache cache;
+  FAST_BOOT_DATA & data = cache.getData();
+  const uint8_t bssid[6] = {0x60, 0x01, 0x94, 0x12, 0x34, 0x56};
+  memcpy(data.bssid, bssid, sizeof(bssid));
+  data.channel = 6;
+  data.local_ip = 0x2A01A8C0; // 192.168.1.42
+  data.gateway = 0x0101A8C0;
+  data.subnet = 0x00FFFFFF;
+  data.dns = 0x0101A8C0;
+  data.broker_ip = 0x0A01A8C0;
+  cache.seal(config_hash);
+
+  static uint32_t benchmark_config_hash = config_hash;
+  run_benchmark("FastBootCache::isValid()", 100000, []() {
+    benchmark_sink += cache.isValid(benchmark_config_hash);
+  });
+
+  // The cache is copied as is to RTC memory and read back on the next boot
+  FastBootCache restored;
+  memcpy(&restored.getData(), &cache.getData(), sizeof(FAST_BOOT_DATA));
+  bool restored_ok = restored.isValid(config_hash) && restored == cache;
+
+  FastBootCache corrupted = restored;
+  corrupted.getData().local_ip ^= 0x100;
+  bool corruption_ok = !corrupted.isValid(config_hash);
+
+  // Another SSID or broker host invalidates the cache, so does a hash of concatenated strings
+  bool config_ok = !restored.isValid(FastBootCache::hashConfig("broker.local", FastBootCache::hashConfig("other-ssid"))) &&
+                   !restored.isValid(FastBootCache::hashConfig("roker.local", FastBootCache::hashConfig("my-ssidb")));
+
+  FastBootCache empty;
+  bool empty_ok = !empty.isValid(FastBootCache::hashConfig(""));
+
+  // The lease is reused a bounded number of times, counting the reuses does not change the parameters
+  FastBootCache reused = restored;
+  reused.getData().lease_reuses = 7;
+  reused.seal(config_hash);
+  bool reuse_ok = restored.canReuseLease(8) && reused.canReuseLease(8) && !reused.canReuseLease(7) &&
+                  reused.isValid(config_hash) && reused != restored && reused.hasSameParameters(restored) &&
+                  !corrupted.hasSameParameters(restored) && !empty.hasSameParameters(restored);
+
+  printf("%-52s %10zu\n", "cache size in bytes", sizeof(FAST_BOOT_DATA));
+  printf("%-52s %10s\n", "cache restored from RTC memory", (restored_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "corrupted cache rejected", (corruption_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "cache of another configuration rejected", (config_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "empty cache rejected", (empty_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "lease reuses bounded, parameters unchanged", (reuse_ok ? "yes" : "NO"));
+}
+
+void benchmark_brokers() {
+  print_header("Broker list");
+
+  static BrokerList<4> brokers;
+  brokers.add(BROKER_ENDPOINT{"mqtt.home.lan", 1883});
+  brokers.add(BROKER_ENDPOINT{"192.168.1.20", 1883});
+  brokers.setTtl(300000);
+  brokers.setResolveAfterFailures(2);
+  brokers.setFailoverAfterFailures(3);
+  brokers.setDecayPeriod(60000);
+
+  run_benchmark("BrokerList::select()", 1000000, []() {
+    benchmark_sink += brokers.select((uint32_t)benchmark_sink);
+  });
+
+  uint32_t now = 1000;
+  uint32_t literal = 0;
+  bool literal_ok = BrokerList<4>::parseIPv4("192.168.1.20", literal) && literal == 0x1401A8C0 &&
+                    brokers.getAddress(1) == literal && !brokers.needsResolve(1, now) &&
+                    !BrokerList<4>::parseIPv4("192.168.1", literal) && !BrokerList<4>::parseIPv4("192.168.1.256", literal) &&
+                    !BrokerList<4>::parseIPv4("10.0.0.1.lan", literal);
+
+  // The host is resolved once, then cached for the TTL
+  bool ttl_ok = (brokers.select(now) == 0) && brokers.needsResolve(0, now);
+  brokers.setResolved(0, 0x0A01A8C0, now);
+  ttl_ok = ttl_ok && !brokers.needsResolve(0, now + 299999) && brokers.needsResolve(0, now + 300000);
+
+  // A failed resolution keeps the previous address
+  brokers.setResolved(0, 0, now);
+  ttl_ok = ttl_ok && brokers.getAddress(0) == 0x0A01A8C0;
+  brokers.setResolved(0, 0x0A01A8C0, now);
+
+  // Repeated failures: resolve again after 2, fail over to the next broker after 3
+  brokers.onConnectFailed(now += 1000);
+  bool failover_ok = !brokers.needsResolve(0, now);
+  brokers.onConnectFailed(now += 2000);
+  failover_ok = failover_ok && brokers.needsResolve(0, now) && (brokers.select(now) == 0);
+  brokers.setResolved(0, 0x0B01A8C0, now);
+  brokers.onConnectFailed(now += 4000);
+  failover_ok = failover_ok && (brokers.select(now) == 1) && brokers.getStats().failovers >= 1;
+  brokers.onConnected(now);
+
+  // The preferred broker is tried again once its failures are forgotten
+  bool decay_ok = (brokers.select(now + 59999) == 1) && (brokers.select(now + 60000) == 0);
+
+  // All brokers failing: the one with the fewest recent failures
+  for(int i=0; i<3; i++) {
+    brokers.select(now);
+    brokers.onConnectFailed(now);
+  }
+  brokers.select(now);
+  for(int i=0; i<4; i++)
+    brokers.onConnectFailed(now);
+  bool all_failing_ok = (brokers.select(now) == 1);
+
+  printf("%-52s %10s\n", "IP addresses are never resolved", (literal_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "resolved address cached for the TTL", (ttl_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "failover after repeated failures", (failover_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "preferred broker tried again after the decay", (decay_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "healthiest broker when all are failing", (all_failing_ok ? "yes" : "NO"));
+}
+
+void benchmark_log_buffer() {
+  print_header("Log buffer");
+
+  typedef LogBuffer<16, 64> Log;
+  static const char topic[] = "doorbell-97BC/melody/set";
+  static const char payload[] = "Super Mario Bros.";
+  static const unsigned int length = sizeof(payload) - 1;
+  char line[80];
+
+  // The message of mqtt_subscription_callback(), before and after LogBuffer
+  run_benchmark("String concatenation", 1000000, [&]() {
+    String msg = String("MQTT notify: ") + String(length) + " bytes. topic=" + topic + " payload=" + payload;
+    benchmark_sink += msg.length();
+  });
+  run_benchmark("LOG_INFO() + pop()", 1000000, [&]() {
+    LOG_INFO("MQTT notify: %u bytes. topic=%t payload=%t", length, log_text(topic), log_text(payload, length));
+    log_buffer.pop();
+  });
+  LOG_INFO("MQTT notify: %u bytes. topic=%t payload=%t", length, log_text(topic), log_text(payload, length));
+  run_benchmark("LogBuffer::format() (drain)", 1000000, [&]() {
+    benchmark_sink += Log::format(*log_buffer.peek(), line, sizeof(line));
+  });
+  log_buffer.pop();
+
+  log_buffer.add(LOG_LEVEL_INFO, 0, "MQTT notify: %u bytes. topic=%t payload=%t", length, log_text(topic), log_text(payload, length));
+  Log::format(*log_buffer.peek(), line, sizeof(line));
+  log_buffer.pop();
+  bool text_ok = strcmp(line, "MQTT notify: 17 bytes. topic=doorbell-97BC/melody/set payload=Super Mario Bros.") == 0;
+
+  log_buffer.add(LOG_LEVEL_ERROR, 1234, "%d %x %c", -42, 0xBEEFu, 'z');
+  const Log::RECORD * record = log_buffer.peek();
+  Log::format(*record, line, sizeof(line));
+  bool format_ok = record->time == 1234 && record->level == LOG_LEVEL_ERROR && strcmp(line, "-42 beef z") == 0;
+  log_buffer.pop();
+  log_buffer.add(LOG_LEVEL_ERROR, 1234, "%a %s %u%% %u", (uint32_t)0x1401A8C0, __FUNCTION__, 7u);
+  Log::format(*log_buffer.peek(), line, sizeof(line));
+  format_ok = format_ok && strcmp(line, "192.168.1.20 benchmark_log_buffer 7% ?") == 0;
+  log_buffer.pop();
+
+  // Copied text is truncated to the record, the message to the line
+  static char long_text[200];
+  memset(long_text, 'x', sizeof(long_text) - 1);
+  log_buffer.add(LOG_LEVEL_INFO, 0, "%t|%t|%u", log_text(long_text), log_text("lost"), 5u);
+  size_t line_length = Log::format(*log_buffer.peek(), line, sizeof(line));
+  bool truncate_ok = line_length == 63 + 3 && strcmp(line + 63, "||5") == 0;
+  line_length = Log::format(*log_buffer.peek(), line, 10);
+  truncate_ok = truncate_ok && line_length == 9 && strlen(line) == 9;
+  log_buffer.pop();
+
+  // Disabled levels evaluate nothing
+  int evaluated = 0;
+  LOG_DEBUG("evaluated %d", ++evaluated);
+  bool compiled_out_ok = (evaluated == 0 && log_buffer.isEmpty());
+
+  // A full buffer drops the new records
+  for(int i=0; i<20; i++)
+    LOG_WARNING("record %d", i);
+  uint32_t dropped = log_buffer.takeDropped();
+  Log::format(*log_buffer.peek(), line, sizeof(line));
+  bool full_ok = dropped == 5 && log_buffer.getCount() == 15 && strcmp(line, "record 0") == 0 && log_buffer.takeDropped() == 0;
+  while(!log_buffer.isEmpty())
+    log_buffer.pop();
+
+  heap_stats_reset();
+  for(int i=0; i<1000; i++) {
+    LOG_INFO("MQTT notify: %u bytes. topic=%t payload=%t", length, log_text(topic), log_text(payload, length));
+    Log::format(*log_buffer.peek(), line, sizeof(line));
+    log_buffer.pop();
+  }
+  bool no_heap_ok = (heap_stats.allocations == 0);
+
+  printf("%-52s %10zu\n", "bytes per record", sizeof(Log::RECORD));
+  printf("%-52s %10s\n", "copied text formatted", (text_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "conversions formatted", (format_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "text and line truncated", (truncate_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "disabled level compiled out", (compiled_out_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "full buffer drops and counts new records", (full_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "no heap allocation to log and drain", (no_heap_ok ? "yes" : "NO"));
+}
+
+void benchmark_scheduler() {
+  print_header("Publish scheduler");
+
+  static MqttPublishScheduler scheduler;
+  scheduler.setRate(100, 2);
+  run_benchmark("MqttPublishScheduler::process(idle)", 10000000, []() {
+    benchmark_sink += scheduler.process((uint32_t)benchmark_sink);
+  });
+
+  // A reconnect: discovery and states of all entities are pending when the bell rings.
+  HaMqttEntity * all_entities[] = {&bell_sensor, &melody_selector, &test_button, &identify};
+  for(size_t i=0; i<sizeof(all_entities)/sizeof(all_entities[0]); i++) {
+    all_entities[i]->invalidateDiscoveryCache();
+    scheduler.scheduleDiscovery(all_entities[i]);
+  }
+  for(size_t i=0; i<sizeof(all_entities)/sizeof(all_entities[0]); i++) {
+    all_entities[i]->getState().setDirty();
+    scheduler.scheduleState(all_entities[i]);
+  }
+  scheduler.scheduleState(&bell_sensor, MqttPublishScheduler::PRIORITY_URGENT);
+  size_t pending = scheduler.getPendingCount();
+
+  // Simulate a 1 ms loop() and measure how long process() blocks it.
+  recorder.reset();
+  String first_topic;
+  uint32_t now = 0;
+  unsigned long longest_process_us = 0;
+  while(!scheduler.isEmpty()) {
+    unsigned long start = micros();
+    scheduler.process(now);
+    unsigned long elapsed = micros() - start;
+    if (elapsed > longest_process_us)
+      longest_process_us = elapsed;
+    if (first_topic.isEmpty() && recorder.getPublishCount() > 0)
+      first_topic = recorder.getLastTopic();
+    now++;
+  }
+
+  printf("%-52s %10zu\n", "publications scheduled by a reconnect", pending);
+  printf("%-52s %10zu\n", "publications sent", recorder.getPublishCount());
+  printf("%-52s %10s\n", "bell state published first", (bell_sensor.getStateTopic() == first_topic ? "yes" : "NO"));
+  printf("%-52s %10u\n", "simulated time to drain the queue in ms", now);
+  printf("%-52s %10lu\n", "longest process() call in us", longest_process_us);
+}
+
+// The MQTT traffic of the real MqttAdaptorPubSubClient, through the PubSubClient shim.
+NetworkClientRecorder network;
+PubSubClient pubsub_client(network);
+MqttAdaptorPubSubClient pubsub_adaptor(&pubsub_client);
+
+void set_mqtt_adaptor(MqttAdaptor * adaptor) {
+  this_device.setMqttAdaptor(adaptor);
+  bell_sensor.setMqttAdaptor(adaptor);
+  melody_selector.setMqttAdaptor(adaptor);
+  test_button.setMqttAdaptor(adaptor);
+  identify.setMqttAdaptor(adaptor);
+}
+
+// Returns true if encodePublishHeader() writes the expected bytes, from the MQTT 3.1.1 specification.
+bool check_publish_header(size_t topic_length, size_t payload_length, bool retained, const uint8_t * expected, size_t expected_size) {
+  uint8_t header[MqttPacketBatch::MAX_HEADER_SIZE];
+  size_t header_size = MqttPacketBatch::encodePublishHeader(header, topic_length, payload_length, retained);
+  return (header_size == expected_size && memcmp(header, expected, expected_size) == 0 &&
+    MqttPacketBatch::getPublishPacketSize(topic_length, payload_length) == header_size + topic_length + payload_length);
+}
+
+struct RECONNECT_RESULT {
+  size_t publications;
+  size_t network_writes;
+  uint32_t network_hash;
+  uint32_t duration; // simulated milliseconds
+  bool well_formed;
+};
+
+// Publishes what the connection steps of doorbell.ino publish: the device offline,
+// all discovery topics, all states and the device online.
+RECONNECT_RESULT simulate_reconnect(bool batching) {
+  MqttPublishScheduler scheduler;
+  scheduler.setRate(100, 2);
+  scheduler.setBatchAdaptor(batching ? &pubsub_adaptor : NULL, 8);
+
+  HaMqttEntity * all_entities[] = {&bell_sensor, &melody_selector, &test_button, &identify};
+  scheduler.scheduleDeviceStatus(&this_device, false, MqttPublishScheduler::PRIORITY_URGENT);
+  for(size_t i=0; i<sizeof(all_entities)/sizeof(all_entities[0]); i++)
+    scheduler.scheduleDiscovery(all_entities[i]);
+  for(size_t i=0; i<sizeof(all_entities)/sizeof(all_entities[0]); i++) {
+    all_entities[i]->getState().setDirty();
+    scheduler.scheduleState(all_entities[i]);
+  }
+  scheduler.scheduleDeviceStatus(&this_device, true, MqttPublishScheduler::PRIORITY_DISCOVERY + 1);
+
+  network.reset();
+  uint32_t now = 0;
+  while(!scheduler.isEmpty()) {
+    scheduler.process(now);
+    now++;
+  }
+  RECONNECT_RESULT result = {network.getPublishCount(), network.getWriteCount(), network.getHash(), now, network.isWellFormed()};
+  return result;
+}
+
+// Small publications, one larger than the batch, streamed ones and a publication
+// which does not fit in what is left of the batch.
+RECONNECT_RESULT publish_mixed_sizes(bool batching) {
+  static uint8_t payload[1500];
+  memset(payload, 'x', sizeof(payload));
+  network.reset();
+  if (batching)
+    pubsub_adaptor.beginBatch();
+  bool success = true;
+  success &= pubsub_adaptor.publish("doorbell/a", payload, 10, false);
+  success &= pubsub_adaptor.publish("doorbell/b", payload, 20, true);
+  success &= pubsub_adaptor.publish("doorbell/large", payload, 1500, false); // larger than the batch
+  success &= pubsub_adaptor.publish("doorbell/c", payload, 121, false);      // remaining length of 128
+  success &= pubsub_adaptor.beginPublish("doorbell/d", 30, false);
+  success &= (pubsub_adaptor.write(payload, 10) == 10);
+  success &= (pubsub_adaptor.write(payload, 20) == 20);
+  success &= pubsub_adaptor.endPublish();
+  success &= pubsub_adaptor.publish("doorbell/e", payload, 1000, false);     // does not fit after the others
+  success &= pubsub_adaptor.beginPublish("doorbell/f", 1400, true);          // streamed, larger than the batch
+  success &= (pubsub_adaptor.write(payload, 1400) == 1400);
+  success &= pubsub_adaptor.endPublish();
+  success &= pubsub_adaptor.publish("doorbell/g", payload, 5, false);
+  if (batching)
+    success &= pubsub_adaptor.flush();
+  RECONNECT_RESULT result = {network.getPublishCount(), network.getWriteCount(), network.getHash(), 0, network.isWellFormed() && success};
+  return result;
+}
+
+static size_t batch_successes = 0;
+static size_t batch_failures = 0;
+void on_batch_result(const MqttPublishScheduler::REQUEST & request, bool success) {
+  if (success)
+    batch_successes++;
+  else
+    batch_failures++;
+}
+
+void benchmark_batch() {
+  print_header("Batched publications");
+
+  // Remaining length boundaries, topic of 5 bytes
+  static const uint8_t header_127[] = {0x30, 0x7F, 0x00, 0x05};
+  static const uint8_t header_128[] = {0x30, 0x80, 0x01, 0x00, 0x05};
+  static const uint8_t header_16383[] = {0x31, 0xFF, 0x7F, 0x00, 0x05};
+  static const uint8_t header_16384[] = {0x31, 0x80, 0x80, 0x01, 0x00, 0x05};
+  printf("%-52s %10s\n", "publish header at remaining length 127", (check_publish_header(5, 120, false, header_127, sizeof(header_127)) ? "yes" : "NO"));
+  printf("%-52s %10s\n", "publish header at remaining length 128", (check_publish_header(5, 121, false, header_128, sizeof(header_128)) ? "yes" : "NO"));
+  printf("%-52s %10s\n", "publish header at remaining length 16383", (check_publish_header(5, 16376, true, header_16383, sizeof(header_16383)) ? "yes" : "NO"));
+  printf("%-52s %10s\n", "publish header at remaining length 16384", (check_publish_header(5, 16377, true, header_16384, sizeof(header_16384)) ? "yes" : "NO"));
+
+  pubsub_client.setBufferSize(4096);
+  pubsub_adaptor.setBatchCapacity(&network, 1460);
+  set_mqtt_adaptor(&pubsub_adaptor);
+  this_device.setCompactDiscovery(true);
+
+  run_benchmark("reconnect, one publication per write", 2000, []() {
+    benchmark_sink += simulate_reconnect(false).network_writes;
+  });
+  run_benchmark("reconnect, batched publications", 2000, []() {
+    benchmark_sink += simulate_reconnect(true).network_writes;
+  });
+
+  RECONNECT_RESULT unbatched = simulate_reconnect(false);
+  RECONNECT_RESULT batched = simulate_reconnect(true);
+
+  printf("%-52s %10zu\n", "publications per reconnect", unbatched.publications);
+  printf("%-52s %10zu\n", "network writes per reconnect, unbatched", unbatched.network_writes);
+  printf("%-52s %10zu\n", "network writes per reconnect, batched", batched.network_writes);
+  printf("%-52s %10u\n", "simulated reconnect duration in ms, unbatched", unbatched.duration);
+  printf("%-52s %10u\n", "simulated reconnect duration in ms, batched", batched.duration);
+  printf("%-52s %10s\n", "packets well formed", (unbatched.well_formed && batched.well_formed ? "yes" : "NO"));
+  printf("%-52s %10s\n", "same bytes sent to the network", (batched.network_hash == unbatched.network_hash && batched.publications == unbatched.publications ? "yes" : "NO"));
+
+  // Publications which do not fit in the batch are sent by the PubSubClient, in order
+  RECONNECT_RESULT mixed_unbatched = publish_mixed_sizes(false);
+  RECONNECT_RESULT mixed_batched = publish_mixed_sizes(true);
+  printf("%-52s %10zu\n", "network writes of mixed sizes, unbatched", mixed_unbatched.network_writes);
+  printf("%-52s %10zu\n", "network writes of mixed sizes, batched", mixed_batched.network_writes);
+  printf("%-52s %10s\n", "mixed sizes published and well formed", (mixed_unbatched.well_formed && mixed_batched.well_formed && mixed_batched.publications == 8 ? "yes" : "NO"));
+  printf("%-52s %10s\n", "mixed sizes, same bytes sent to the network", (mixed_batched.network_hash == mixed_unbatched.network_hash && mixed_batched.publications == mixed_unbatched.publications ? "yes" : "NO"));
+
+  // A batch which could not be written fails the flush(), the next batch starts clean
+  static const uint8_t payload[] = "ON";
+  network.reset();
+  pubsub_adaptor.beginBatch();
+  bool appended = pubsub_adaptor.publish("doorbell/a", payload, 2, false);
+  network.setConnected(false);
+  static uint8_t large[1500];
+  bool fallback_failed = !pubsub_adaptor.publish("doorbell/large", large, sizeof(large), false); // the pending batch is written first
+  network.setConnected(true);
+  bool failed_flush = !pubsub_adaptor.flush();
+  pubsub_adaptor.beginBatch();
+  pubsub_adaptor.publish("doorbell/b", payload, 2, false);
+  bool next_flush = pubsub_adaptor.flush();
+  printf("%-52s %10s\n", "failed batch write reported by flush()", (appended && fallback_failed && failed_flush ? "yes" : "NO"));
+  printf("%-52s %10s\n", "next batch flushed after a failure", (next_flush && network.getPublishCount() == 1 && network.isWellFormed() ? "yes" : "NO"));
+
+  // The scheduler reports the publications of a batch once it is written, and retries them if the write failed
+  MqttPublishScheduler batch_scheduler;
+  batch_scheduler.setRate(100, 1);
+  batch_scheduler.setBatchAdaptor(&pubsub_adaptor, 8);
+  batch_scheduler.setResultHandler(on_batch_result);
+  batch_successes = 0;
+  batch_failures = 0;
+  bell_sensor.getState().setDirty();
+  identify.getState().setDirty();
+  batch_scheduler.scheduleState(&bell_sensor);
+  batch_scheduler.scheduleState(&identify);
+  network.reset();
+  network.setWritable(false);
+  batch_scheduler.process(0);
+  bool batch_retried = (batch_failures == 2 && batch_successes == 0 && batch_scheduler.getPendingCount() == 2 &&
+                        bell_sensor.getState().isDirty() && identify.getState().isDirty());
+  network.setWritable(true);
+  batch_scheduler.process(100);
+  bool batch_reported = (batch_successes == 2 && batch_scheduler.isEmpty() && network.getPublishCount() == 2 &&
+                         network.getWriteCount() == 1 && !bell_sensor.getState().isDirty() && !identify.getState().isDirty());
+  printf("%-52s %10s\n", "failed batch reported and its states retried", (batch_retried ? "yes" : "NO"));
+  printf("%-52s %10s\n", "batched states reported once written", (batch_reported ? "yes" : "NO"));
+
+  this_device.setCompactDiscovery(false);
+  set_mqtt_adaptor(&recorder);
+  network.reset();
+}
+
+// A MqttEventStore in RAM, for host builds. setReadable(false) simulates a corrupted store.
+class MqttEventStoreMemory : public virtual MqttEventStore {
+  public:
+    MqttEventStoreMemory() { readable = true; }
+    virtual ~MqttEventStoreMemory() {}
+    void setReadable(bool value) { readable = value; }
+    virtual bool write(const MQTT_EVENT & event) { events.push_back(event); return true; }
+    virtual bool peek(MQTT_EVENT & event) {
+      if (events.empty() || !readable) return false;
+      event = events.front();
+      return true;
+    }
+    virtual bool pop() {
+      if (events.empty()) return false;
+      events.erase(events.begin());
+      return true;
+    }
+    virtual size_t getCount() { return events.size(); }
+    virtual void clear() { events.clear(); }
+  private:
+    std::vector<MQTT_EVENT> events;
+    bool readable;
+};
+
+// Publishes all events and appends the first character of each published payload to sequence.
+void drain_event_queue(MqttPublishScheduler & scheduler, MqttEventQueue & queue, uint32_t & now, String & sequence) {
+  for(size_t i=0; i<1000 && !queue.isEmpty() && recorder.connected(); i++) {
+    scheduler.scheduleEvents(&queue);
+    size_t published = recorder.getPublishCount();
+    scheduler.process(now);
+    if (recorder.getPublishCount() != published)
+      sequence += (char)recorder.getLastPayload()[1]; // 'N' for ON, 'F' for OFF
+    now += 10;
+  }
+  scheduler.clear();
+}
+
+void benchmark_event_queue() {
+  print_header("Event queue");
+
+  MqttEventQueue queue(8);
+  MqttPublishScheduler scheduler;
+  scheduler.setRate(100, 2);
+  HaMqttEntity * entity = &bell_sensor;
+
+  run_benchmark("push + publishNext(ON)", 1000000, [&queue, entity]() {
+    queue.push(entity, "ON", 0);
+    benchmark_sink += queue.publishNext(0);
+  });
+
+  // Rings while the connection drops: ON OFF are published, then the link drops
+  // during the next ring and 5 more rings happen before the reconnection.
+  queue.resetStats();
+  recorder.reset();
+  recorder.setConnected(true);
+  bell_sensor.setState("OFF"); // the current state, not published yet
+  bell_sensor.getState().setDirty();
+  uint32_t now = 0;
+  String sequence;
+  queue.push(entity, "ON", now);
+  queue.push(entity, "OFF", now);
+  drain_event_queue(scheduler, queue, now, sequence);
+
+  recorder.setDisconnectAfter(1);
+  queue.push(entity, "ON", now);
+  queue.push(entity, "OFF", now);
+  drain_event_queue(scheduler, queue, now, sequence); // publishes ON, the link drops on OFF
+  bool kept_after_drop = (!recorder.connected() && queue.getCount() == 1);
+  for(size_t i=0; i<5; i++) {
+    queue.push(entity, "ON", now);
+    queue.push(entity, "OFF", now);
+  }
+  // 11 events while the queue holds 8: the oldest 3 (OFF ON OFF) are dropped, the last 4 rings are replayed
+  recorder.setConnected(true);
+  drain_event_queue(scheduler, queue, now, sequence);
+  const MqttEventQueue::STATS & stats = queue.getStats();
+  bool replayed_in_order = (sequence == "NF" "N" "NFNFNFNF");
+  bool state_published = !bell_sensor.getState().isDirty();
+
+  printf("%-52s %10u\n", "events queued", stats.queued);
+  printf("%-52s %10u\n", "events published", stats.published);
+  printf("%-52s %10u\n", "events dropped (queue of 8)", stats.dropped);
+  printf("%-52s %10u\n", "failed publications", stats.failures);
+  printf("%-52s %10s\n", "event kept when the connection dropped", (kept_after_drop ? "yes" : "NO"));
+  printf("%-52s %10s\n", "events replayed in order", (replayed_in_order ? "yes" : "NO"));
+  printf("%-52s %10s\n", "state published by its last event", (state_published ? "yes" : "NO"));
+
+  // OVERFLOW_DROP_NEWEST keeps the oldest events
+  MqttEventQueue newest_queue(2, MqttEventQueue::OVERFLOW_DROP_NEWEST);
+  newest_queue.push(entity, "ON", 0);
+  newest_queue.push(entity, "OFF", 0);
+  bool rejected = !newest_queue.push(entity, "ON", 0);
+  MQTT_EVENT oldest;
+  bool drop_newest = (rejected && newest_queue.peek(oldest) && strcmp(oldest.value, "ON") == 0 && newest_queue.getStats().dropped == 1);
+  printf("%-52s %10s\n", "OVERFLOW_DROP_NEWEST rejects new events", (drop_newest ? "yes" : "NO"));
+
+  // Expired events are not published
+  MqttEventQueue aging_queue(4);
+  aging_queue.setMaxAge(1000);
+  aging_queue.push(entity, "ON", 0);
+  aging_queue.push(entity, "OFF", 1500);
+  recorder.reset();
+  aging_queue.publishNext(2000);
+  bool expired = (aging_queue.getStats().expired == 1 && recorder.getPublishCount() == 1 && aging_queue.isEmpty());
+  printf("%-52s %10s\n", "events older than the maximum age expire", (expired ? "yes" : "NO"));
+
+  // With a store, overflowing events are spilled and replayed first
+  MqttEventStoreMemory store;
+  MqttEventQueue spill_queue(2);
+  spill_queue.setStore(&store);
+  sequence = "";
+  for(size_t i=0; i<4; i++) {
+    spill_queue.push(entity, "ON", now);
+    spill_queue.push(entity, "OFF", now);
+  }
+  bool spilled = (store.getCount() == 6 && spill_queue.getStats().spilled == 6 && spill_queue.getStats().dropped == 0);
+  drain_event_queue(scheduler, spill_queue, now, sequence);
+  printf("%-52s %10s\n", "overflow spilled to the store and replayed in order", (spilled && sequence == "NFNFNFNF" ? "yes" : "NO"));
+
+  // An unreadable store is dropped, the events in RAM are still published
+  MqttEventStoreMemory unreadable_store;
+  MqttEventQueue unreadable_queue(2);
+  unreadable_queue.setStore(&unreadable_store);
+  for(size_t i=0; i<2; i++) {
+    unreadable_queue.push(entity, "ON", now);
+    unreadable_queue.push(entity, "OFF", now);
+  }
+  unreadable_store.setReadable(false);
+  recorder.reset();
+  bool read_failed = !unreadable_queue.publishNext(now);
+  bool store_dropped = (unreadable_store.getCount() == 0 && unreadable_queue.getCount() == 2 &&
+                        unreadable_queue.getStats().failures == 1 && unreadable_queue.getStats().dropped == 2);
+  bool ram_published = unreadable_queue.publishNext(now) && recorder.getPublishCount() == 1;
+  printf("%-52s %10s\n", "unreadable store reported and dropped", (read_failed && store_dropped && ram_published ? "yes" : "NO"));
+
+  recorder.reset();
+  recorder.setConnected(true);
+}
+
+void benchmark_config_arena() {
+  print_header("Configuration arena");
+
+  HaMqttEntity * entities[] = { &bell_sensor, &melody_selector, &test_button, &identify };
+  static const size_t entities_count = sizeof(entities)/sizeof(entities[0]);
+  String payloads_before[entities_count];
+  for(size_t i=0; i<entities_count; i++)
+    entities[i]->getDiscoveryPayload(payloads_before[i]);
+
+  // Packing moves every configuration string of the device to a single block
+  ConfigArena arena;
+  size_t blocks_before = heap_stats.current_blocks;
+  size_t bytes_before = heap_stats.current_bytes;
+  bool packed = packConfiguration(this_device, arena);
+  size_t blocks_after = heap_stats.current_blocks;
+  size_t bytes_after = heap_stats.current_bytes;
+
+  bool identical = true;
+  for(size_t i=0; i<entities_count; i++) {
+    String payload;
+    entities[i]->getDiscoveryPayload(payload);
+    if (payload != payloads_before[i])
+      identical = false;
+  }
+
+  run_benchmark("publishMqttDiscovery(all entities, packed)", 5000, [&entities]() {
+    for(size_t i=0; i<entities_count; i++)
+      benchmark_sink += entities[i]->publishMqttDiscovery();
+  });
+
+  run_benchmark("MqttCommandDispatcher::findEntity(identify, packed)", 1000000, []() {
+    benchmark_sink += (size_t)command_dispatcher.findEntity("doorbell-97BC/identify/set");
+  });
+
+  printf("%-52s %10zu\n", "arena size in bytes", arena.getCapacity());
+  printf("%-52s %10zu\n", "heap blocks released by packing", blocks_before - blocks_after);
+  printf("%-52s %10ld\n", "heap bytes released by packing", (long)bytes_before - (long)bytes_after);
+  printf("%-52s %10s\n", "configuration packed", (packed && arena.getUsed() == arena.getCapacity() ? "yes" : "NO"));
+  printf("%-52s %10s\n", "discovery payloads unchanged", (identical ? "yes" : "NO"));
+}
+
+void benchmark_diagnostics() {
+  print_header("Device diagnostics");
+
+  static DeviceDiagnostics diagnostics;
+  run_benchmark("DeviceDiagnostics::onLoop()", 10000000, []() {
+    diagnostics.onLoop();
+  });
+
+  // 500 loops in 5 seconds
+  static DeviceDiagnostics counters;
+  counters.sample(1000, 40000, 30000, 512);
+  for(int i=0; i<500; i++)
+    counters.onLoop();
+  const DEVICE_DIAGNOSTICS_SAMPLE & sample = counters.sample(6000, 30000, 12000, 1024);
+  bool loop_rate_ok = (sample.loop_rate == 100);
+  bool heap_ok = sample.free_heap == 30000 && sample.largest_free_block == 12000 && sample.heap_fragmentation == 60 &&
+                 sample.min_free_heap == 30000 && sample.mqtt_buffer_size == 1024 &&
+                 DeviceDiagnostics::computeFragmentation(0, 0) == 0 && DeviceDiagnostics::computeFragmentation(1000, 1000) == 0;
+
+  // A publication which fails twice then succeeds, and a successful one
+  counters.onPublishResult(false, 1);
+  counters.onPublishResult(false, 2);
+  counters.onPublishResult(true, 2);
+  counters.onPublishResult(true, 0);
+  counters.onConnected();
+  counters.onConnected();
+  counters.onConnected();
+  const DEVICE_DIAGNOSTICS_SAMPLE & counted = counters.getLastSample();
+  bool publish_ok = counted.publish_successes == 2 && counted.publish_failures == 2 && counted.publish_retries == 2;
+  bool reconnects_ok = (counted.reconnects == 2);
+
+  // Diagnostics are published after the states
+  static MqttPublishScheduler scheduler;
+  scheduler.setRate(1, 1);
+  identify.getState().setDirty();
+  bell_sensor.getState().setDirty();
+  scheduler.scheduleState(&identify, MqttPublishScheduler::PRIORITY_DIAGNOSTIC);
+  scheduler.scheduleState(&bell_sensor);
+  recorder.reset();
+  scheduler.process(1000);
+  bool priority_ok = (recorder.getPublishCount() == 1 && bell_sensor.getStateTopic() == recorder.getLastTopic());
+  for(uint32_t now=2000; !scheduler.isEmpty(); now += 1000)
+    scheduler.process(now);
+
+  printf("%-52s %10s\n", "loop rate averaged between samples", (loop_rate_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "heap fragmentation and low water mark", (heap_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "publish successes, failures and retries", (publish_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "reconnects after the first connection", (reconnects_ok ? "yes" : "NO"));
+  printf("%-52s %10s\n", "diagnostics published after states", (priority_ok ? "yes" : "NO"));
+}
+
+int main(int argc, char * argv[]) {
+  // Discard the library's HA_MQTT_DISCOVERY_PRINT_FUNC output while measuring.
+  Serial.setOutput(NULL);
+
+  setup_device();
+
+  benchmark_discovery();
+  benchmark_discovery_size();
+  benchmark_state();
+  benchmark_entities();
+  benchmark_entity_table();
+  benchmark_dispatch();
+  benchmark_melodies();
+  benchmark_latency();
+  benchmark_edges();
+  benchmark_deadlines();
+  benchmark_fast_boot();
+  benchmark_brokers();
+  benchmark_log_buffer();
+  benchmark_diagnostics();
+  benchmark_scheduler();
+  benchmark_event_queue();
+  benchmark_batch();
+  benchmark_config_arena(); // packs the device, keep last
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+#ifndef DOORBELL_BINARY_MELODY_PLAYER
+#define DOORBELL_BINARY_MELODY_PLAYER
+
+#include <Arduino.h>
+
+// Non-blocking player for RTTTL melodies compiled by src/rtttl2bin.
+// Notes are decoded with a few shifts and a table lookup instead of parsing RTTTL text.
+//
+// Binary melody layout, in flash, little endian:
+//   uint16_t bpm;
+//   uint16_t note_count;
+//   notes, either packed on 10 bits (LSB first bit stream) or stored as uint16_t.
+// Note fields:
+//   bits 0-2: duration index, the note lasts 1/(2^index) of a whole note.
+//   bits 3-6: pitch index, 0 is a pause, 1 to 12 are C to B.
+//   bit  7:   dotted, the note lasts 1.5 times longer.
+//   bits 8-9: octave - 4.
+class BinaryMelodyPlayer {
+  public:
+    BinaryMelodyPlayer() {
+      pin = 0;
+      notes = NULL;
+      note_bits = 16;
+      note_count = 0;
+      next_note = 0;
+      whole_note_duration = 0;
+      note_end_time = 0;
+      playing = false;
+    }
+
+    // Starts playing a melody stored in flash. The first note is played by the next call to play().
+    void begin(uint8_t pin, const uint8_t * melody, uint8_t note_bits) {
+      stop();
+      if (melody == NULL || (note_bits != 10 && note_bits != 16))
+        return;
+
+      uint16_t bpm = readWord(melody);
+      this->pin = pin;
+      this->note_bits = note_bits;
+      note_count = readWord(melody + 2);
+      notes = melody + 4;
+      next_note = 0;
+      whole_note_duration = (bpm == 0 ? 0 : 240000UL / bpm); // 4 beats per whole note
+      playing = (note_count > 0);
+    }
+
+    // Call from loop(). Starts the next note when the current one is over.
+    void play() {
+      if (!playing)
+        return;
+
+      unsigned long now = millis();
+      if (next_note > 0 && (long)(now - note_end_time) < 0)
+        return; // the current note is still playing
+
+      if (next_note >= note_count) {
+        stop();
+        return;
+      }
+
+      uint16_t note = readNote(next_note++);
+      unsigned long duration = whole_note_duration >> (note & 0x07);
+      if (note & 0x80)
+        duration += duration / 2;
+
+      uint8_t pitch = (note >> 3) & 0x0F;
+      if (pitch == 0 || pitch > 12)
+        noTone(pin);
+      else
+        tone(pin, getFrequency(pitch, 4 + ((note >> 8) & 0x03)), duration);
+      note_end_time = now + duration;
+    }
+
+    void stop() {
+      if (playing)
+        noTone(pin);
+      playing = false;
+    }
+
+    inline bool isPlaying() const { return playing; }
+
+    // Returns the frequency in Hz of a pitch index (1 to 12) at the given octave (4 to 7).
+    static uint16_t getFrequency(uint8_t pitch, uint8_t octave) {
+      // Frequencies of the 8th octave. Lower octaves are halved, with rounding.
+      static const uint16_t octave8_frequencies[] PROGMEM = {4186, 4435, 4699, 4978, 5274, 5588, 5920, 6272, 6645, 7040, 7459, 7902};
+      uint16_t frequency = pgm_read_word(&octave8_frequencies[pitch - 1]);
+      uint8_t shift = 8 - octave;
+      return (uint16_t)((frequency + (1 << (shift - 1))) >> shift);
+    }
+
+  private:
+    static uint16_t readWord(const uint8_t * address) {
+      return (uint16_t)(pgm_read_byte(address) | (pgm_read_byte(address + 1) << 8));
+    }
+
+    uint16_t readNote(uint16_t index) const {
+      if (note_bits == 16)
+        return readWord(notes + 2*index);
+
+      // A 10 bit note always spans 2 bytes
+      uint32_t bit_offset = 10UL * index;
+      uint16_t bits = readWord(notes + (bit_offset >> 3));
+      return (bits >> (bit_offset & 0x07)) & 0x03FF;
+    }
+
+    uint8_t pin;
+    const uint8_t * notes;
+    uint8_t note_bits;
+    uint16_t note_count;
+    uint16_t next_note;
+    unsigned long whole_note_duration;
+    unsigned long note_end_time;
+    bool playing;
+};
+
+#endif // DOORBELL_BINARY_MELODY_PLAYER
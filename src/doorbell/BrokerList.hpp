@@ -0,0 +1,201 @@
+#ifndef DOORBELL_BROKER_LIST
+#define DOORBELL_BROKER_LIST
+
+#include <Arduino.h>
+
+// A broker the device may connect to. The host is a host name or an IPv4 address.
+struct BROKER_ENDPOINT {
+  const char * host;
+  uint16_t port;
+};
+
+// Ordered list of broker endpoints, with the resolved address of each host and a health score.
+// select() returns the first endpoint, in the list order, with less than the failover threshold
+// of recent connection failures. Failures are forgotten one at a time after the decay period,
+// so the preferred brokers are tried again once they had time to recover.
+// Resolved addresses are cached for the TTL. After a few consecutive failures, the address of
+// an endpoint is considered stale and must be resolved again, the broker may have moved.
+// The list does not resolve anything itself: see needsResolve() and setResolved().
+// Addresses use IPAddress's uint32_t layout (first octet in the low byte), 0 is unknown.
+template<size_t CAPACITY>
+class BrokerList {
+  public:
+    static const size_t INVALID_INDEX = (size_t)-1;
+
+    struct STATS {
+      uint32_t connections;      // successful connections
+      uint32_t failures;         // failed connection attempts
+      uint32_t failovers;        // select() changed the endpoint
+      uint32_t resolutions;      // successful resolutions
+      uint32_t resolve_failures; // failed resolutions, the previous address is kept
+    };
+
+    BrokerList() {
+      count = 0;
+      current = 0;
+      ttl = 300000;
+      retry_time = 10000;
+      resolve_after_failures = 2;
+      failover_after_failures = 3;
+      decay_period = 60000;
+      memset(&stats, 0, sizeof(stats));
+    }
+  private:
+    // Disable copy ctor
+    BrokerList(const BrokerList & copy) {}
+  public:
+
+    // Returns false if the list is full.
+    bool add(const BROKER_ENDPOINT & endpoint) {
+      if (count >= CAPACITY || endpoint.host == NULL)
+        return false;
+      ENTRY & entry = entries[count++];
+      entry.endpoint = endpoint;
+      entry.address = 0;
+      entry.expiry = 0;
+      entry.last_failure_time = 0;
+      entry.failures = 0;
+      entry.literal = parseIPv4(endpoint.host, entry.address);
+      return true;
+    }
+
+    // How long a resolved address is used before it is resolved again, in milliseconds.
+    inline void setTtl(uint32_t ttl) { this->ttl = ttl; }
+    // Delay before resolving again after a failed resolution, in milliseconds.
+    inline void setRetryTime(uint32_t retry_time) { this->retry_time = retry_time; }
+    inline void setResolveAfterFailures(uint8_t failures) { resolve_after_failures = (failures == 0 ? 1 : failures); }
+    inline void setFailoverAfterFailures(uint8_t failures) { failover_after_failures = (failures == 0 ? 1 : failures); }
+    inline void setDecayPeriod(uint32_t period) { decay_period = period; }
+
+    inline size_t getCount() const { return count; }
+    inline size_t getCurrent() const { return current; }
+    inline const BROKER_ENDPOINT & getEndpoint(size_t index) const { return entries[index].endpoint; }
+    inline uint32_t getAddress(size_t index) const { return entries[index].address; }
+    inline const STATS & getStats() const { return stats; }
+
+    // Number of recent failures of an endpoint, after the decay.
+    uint8_t getFailures(size_t index, uint32_t now) const {
+      const ENTRY & entry = entries[index];
+      if (entry.failures == 0 || decay_period == 0)
+        return entry.failures;
+      uint32_t forgotten = (now - entry.last_failure_time) / decay_period;
+      return (forgotten >= entry.failures ? 0 : (uint8_t)(entry.failures - forgotten));
+    }
+
+    // Selects the endpoint of the next connection attempt.
+    size_t select(uint32_t now) {
+      if (count == 0)
+        return INVALID_INDEX;
+      size_t selected = INVALID_INDEX;
+      size_t healthiest = 0;
+      for(size_t i=0; i<count && selected == INVALID_INDEX; i++) {
+        uint8_t failures = getFailures(i, now);
+        if (failures < failover_after_failures)
+          selected = i;
+        else if (failures < getFailures(healthiest, now))
+          healthiest = i;
+      }
+      if (selected == INVALID_INDEX)
+        selected = healthiest; // all endpoints are failing
+      if (selected != current)
+        stats.failovers++;
+      current = selected;
+      return current;
+    }
+
+    // Returns true if the host of the endpoint must be resolved before connecting:
+    // never resolved, TTL expired or invalidated by failures. IP addresses are never resolved.
+    bool needsResolve(size_t index, uint32_t now) const {
+      const ENTRY & entry = entries[index];
+      if (entry.literal)
+        return false;
+      return entry.expiry == 0 || (int32_t)(now - entry.expiry) >= 0;
+    }
+
+    // Result of a resolution, address is 0 if it failed. The previous address, if any, is kept on failure.
+    void setResolved(size_t index, uint32_t address, uint32_t now) {
+      ENTRY & entry = entries[index];
+      if (entry.literal)
+        return;
+      if (address == 0) {
+        stats.resolve_failures++;
+        entry.expiry = nonZero(now + retry_time);
+        return;
+      }
+      stats.resolutions++;
+      entry.address = address;
+      entry.expiry = nonZero(now + ttl);
+    }
+
+    // The address must be resolved again before the next connection.
+    void invalidate(size_t index) {
+      entries[index].expiry = 0;
+    }
+
+    void onConnected(uint32_t now) {
+      if (current >= count)
+        return;
+      entries[current].failures = 0;
+      stats.connections++;
+    }
+
+    void onConnectFailed(uint32_t now) {
+      if (current >= count)
+        return;
+      ENTRY & entry = entries[current];
+      uint8_t failures = getFailures(current, now); // apply the decay
+      if (failures < 0xFF)
+        failures++;
+      entry.failures = failures;
+      entry.last_failure_time = now;
+      stats.failures++;
+      if (failures % resolve_after_failures == 0)
+        invalidate(current);
+    }
+
+    // Parses a dotted IPv4 address. Returns false for a host name.
+    static bool parseIPv4(const char * host, uint32_t & address) {
+      uint32_t result = 0;
+      for(size_t octet=0; octet<4; octet++) {
+        if (*host < '0' || *host > '9')
+          return false;
+        uint32_t value = 0;
+        for(size_t digits=0; *host >= '0' && *host <= '9'; digits++, host++) {
+          value = value * 10 + (uint32_t)(*host - '0');
+          if (digits >= 3 || value > 255)
+            return false;
+        }
+        result |= value << (8 * octet);
+        if (octet < 3 && *host++ != '.')
+          return false;
+      }
+      if (*host != '\0')
+        return false;
+      address = result;
+      return true;
+    }
+
+  private:
+    struct ENTRY {
+      BROKER_ENDPOINT endpoint;
+      uint32_t address;
+      uint32_t expiry;            // millis() when the address must be resolved again, 0 to resolve now
+      uint32_t last_failure_time;
+      uint8_t failures;           // consecutive failures, before the decay
+      bool literal;               // the host is an IP address
+    };
+
+    static inline uint32_t nonZero(uint32_t time) { return (time == 0 ? 1 : time); }
+
+    ENTRY entries[CAPACITY];
+    size_t count;
+    size_t current;
+    uint32_t ttl;
+    uint32_t retry_time;
+    uint8_t resolve_after_failures;
+    uint8_t failover_after_failures;
+    uint32_t decay_period;
+    STATS stats;
+};
+
+#endif // DOORBELL_BROKER_LIST
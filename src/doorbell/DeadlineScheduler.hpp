@@ -0,0 +1,164 @@
+#ifndef DOORBELL_DEADLINE_SCHEDULER
+#define DOORBELL_DEADLINE_SCHEDULER
+
+#include <Arduino.h>
+
+// Owns up to CAPACITY millisecond timers and calls their callback when their deadline is reached.
+// Armed timers are kept in a binary min-heap ordered by deadline: update() only looks at the
+// earliest one when nothing is due, and getTimeUntilNext() tells how long loop() may idle.
+// Timers are registered once by add() and armed by start(), a stopped or expired timer is idle.
+// Deadlines wrap with millis(), all armed deadlines must be within 24 days of each other.
+template<size_t CAPACITY>
+class DeadlineScheduler {
+  public:
+    static_assert(CAPACITY > 0 && CAPACITY < 0xFF, "CAPACITY must be between 1 and 254");
+
+    typedef uint8_t TimerId;
+    typedef void (*Callback)();
+
+    static const TimerId INVALID_TIMER = 0xFF;
+    static const uint32_t NO_DEADLINE = 0xFFFFFFFF;
+
+    DeadlineScheduler() {
+      count = 0;
+      armed_count = 0;
+    }
+  private:
+    // Disable copy ctor
+    DeadlineScheduler(const DeadlineScheduler & copy) {}
+  public:
+
+    // Registers an idle timer. The callback may be NULL for a timer which is only polled with isPending().
+    // Returns INVALID_TIMER when the scheduler is full.
+    TimerId add(Callback callback) {
+      if (count >= CAPACITY)
+        return INVALID_TIMER;
+      TimerId id = (TimerId)count++;
+      timers[id].callback = callback;
+      timers[id].deadline = 0;
+      timers[id].position = INVALID_TIMER;
+      return id;
+    }
+
+    // (Re)arms a timer to expire delay milliseconds after now.
+    void start(TimerId id, uint32_t now, uint32_t delay) {
+      if (id >= count)
+        return;
+      TIMER & timer = timers[id];
+      timer.deadline = now + delay;
+      if (timer.position == INVALID_TIMER) {
+        timer.position = (uint8_t)armed_count;
+        heap[armed_count++] = id;
+        siftUp(timer.position);
+      } else {
+        // The new deadline may be earlier or later
+        siftUp(timer.position);
+        siftDown(timer.position);
+      }
+    }
+
+    // Disarms a timer without calling its callback.
+    void stop(TimerId id) {
+      if (id >= count || timers[id].position == INVALID_TIMER)
+        return;
+      remove(timers[id].position);
+    }
+
+    inline bool isPending(TimerId id) const {
+      return id < count && timers[id].position != INVALID_TIMER;
+    }
+
+    inline size_t getCount() const { return count; }
+    inline size_t getPendingCount() const { return armed_count; }
+
+    // Calls the callbacks of all expired timers, earliest deadline first.
+    // A callback may start any timer again, a timer restarted with no delay fires on the next update().
+    // Returns the number of expired timers.
+    size_t update(uint32_t now) {
+      size_t expired = 0;
+      size_t remaining = armed_count; // bounds the loop if callbacks restart their timer
+      while(armed_count > 0 && remaining-- > 0) {
+        TimerId id = heap[0];
+        if ((int32_t)(now - timers[id].deadline) < 0)
+          break;
+        remove(0);
+        expired++;
+        if (timers[id].callback)
+          timers[id].callback();
+      }
+      return expired;
+    }
+
+    // Milliseconds until the earliest deadline, 0 if a timer has expired or NO_DEADLINE if none is armed.
+    uint32_t getTimeUntilNext(uint32_t now) const {
+      if (armed_count == 0)
+        return NO_DEADLINE;
+      int32_t remaining = (int32_t)(timers[heap[0]].deadline - now);
+      return (remaining <= 0 ? 0 : (uint32_t)remaining);
+    }
+
+  private:
+    struct TIMER {
+      Callback callback;
+      uint32_t deadline;
+      uint8_t position; // index in the heap, INVALID_TIMER when idle
+    };
+
+    inline bool isEarlier(size_t a, size_t b) const {
+      return (int32_t)(timers[heap[a]].deadline - timers[heap[b]].deadline) < 0;
+    }
+
+    void swap(size_t a, size_t b) {
+      TimerId id = heap[a];
+      heap[a] = heap[b];
+      heap[b] = id;
+      timers[heap[a]].position = (uint8_t)a;
+      timers[heap[b]].position = (uint8_t)b;
+    }
+
+    void siftUp(size_t index) {
+      while(index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!isEarlier(index, parent))
+          break;
+        swap(index, parent);
+        index = parent;
+      }
+    }
+
+    void siftDown(size_t index) {
+      while(true) {
+        size_t earliest = index;
+        size_t left = 2 * index + 1;
+        size_t right = left + 1;
+        if (left < armed_count && isEarlier(left, earliest))
+          earliest = left;
+        if (right < armed_count && isEarlier(right, earliest))
+          earliest = right;
+        if (earliest == index)
+          break;
+        swap(index, earliest);
+        index = earliest;
+      }
+    }
+
+    void remove(size_t index) {
+      TimerId id = heap[index];
+      armed_count--;
+      if (index != armed_count) {
+        TimerId moved = heap[armed_count];
+        heap[index] = moved;
+        timers[moved].position = (uint8_t)index;
+        siftUp(index);
+        siftDown(timers[moved].position);
+      }
+      timers[id].position = INVALID_TIMER;
+    }
+
+    TIMER timers[CAPACITY];
+    TimerId heap[CAPACITY]; // armed timers, heap[0] has the earliest deadline
+    size_t count;
+    size_t armed_count;
+};
+
+#endif // DOORBELL_DEADLINE_SCHEDULER
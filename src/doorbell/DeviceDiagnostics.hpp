@@ -0,0 +1,89 @@
+#ifndef DOORBELL_DEVICE_DIAGNOSTICS
+#define DOORBELL_DEVICE_DIAGNOSTICS
+
+#include <Arduino.h>
+
+// Values of the diagnostic sensors, taken by DeviceDiagnostics::sample().
+struct DEVICE_DIAGNOSTICS_SAMPLE {
+  uint32_t free_heap;          // bytes
+  uint32_t largest_free_block; // bytes, the largest allocation which can succeed
+  uint8_t heap_fragmentation;  // percent, 100 - largest_free_block * 100 / free_heap
+  uint32_t loop_rate;          // loop() iterations per second since the previous sample
+  uint32_t publish_successes;  // since boot
+  uint32_t publish_failures;   // failed attempts, since boot
+  uint32_t publish_retries;    // attempts of a publication which failed before, since boot
+  uint32_t reconnects;         // connections to the broker after the first one
+  uint32_t mqtt_buffer_size;   // bytes held by the MQTT client's buffers
+  uint32_t min_free_heap;      // lowest free_heap of all samples
+};
+
+// Counts the activity of the device between two samples of the diagnostic sensors.
+// The counters are incremented from loop() and the MQTT result handlers, they are cheap enough
+// to be called on every iteration. The heap values are read by the caller, they are platform specific.
+class DeviceDiagnostics {
+  public:
+    DeviceDiagnostics() {
+      loops = 0;
+      last_sample_time = 0;
+      connections = 0;
+      memset(&last, 0, sizeof(last));
+      last.min_free_heap = 0xFFFFFFFF;
+    }
+  private:
+    // Disable copy ctor
+    DeviceDiagnostics(const DeviceDiagnostics & copy) {}
+  public:
+
+    inline void onLoop() { loops++; }
+
+    // Result of an attempt to publish. failures is the number of failed attempts of the
+    // publication including this one, like MqttPublishScheduler::REQUEST::failures.
+    void onPublishResult(bool success, uint8_t failures) {
+      uint8_t previous_failures = (success ? failures : failures - 1);
+      if (success)
+        last.publish_successes++;
+      else
+        last.publish_failures++;
+      if (previous_failures > 0)
+        last.publish_retries++;
+    }
+
+    void onConnected() {
+      connections++;
+      last.reconnects = (connections > 1 ? connections - 1 : 0);
+    }
+
+    // Takes a new sample. The loop rate is averaged since the previous sample.
+    const DEVICE_DIAGNOSTICS_SAMPLE & sample(uint32_t now, uint32_t free_heap, uint32_t largest_free_block, uint32_t mqtt_buffer_size) {
+      uint32_t elapsed = now - last_sample_time;
+      if (elapsed > 0)
+        last.loop_rate = (uint32_t)(((uint64_t)loops * 1000 + elapsed / 2) / elapsed);
+      loops = 0;
+      last_sample_time = now;
+
+      last.free_heap = free_heap;
+      last.largest_free_block = (largest_free_block > free_heap ? free_heap : largest_free_block);
+      last.heap_fragmentation = computeFragmentation(free_heap, largest_free_block);
+      last.mqtt_buffer_size = mqtt_buffer_size;
+      if (free_heap < last.min_free_heap)
+        last.min_free_heap = free_heap;
+      return last;
+    }
+
+    inline const DEVICE_DIAGNOSTICS_SAMPLE & getLastSample() const { return last; }
+
+    // Percentage of the free heap which can not be allocated in a single block.
+    static uint8_t computeFragmentation(uint32_t free_heap, uint32_t largest_free_block) {
+      if (free_heap == 0 || largest_free_block >= free_heap)
+        return 0;
+      return (uint8_t)(100 - (uint32_t)((uint64_t)largest_free_block * 100 / free_heap));
+    }
+
+  private:
+    uint32_t loops;
+    uint32_t last_sample_time;
+    uint32_t connections;
+    DEVICE_DIAGNOSTICS_SAMPLE last;
+};
+
+#endif // DOORBELL_DEVICE_DIAGNOSTICS
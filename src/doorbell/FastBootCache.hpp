@@ -0,0 +1,105 @@
+#ifndef DOORBELL_FAST_BOOT_CACHE
+#define DOORBELL_FAST_BOOT_CACHE
+
+#include <Arduino.h>
+
+// Network parameters of the last boot which reached the MQTT broker: the access point's
+// BSSID and channel, the DHCP lease and the address of the broker. Reusing them skips the WiFi scan,
+// DHCP and the DNS lookup of the next boot.
+// The cache is a plain block of 32-bit words, meant to be copied as is to RTC memory or to a file.
+// It is only valid for the configuration it was sealed with (WiFi SSID, broker host...)
+// and is rejected if any byte changed.
+// The IP lease is not renewed while it is reused: the DHCP server may give the address to another
+// device once the lease expires. lease_reuses counts the consecutive boots without DHCP so that
+// the caller can bound them with canReuseLease(), a boot with DHCP starts the count again.
+struct FAST_BOOT_DATA {
+  uint32_t magic;
+  uint32_t checksum;    // of all the following fields
+  uint32_t config_hash; // of the configuration the values were obtained with
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t broker_index; // of the broker the device was connected to
+  uint32_t local_ip;    // IPv4 addresses, as returned by IPAddress's uint32_t conversion
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint32_t broker_ip;   // 0 if the broker was not resolved
+  uint32_t lease_reuses; // consecutive boots which used local_ip without DHCP, keep last
+};
+static_assert(sizeof(FAST_BOOT_DATA) % 4 == 0, "RTC memory is accessed in blocks of 4 bytes");
+
+class FastBootCache {
+  public:
+    static const uint32_t MAGIC = 0x46424332; // "FBC2"
+
+    FastBootCache() {
+      clear();
+    }
+
+    void clear() {
+      memset(&data, 0, sizeof(data));
+    }
+
+    inline FAST_BOOT_DATA & getData() { return data; }
+    inline const FAST_BOOT_DATA & getData() const { return data; }
+
+    // Returns true if the data was sealed for the same configuration and is intact.
+    bool isValid(uint32_t config_hash) const {
+      return data.magic == MAGIC &&
+             data.config_hash == config_hash &&
+             data.checksum == computeChecksum(data) &&
+             data.local_ip != 0 &&
+             data.channel != 0;
+    }
+
+    // True if the next boot may use the lease without DHCP.
+    inline bool canReuseLease(uint32_t max_reuses) const {
+      return data.lease_reuses < max_reuses;
+    }
+
+    // Computes the checksum, call after changing the data.
+    void seal(uint32_t config_hash) {
+      data.magic = MAGIC;
+      data.config_hash = config_hash;
+      data.checksum = computeChecksum(data);
+    }
+
+    // Flash is only written when the content changes.
+    bool operator==(const FastBootCache & other) const {
+      return memcmp(&data, &other.data, sizeof(data)) == 0;
+    }
+    inline bool operator!=(const FastBootCache & other) const { return !(*this == other); }
+
+    // Same network parameters, the lease_reuses count and the checksum are ignored.
+    bool hasSameParameters(const FastBootCache & other) const {
+      size_t offset = offsetof(FAST_BOOT_DATA, config_hash);
+      size_t size = offsetof(FAST_BOOT_DATA, lease_reuses) - offset;
+      return data.magic == other.data.magic &&
+             memcmp((const uint8_t *)&data + offset, (const uint8_t *)&other.data + offset, size) == 0;
+    }
+
+    // Hash of a configuration string, combine several strings by passing the previous hash.
+    static uint32_t hashConfig(const char * str, uint32_t hash = 2166136261u) {
+      for(; *str != '\0'; str++)
+        hash = (hash ^ (uint8_t)*str) * 16777619u;
+      return (hash ^ 0xFF) * 16777619u; // separator, "ab"+"c" != "a"+"bc"
+    }
+
+  private:
+    // CRC-32 (IEEE), bitwise: the cache is checked once per boot.
+    static uint32_t computeChecksum(const FAST_BOOT_DATA & data) {
+      const uint8_t * bytes = (const uint8_t *)&data;
+      size_t offset = offsetof(FAST_BOOT_DATA, config_hash);
+      uint32_t crc = 0xFFFFFFFF;
+      for(size_t i=offset; i<sizeof(data); i++) {
+        crc ^= bytes[i];
+        for(int bit=0; bit<8; bit++)
+          crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+      }
+      return ~crc;
+    }
+
+    FAST_BOOT_DATA data;
+};
+
+#endif // DOORBELL_FAST_BOOT_CACHE
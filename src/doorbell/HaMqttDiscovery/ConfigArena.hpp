@@ -0,0 +1,212 @@
+#ifndef HA_MQTT_DISCOVERY_CONFIG_ARENA
+#define HA_MQTT_DISCOVERY_CONFIG_ARENA
+
+#include "HaMqttDiscovery.hpp"
+
+namespace HaMqttDiscovery {
+
+// Bump allocator for configuration strings which do not change after setup.
+// All strings are copied back to back in a single heap block, which is only released with the arena.
+// Before allocate() is called, add() only counts the number of bytes required.
+// See packConfiguration() in HaMqttEntity.hpp.
+class ConfigArena {
+  public:
+    ConfigArena() {
+      buffer = NULL;
+      capacity = 0;
+      used = 0;
+    }
+    ~ConfigArena() {
+      if (buffer)
+        free(buffer);
+    }
+  private:
+    // Disable copy ctor
+    ConfigArena(const ConfigArena & copy) {}
+  public:
+
+    bool allocate(size_t capacity) {
+      if (buffer != NULL || capacity == 0)
+        return false;
+      buffer = (char *)malloc(capacity);
+      if (buffer == NULL)
+        return false;
+      this->capacity = capacity;
+      used = 0;
+      return true;
+    }
+
+    inline bool isAllocated() const { return buffer != NULL; }
+    inline size_t getCapacity() const { return capacity; }
+    inline size_t getUsed() const { return used; }
+
+    // Copies a string and its terminating null character to the arena.
+    // Returns NULL when the arena is not allocated (the size is counted) or full.
+    const char * add(const char * str, size_t length) {
+      if (buffer == NULL) {
+        used += length + 1;
+        return NULL;
+      }
+      if (used + length + 1 > capacity)
+        return NULL;
+      char * copy = buffer + used;
+      memcpy(copy, str, length);
+      copy[length] = '\0';
+      used += length + 1;
+      return copy;
+    }
+
+  private:
+    char * buffer;
+    size_t capacity;
+    size_t used;
+};
+
+// A configuration string: a topic, a name, an identifier...
+// The string owns a heap copy of its value until pack() moves it to a ConfigArena.
+// Copies of a packed string share the arena's memory. See also fromStatic().
+class ConfigString {
+  public:
+    ConfigString() {
+      init();
+    }
+    ConfigString(const char * value) {
+      init();
+      assign(value, (value ? strlen(value) : 0));
+    }
+    ConfigString(const String & value) {
+      init();
+      assign(value.c_str(), value.length());
+    }
+    ConfigString(const ConfigString & other) {
+      init();
+      copyFrom(other);
+    }
+    ConfigString(ConfigString && other) {
+      init();
+      moveFrom(other);
+    }
+    ~ConfigString() {
+      release();
+    }
+
+    ConfigString & operator=(const char * value) {
+      assign(value, (value ? strlen(value) : 0));
+      return *this;
+    }
+    ConfigString & operator=(const String & value) {
+      assign(value.c_str(), value.length());
+      return *this;
+    }
+    ConfigString & operator=(const ConfigString & other) {
+      if (this != &other)
+        copyFrom(other);
+      return *this;
+    }
+    ConfigString & operator=(ConfigString && other) {
+      if (this != &other)
+        moveFrom(other);
+      return *this;
+    }
+
+    // Refers to a string which is never released, like a string literal, without copying it.
+    static ConfigString fromStatic(const char * value) {
+      ConfigString str;
+      if (value != NULL && value[0] != '\0') {
+        str.data = value;
+        str.size = (uint16_t)strlen(value);
+        str.packed = true;
+      }
+      return str;
+    }
+
+    inline const char * c_str() const { return data; }
+    inline size_t length() const { return size; }
+    inline bool isEmpty() const { return size == 0; }
+    inline bool isPacked() const { return packed; }
+
+    bool equals(const char * value, size_t length) const {
+      return (size == length && memcmp(data, value, length) == 0);
+    }
+    inline bool operator==(const char * value) const { return value != NULL && equals(value, strlen(value)); }
+    inline bool operator==(const String & value) const { return equals(value.c_str(), value.length()); }
+    inline bool operator==(const ConfigString & value) const { return equals(value.data, value.size); }
+    inline bool operator!=(const char * value) const { return !(*this == value); }
+    inline bool operator!=(const String & value) const { return !(*this == value); }
+    inline bool operator!=(const ConfigString & value) const { return !(*this == value); }
+
+    // Moves the value to the arena and releases its heap copy.
+    // Returns false if the value stays on the heap (counting pass or full arena).
+    bool pack(ConfigArena & arena) {
+      if (packed || size == 0)
+        return packed;
+      uint16_t length = size;
+      const char * copy = arena.add(data, length);
+      if (copy == NULL)
+        return false;
+      release();
+      data = copy;
+      size = length;
+      packed = true;
+      return true;
+    }
+
+  private:
+    void init() {
+      data = "";
+      size = 0;
+      packed = false;
+    }
+
+    void release() {
+      if (!packed && size > 0)
+        free((void *)data);
+      init();
+    }
+
+    void assign(const char * value, size_t length) {
+      if (length == 0) {
+        release();
+        return;
+      }
+      char * copy = (char *)malloc(length + 1);
+      if (copy == NULL) {
+#       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+        HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "ConfigString: out of memory.\n");
+#       endif
+        return;
+      }
+      memcpy(copy, value, length);
+      copy[length] = '\0';
+      release();
+      data = copy;
+      size = length;
+    }
+
+    void copyFrom(const ConfigString & other) {
+      if (other.packed) {
+        release();
+        data = other.data;
+        size = other.size;
+        packed = true;
+      } else {
+        assign(other.data, other.size);
+      }
+    }
+
+    void moveFrom(ConfigString & other) {
+      release();
+      data = other.data;
+      size = other.size;
+      packed = other.packed;
+      other.init();
+    }
+
+    const char * data; // never NULL
+    uint16_t size;
+    bool packed;       // data points to a ConfigArena or a static string, otherwise it is owned when size > 0
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_CONFIG_ARENA
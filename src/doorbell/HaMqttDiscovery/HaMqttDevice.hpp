@@ -2,10 +2,11 @@
 #define HA_MQTT_DISCOVERY_DEVICE
 
 #include <vector>
-#include <ArduinoJson.h>
 
 #include "MqttLastWillAndTestament.hpp"
 #include "MqttAdaptor.hpp"
+#include "JsonWriter.hpp"
+#include "ConfigArena.hpp"
 
 namespace HaMqttDiscovery {
 
@@ -14,27 +15,41 @@ class HaMqttEntity;
 
 class HaMqttDevice {
   public:
-    typedef std::vector<String> StringVector;
+    typedef std::vector<ConfigString> StringVector;
     typedef std::vector<HaMqttEntity*> EntityPtrVector;
 
+    static const size_t MAX_DIRTY_TRACKED_ENTITIES = 32;
+
     HaMqttDevice() {
         mqtt_adaptor = NULL;
+        revision = 0;
+        compact_discovery = false;
+        dirty_entities = 0;
     }
 
     HaMqttDevice(const char * identifier, const char * name_) {
         mqtt_adaptor = NULL;
+        revision = 0;
+        compact_discovery = false;
+        dirty_entities = 0;
         identifiers.push_back(identifier);
         name = name_;
     }
 
     HaMqttDevice(const String& identifier, const String & name_) {
         mqtt_adaptor = NULL;
+        revision = 0;
+        compact_discovery = false;
+        dirty_entities = 0;
         identifiers.push_back(identifier);
         name = name_;
     }
 
     HaMqttDevice(const char * identifier, const char * name_, const char * manufacturer_, const char * model_) {
         mqtt_adaptor = NULL;
+        revision = 0;
+        compact_discovery = false;
+        dirty_entities = 0;
         identifiers.push_back(identifier);
         name = name_;
         manufacturer = manufacturer_;
@@ -43,6 +58,9 @@ class HaMqttDevice {
 
     HaMqttDevice(const String& identifier, const String& name_, const String& manufacturer_, const String& model_) {
         mqtt_adaptor = NULL;
+        revision = 0;
+        compact_discovery = false;
+        dirty_entities = 0;
         identifiers.push_back(identifier);
         name = name_;
         manufacturer = manufacturer_;
@@ -58,11 +76,12 @@ class HaMqttDevice {
 
     size_t addEntity(HaMqttEntity * entity) {
       entities.push_back(entity);
+      revision++;
       size_t entity_index = entities.size() - 1;
       return entity_index;
     }
 
-    size_t getEntityIndex(HaMqttEntity * entity) {
+    size_t getEntityIndex(const HaMqttEntity * entity) const {
       for(size_t i=0; i<entities.size(); i++) {
         const HaMqttEntity * e = entities[i];
         if (entity == e) {
@@ -76,126 +95,161 @@ class HaMqttDevice {
       return entities;
     }
 
+    // Returns the bit of the given entity in getDirtyEntities() or 0 if the entity is not tracked.
+    uint32_t getEntityBit(const HaMqttEntity * entity) const {
+      size_t index = getEntityIndex(entity);
+      if (index >= MAX_DIRTY_TRACKED_ENTITIES)
+        return 0;
+      return (1UL << index);
+    }
+
+    // Bit i is set while the state of entities[i] must be published.
+    // Entities update the set from their MqttState, so finding dirty entities does not
+    // require to visit all of them. Only the first MAX_DIRTY_TRACKED_ENTITIES entities are tracked.
+    inline uint32_t getDirtyEntities() const { return dirty_entities; }
+    inline uint32_t * getDirtyEntitiesSet() { return &dirty_entities; }
+
     void addIdentifier(const char * value) { addIdentifier(String(value)); }
     void addIdentifier(const String & value) {
         identifiers.push_back(value);
 
         if (identifiers.size() == 1) {
-          availability_topic = getFirstIdentifier() + "/status";
+          availability_topic = String(getFirstIdentifier().c_str()) + "/status";
         }
+        revision++;
     }
 
     size_t getIdentifiersCount() const {
         return identifiers.size();
     }
 
-    const String * getIdentifier(size_t index) const {
+    const ConfigString * getIdentifier(size_t index) const {
         if (index < identifiers.size())
             return &identifiers[index];
         return NULL;
     }
 
-    const String & getFirstIdentifier() const {
+    const ConfigString & getFirstIdentifier() const {
       if (identifiers.empty()) {
-        static const String EMPTY;
+        static const ConfigString EMPTY;
         return EMPTY;
       }
-      const String & first_identifier = identifiers[0];
+      const ConfigString & first_identifier = identifiers[0];
       return first_identifier;
     }
 
     void setName(const String & value) {
         name = value;
+        revision++;
     }
 
     void setName(const char * value) {
         name = value;
+        revision++;
     }
 
-    const String & getName() const {
+    const ConfigString & getName() const {
         return name;
     }
 
     void setManufacturer(const String & value) {
         manufacturer = value;
+        revision++;
     }
 
     void setManufacturer(const char * value) {
         manufacturer = value;
+        revision++;
     }
 
-    const String & getManufacturer() const {
+    const ConfigString & getManufacturer() const {
         return manufacturer;
     }
 
     void setModel(const String & value) {
         model = value;
+        revision++;
     }
 
     void setModel(const char * value) {
         model = value;
+        revision++;
     }
 
-    const String & getModel() const {
+    const ConfigString & getModel() const {
         return model;
     }
 
     void setHardwareVersion(const String & value) {
         hw_version = value;
+        revision++;
     }
 
     void setHardwareVersion(const char * value) {
         hw_version = value;
+        revision++;
     }
 
-    const String & getHardwareVersion() const {
+    const ConfigString & getHardwareVersion() const {
         return hw_version;
     }
 
     void setSoftwareVersion(const String & value) {
         sw_version = value;
+        revision++;
     }
 
     void setSoftwareVersion(const char * value) {
         sw_version = value;
+        revision++;
     }
 
-    const String & getSoftwareVersion() const {
+    const ConfigString & getSoftwareVersion() const {
         return sw_version;
     }
 
     void setConfigurationUrl (const String & value) {
         configuration_url  = value;
+        revision++;
     }
 
     void setConfigurationUrl(const char * value) {
         configuration_url  = value;
+        revision++;
     }
 
-    const String & getConfigurationUrl() const {
+    const ConfigString & getConfigurationUrl() const {
         return configuration_url ;
     }
 
     void setSuggestedArea(const String & value) {
         suggested_area = value;
+        revision++;
     }
 
     void setSuggestedArea(const char * value) {
         suggested_area = value;
+        revision++;
     }
 
-    const String & getSuggestedArea() const {
+    const ConfigString & getSuggestedArea() const {
         return suggested_area;
     }
 
+    // Incremented every time an attribute published in the discovery payload changes.
+    // Entities compare it with the revision of their cached discovery payload.
+    uint32_t getRevision() const {
+        return revision;
+    }
+
     bool getLastWillAndTestamentInfo(MqttLastWillAndTestament & lwt) const {
-      const String & first_identifier = getFirstIdentifier();
+      const ConfigString & first_identifier = getFirstIdentifier();
       if (first_identifier.isEmpty()) {
         lwt.clear();
         return false;
       }
 
-      lwt.topic = availability_topic;
+      lwt.topic = availability_topic.c_str();
       lwt.payload = ha_availability_offline;
       lwt.qos = 2;
       lwt.retain = true;
@@ -203,7 +257,7 @@ class HaMqttDevice {
       return true;
     }
 
-    const String & getAvailabilityTopic() const {
+    const ConfigString & getAvailabilityTopic() const {
       return availability_topic;
     }
 
@@ -213,7 +267,7 @@ class HaMqttDevice {
 
       const char * topic = availability_topic.c_str();
       const char * payload = (online ? ha_availability_online.c_str() : ha_availability_offline.c_str());
-      bool result = mqtt_adaptor->publish(topic, payload);
+      bool result = mqtt_adaptor->publish(topic, payload, true); // retained, like the last will and testament
 
 #     ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
       if (result) {
@@ -232,44 +286,92 @@ class HaMqttDevice {
       return result;
     }
 
-    void serializeTo(JsonObject json_object) const {
-        JsonArray json_identifiers = json_object.createNestedArray("identifiers");
+    // Moves the device's strings to the arena and trims its vectors.
+    // See packConfiguration() which also packs the strings of the entities.
+    void pack(ConfigArena & arena) {
+      for(size_t i=0; i<identifiers.size(); i++)
+        identifiers[i].pack(arena);
+      availability_topic.pack(arena);
+      name.pack(arena);
+      manufacturer.pack(arena);
+      model.pack(arena);
+      hw_version.pack(arena);
+      sw_version.pack(arena);
+      configuration_url.pack(arena);
+      suggested_area.pack(arena);
+      via_device.pack(arena);
+      if (arena.isAllocated()) {
+        identifiers.shrink_to_fit();
+        entities.shrink_to_fit();
+      }
+    }
+
+    // Compact discovery payloads use Home Assistant's abbreviated keys,
+    // the '~' base topic and send the full device information with the first entity only.
+    void setCompactDiscovery(bool value) {
+        compact_discovery = value;
+        revision++;
+    }
+
+    bool isCompactDiscovery() const {
+        return compact_discovery;
+    }
+
+    // Serialize the device object of a discovery payload.
+    // When identifiers_only is set, only the identifiers are written. Home Assistant
+    // merges them with the device information received from another entity.
+    void serializeTo(JsonWriter & writer, bool compact = false, bool identifiers_only = false) const {
+        writer.beginObject();
+
+        writer.key(compact ? "ids" : "identifiers");
+        writer.beginArray();
         for(size_t i=0; i<identifiers.size(); i++) {
-            const String & identifier = identifiers[i];
-            json_identifiers.add(identifier);
+            const ConfigString & identifier = identifiers[i];
+            writer.value(identifier.c_str());
         }
-        
-        json_object["name"] = name;
+        writer.endArray();
+
+        if (identifiers_only) {
+            writer.endObject();
+            return;
+        }
+
+        writer.keyValue("name", name.c_str());
 
         if (!manufacturer.isEmpty())
-            json_object["manufacturer"] = manufacturer;
+            writer.keyValue(compact ? "mf" : "manufacturer", manufacturer.c_str());
         if (!model.isEmpty())
-            json_object["model"] = model;
+            writer.keyValue(compact ? "mdl" : "model", model.c_str());
         if (!hw_version.isEmpty())
-            json_object["hw_version"] = hw_version;
+            writer.keyValue(compact ? "hw" : "hw_version", hw_version.c_str());
         if (!sw_version.isEmpty())
-            json_object["sw_version"] = sw_version;
+            writer.keyValue(compact ? "sw" : "sw_version", sw_version.c_str());
         if (!configuration_url.isEmpty())
-            json_object["configuration_url"] = configuration_url;
+            writer.keyValue(compact ? "cu" : "configuration_url", configuration_url.c_str());
         if (!suggested_area.isEmpty())
-            json_object["suggested_area"] = suggested_area;
+            writer.keyValue(compact ? "sa" : "suggested_area", suggested_area.c_str());
         if (!via_device.isEmpty())
-            json_object["via_device"] = via_device;
+            writer.keyValue("via_device", via_device.c_str());
+
+        writer.endObject();
     }
 
   private:
     MqttAdaptor * mqtt_adaptor;
     EntityPtrVector entities;
+    uint32_t revision;
+    uint32_t dirty_entities;
+    bool compact_discovery;
     StringVector identifiers;
-    String availability_topic;        // computed when first calling addIdentifier()
-    String name;
-    String manufacturer;
-    String model;
-    String hw_version;
-    String sw_version;
-    String configuration_url;
-    String suggested_area;
-    String via_device;
+    ConfigString availability_topic;        // computed when first calling addIdentifier()
+    ConfigString name;
+    ConfigString manufacturer;
+    ConfigString model;
+    ConfigString hw_version;
+    ConfigString sw_version;
+    ConfigString configuration_url;
+    ConfigString suggested_area;
+    ConfigString via_device;
 };
 
 }; // namespace HaMqttDiscovery
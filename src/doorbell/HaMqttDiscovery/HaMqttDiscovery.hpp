@@ -3,11 +3,13 @@
 
 namespace HaMqttDiscovery {
 
-#ifndef HA_MQTT_DISCOVERY_PRINT_FUNC
+// Define HA_MQTT_DISCOVERY_NO_PRINT to compile out all the library's messages.
+#if !defined(HA_MQTT_DISCOVERY_PRINT_FUNC) && !defined(HA_MQTT_DISCOVERY_NO_PRINT)
 #   define HA_MQTT_DISCOVERY_PRINT_FUNC Serial.print
 #endif
 
 static String ha_discovery_prefix = "homeassistant";
+static String ha_status_topic = "homeassistant/status"; // Home Assistant's birth and last will topic
 static String ha_availability_online = "online";
 static String ha_availability_offline = "offline";
 static String error_message_prefix = "";
@@ -69,6 +71,70 @@ const char * toString(const HA_MQTT_INTEGRATION_TYPE & type) {
     };
 }
 
+// FNV-1a hash function, used for hashing topics and payloads.
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+inline uint32_t fnv1a(const uint8_t * buffer, size_t length, uint32_t hash = FNV_OFFSET_BASIS) {
+    for(size_t i=0; i<length; i++)
+        hash = (hash ^ buffer[i]) * FNV_PRIME;
+    return hash;
+}
+
+inline uint32_t fnv1a(const char * str) {
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for(; *str != '\0'; str++)
+        hash = (hash ^ (uint8_t)*str) * FNV_PRIME;
+    return hash;
+}
+
+// Home Assistant's abbreviations for discovery payload keys.
+// See https://www.home-assistant.io/integrations/mqtt/#supported-abbreviations-in-mqtt-discovery-messages
+struct HA_MQTT_ABBREVIATION {
+    const char * key;
+    const char * abbreviation;
+};
+
+static const HA_MQTT_ABBREVIATION ha_abbreviations[] = {
+    {"availability_topic"    , "avty_t"       },
+    {"command_topic"         , "cmd_t"        },
+    {"configuration_url"     , "cu"           },
+    {"device"                , "dev"          },
+    {"device_class"          , "dev_cla"      },
+    {"entity_category"       , "ent_cat"      },
+    {"hw_version"            , "hw"           },
+    {"icon"                  , "ic"           },
+    {"identifiers"           , "ids"          },
+    {"json_attributes_topic" , "json_attr_t"  },
+    {"manufacturer"          , "mf"           },
+    {"model"                 , "mdl"          },
+    {"object_id"             , "obj_id"       },
+    {"options"               , "ops"          },
+    {"payload_available"     , "pl_avail"     },
+    {"payload_not_available" , "pl_not_avail" },
+    {"payload_off"           , "pl_off"       },
+    {"payload_on"            , "pl_on"        },
+    {"payload_press"         , "pl_prs"       },
+    {"retain"                , "ret"          },
+    {"state_class"           , "stat_cla"     },
+    {"state_topic"           , "stat_t"       },
+    {"suggested_area"        , "sa"           },
+    {"sw_version"            , "sw"           },
+    {"unique_id"             , "uniq_id"      },
+    {"unit_of_measurement"   , "unit_of_meas" },
+    {"value_template"        , "val_tpl"      },
+};
+
+// Returns Home Assistant's abbreviation of the given discovery key or the key itself if it has no abbreviation.
+const char * toAbbreviation(const char * key) {
+    static const size_t count = sizeof(ha_abbreviations)/sizeof(ha_abbreviations[0]);
+    for(size_t i=0; i<count; i++) {
+        if (strcmp(ha_abbreviations[i].key, key) == 0)
+            return ha_abbreviations[i].abbreviation;
+    }
+    return key;
+}
+
 }; // namespace HaMqttDiscovery
 
 #endif // HA_MQTT_DISCOVERY
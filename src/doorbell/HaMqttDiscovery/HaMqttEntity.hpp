@@ -4,13 +4,13 @@
 #include "HaMqttDiscovery.hpp"
 #include "HaMqttDevice.hpp"
 #include "MqttState.hpp"
-
-#include <ArduinoJson.h>
+#include "JsonWriter.hpp"
 
 namespace HaMqttDiscovery {
 
 class HaMqttDevice;
 class HaMqttEntity;
+template<size_t COUNT> class HaMqttEntityTable;
 
 class HaMqttEntity {
   public:
@@ -22,18 +22,40 @@ class HaMqttEntity {
       size_t count;      
     };
 
+    // Function writing the values of an array to a discovery payload, between beginArray() and endArray().
+    // Used for arrays that are not stored in RAM.
+    typedef void (*ArraySerializer)(JsonWriter & writer);
+
+    // Function called when a message is received on the entity's command topic.
+    typedef void (*CommandHandler)(HaMqttEntity & entity, const uint8_t * payload, size_t length);
+
     HaMqttEntity() {
+        this->mqtt_adaptor = NULL;
         this->device = NULL;
+        this->command_handler = NULL;
+        this->state_retained = false;
+        this->discovery_cache_valid = false;
+        this->discovery_published = false;
         this->type = HA_MQTT_INTEGRATION_TYPE::HA_MQTT_BINARY_SENSOR;
     }
 
     HaMqttEntity(const HA_MQTT_INTEGRATION_TYPE & type) {
+        this->mqtt_adaptor = NULL;
         this->device = NULL;
+        this->command_handler = NULL;
+        this->state_retained = false;
+        this->discovery_cache_valid = false;
+        this->discovery_published = false;
         this->type = type;
     }
 
     HaMqttEntity(const HA_MQTT_INTEGRATION_TYPE & type, const char * name, const char * unique_id, const char * object_id) {
+        this->mqtt_adaptor = NULL;
         this->device = NULL;
+        this->command_handler = NULL;
+        this->state_retained = false;
+        this->discovery_cache_valid = false;
+        this->discovery_published = false;
         this->type = type;
         this->name = name;
         this->unique_id = unique_id;
@@ -46,6 +68,7 @@ class HaMqttEntity {
 
     void setIntegrationType(const HA_MQTT_INTEGRATION_TYPE & type) {
         this->type = type;
+        invalidateDiscoveryCache();
     }
 
     const HA_MQTT_INTEGRATION_TYPE & getIntegrationType() const {
@@ -54,61 +77,86 @@ class HaMqttEntity {
 
     void setName(const String & value) {
         name = value;
+        invalidateDiscoveryCache();
     }
 
     void setName(const char * value) {
         name = value;
+        invalidateDiscoveryCache();
     }
 
-    const String & getName() const {
+    const ConfigString & getName() const {
         return name;
     }
 
     void setUniqueId(const String & value) {
         unique_id = value;
+        invalidateDiscoveryCache();
     }
 
     void setUniqueId(const char * value) {
         unique_id = value;
+        invalidateDiscoveryCache();
     }
 
-    const String & getUniqueId() const {
+    const ConfigString & getUniqueId() const {
         return unique_id;
     }
 
     void setObjectId(const String & value) {
         object_id = value;
+        invalidateDiscoveryCache();
     }
 
     void setObjectId(const char * value) {
         object_id = value;
+        invalidateDiscoveryCache();
     }
 
-    const String & getObjectId() const {
+    const ConfigString & getObjectId() const {
         return object_id;
     }
 
     void setCommandTopic(const String & value) {
         command_topic = value;
+        invalidateDiscoveryCache();
     }
 
     void setCommandTopic(const char * value) {
         command_topic = value;
+        invalidateDiscoveryCache();
     }
 
-    const String & getCommandTopic() const {
+    const ConfigString & getCommandTopic() const {
         return command_topic;
     }
 
+    void setCommandHandler(CommandHandler handler) {
+        command_handler = handler;
+    }
+
+    CommandHandler getCommandHandler() const {
+        return command_handler;
+    }
+
+    bool handleCommand(const uint8_t * payload, size_t length) {
+        if (command_handler == NULL)
+            return false;
+        command_handler(*this, payload, length);
+        return true;
+    }
+
     void setStateTopic(const String & value) {
         state_topic = value;
+        invalidateDiscoveryCache();
     }
 
     void setStateTopic(const char * value) {
         state_topic = value;
+        invalidateDiscoveryCache();
     }
 
-    const String & getStateTopic() const {
+    const ConfigString & getStateTopic() const {
         return state_topic;
     }
 
@@ -128,6 +176,16 @@ class HaMqttEntity {
         return state;
     }
 
+    // Retained states are kept by the broker and sent to Home Assistant when it subscribes,
+    // so they do not need to be published again periodically.
+    void setStateRetained(bool value) {
+        state_retained = value;
+    }
+
+    bool isStateRetained() const {
+        return state_retained;
+    }
+
     const MqttState & getState() const {
         return state;
     }
@@ -138,7 +196,7 @@ class HaMqttEntity {
       
       // Is this entity already added to the device ?
       if (device->getEntityIndex(this) == INVALID_ENTITY_INDEX) {
-        device->addEntity(this);
+        addToDevice();
       }
 
       const HaMqttDevice::EntityPtrVector & entities = device->getEntities();
@@ -158,35 +216,38 @@ class HaMqttEntity {
     void setUniqueIdFromDeviceId() {
       if (!device)
         return;
-      const String * first_device_identifier = device->getIdentifier(0);
+      const ConfigString * first_device_identifier = device->getIdentifier(0);
       if (!first_device_identifier)
         return;
 
       // Is this entity already added to the device ?
       if (device->getEntityIndex(this) == INVALID_ENTITY_INDEX) {
-        device->addEntity(this);
+        addToDevice();
       }
       size_t entity_index = getEntityIndexForIntegrationType();
       
       // Build a new unique_id
-      String new_unique_id = (*first_device_identifier) + "_" + toString(type) + String(entity_index);
+      String new_unique_id = String(first_device_identifier->c_str()) + "_" + toString(type) + String(entity_index);
       unique_id = new_unique_id;
+      invalidateDiscoveryCache();
     }
 
     void setObjectIdFromDeviceIdAndEntityName() {
       if (!device)
         return;
-      const String * first_device_identifier = device->getIdentifier(0);
+      const ConfigString * first_device_identifier = device->getIdentifier(0);
       if (!first_device_identifier)
         return;
 
       // Build a new object_id
-      String new_object_id = (*first_device_identifier) + "_" + this->name;
+      String new_object_id = String(first_device_identifier->c_str()) + "_" + this->name.c_str();
       object_id = new_object_id;
+      invalidateDiscoveryCache();
     }
 
     void setDevice(HaMqttDevice * device) {
       this->device = device;
+      invalidateDiscoveryCache();
 
       // Can we generate an automatic unique_id for this entity ?
       if (unique_id.isEmpty()) {
@@ -208,6 +269,7 @@ class HaMqttEntity {
       pair.key = key;
       pair.value = value;
       more_string_values.push_back(pair);
+      invalidateDiscoveryCache();
     }
     inline void addKeyValue(const char * key, const char * value) { addKeyValue(String(key), String(value)); }
 
@@ -230,6 +292,7 @@ class HaMqttEntity {
       entry.the_array.values = values;
       entry.the_array.count = count;
       more_static_cstr_entries.push_back(entry);
+      invalidateDiscoveryCache();
     }
 
     const STATIC_CSTR_ARRAY * getStaticCStrArray(const String & key) const {
@@ -244,91 +307,208 @@ class HaMqttEntity {
     inline bool hasStaticCStr(const String & key) const { return getStaticCStrArray(key) != NULL; }
     inline bool hasStaticCStr(const char * key) const { return getStaticCStrArray(String(key)) != NULL; }
 
+    void addArraySerializer(const String & key, ArraySerializer serializer) {
+      ARRAY_SERIALIZER_ENTRY entry;
+      entry.key = key;
+      entry.serializer = serializer;
+      more_array_serializers.push_back(entry);
+      invalidateDiscoveryCache();
+    }
+
 
 
     void getDiscoveryTopic(String & topic) const {
-      if (!unique_id.isEmpty()) {
-        topic = ha_discovery_prefix + "/" + toString(type) + "/" + unique_id + "/config";
-      } else {
-        const String * device_identifier = NULL;
-        if (device) {
-          device_identifier = device->getIdentifier(0);
-        }
-        if (device_identifier)
-          topic = ha_discovery_prefix + "/" + toString(type) + "/" + (*device_identifier) + "_" + unique_id + "/config";
-        else
-          topic = ha_discovery_prefix + "/" + toString(type) + "/" + unique_id + "/config";
+      topic = getDiscoveryTopic().c_str();
+    }
+
+    const ConfigString & getDiscoveryTopic() const {
+      updateDiscoveryCache();
+      return discovery_topic;
+    }
+
+    void serializeDiscoveryPayload(JsonWriter & writer) const {
+      bool compact = (device && device->isCompactDiscovery());
+
+      // In compact mode, topics starting with the device's first identifier are written relative to the '~' base topic
+      const char * base_topic = NULL;
+      if (compact) {
+        base_topic = device->getFirstIdentifier().c_str();
+        size_t topics_with_base = 0;
+        if (hasBaseTopic(command_topic, base_topic))
+          topics_with_base++;
+        if (hasBaseTopic(state_topic, base_topic))
+          topics_with_base++;
+        if (hasBaseTopic(device->getAvailabilityTopic(), base_topic))
+          topics_with_base++;
+        if (topics_with_base < 2)
+          base_topic = NULL; // not worth it
       }
-    }
 
-    void getDiscoveryPayload(String & payload) const {
-      DynamicJsonDocument doc(1024);
+      writer.beginObject();
+
+      if (base_topic)
+        writer.keyValue("~", base_topic);
 
       // serialize key-value pairs
       for(size_t i=0; i<more_string_values.size(); i++) {
         const KEY_VALUE_PAIR & pair = more_string_values[i];
-        doc[pair.key] = pair.value;
+        if (compact)
+          writer.keyValue(toAbbreviation(pair.key.c_str()), pair.value.c_str());
+        else
+          writer.keyValue(pair.key.c_str(), pair.value.c_str());
       };
 
       // serialize static cstr arrays
       for(size_t i=0; i<more_static_cstr_entries.size(); i++) {
         const STATIC_CSTR_ARRAY_ENTRY & entry = more_static_cstr_entries[i];
-        JsonArray json_array = doc.createNestedArray(entry.key.c_str());
+        writer.key(compact ? toAbbreviation(entry.key.c_str()) : entry.key.c_str());
+        writer.beginArray();
         for(size_t j=0; j<entry.the_array.count; j++) {
-          json_array.add(entry.the_array.values[j]);
+          writer.value(entry.the_array.values[j]);
         }
+        writer.endArray();
+      }
+
+      // serialize arrays written by callbacks
+      for(size_t i=0; i<more_array_serializers.size(); i++) {
+        const ARRAY_SERIALIZER_ENTRY & entry = more_array_serializers[i];
+        writer.key(compact ? toAbbreviation(entry.key.c_str()) : entry.key.c_str());
+        writer.beginArray();
+        entry.serializer(writer);
+        writer.endArray();
       }
 
       // serialize base attributes
       if (!name.isEmpty())
-        doc["name"] = name;
+        writer.keyValue("name", name.c_str());
       if (!unique_id.isEmpty())
-        doc["unique_id"] = unique_id;
+        writer.keyValue(compact ? "uniq_id" : "unique_id", unique_id.c_str());
       if (!object_id.isEmpty())
-        doc["object_id"] = object_id;
+        writer.keyValue(compact ? "obj_id" : "object_id", object_id.c_str());
       if (!command_topic.isEmpty())
-        doc["command_topic"] = command_topic;
+        serializeTopic(writer, compact ? "cmd_t" : "command_topic", command_topic, base_topic);
       if (!state_topic.isEmpty())
-        doc["state_topic"] = state_topic;
+        serializeTopic(writer, compact ? "stat_t" : "state_topic", state_topic, base_topic);
 
       // serialize device, if any
       if (device) {
-        doc["availability_topic"] = device->getAvailabilityTopic();
-        doc["payload_available"] = ha_availability_online;
-        doc["payload_not_available"] = ha_availability_offline;
+        serializeTopic(writer, compact ? "avty_t" : "availability_topic", device->getAvailabilityTopic(), base_topic);
 
-        JsonObject json_device = doc.createNestedObject("device");
-        device->serializeTo(json_device);
+        // "online" and "offline" are Home Assistant's default availability payloads
+        if (!compact || ha_availability_online != "online")
+          writer.keyValue(compact ? "pl_avail" : "payload_available", ha_availability_online);
+        if (!compact || ha_availability_offline != "offline")
+          writer.keyValue(compact ? "pl_not_avail" : "payload_not_available", ha_availability_offline);
+
+        // In compact mode, only the first entity of the device publishes the full device information
+        bool identifiers_only = (compact && device->getEntityIndex(this) != 0);
+
+        writer.key(compact ? "dev" : "device");
+        device->serializeTo(writer, compact, identifiers_only);
+      }
+
+      writer.endObject();
+    }
+
+    // Moves the entity's strings to the arena and trims its vectors.
+    // See packConfiguration() which also packs the strings of the device.
+    void pack(ConfigArena & arena) {
+      updateDiscoveryCache();
+      name.pack(arena);
+      unique_id.pack(arena);
+      object_id.pack(arena);
+      command_topic.pack(arena);
+      state_topic.pack(arena);
+      discovery_topic.pack(arena);
+      for(size_t i=0; i<more_string_values.size(); i++) {
+        more_string_values[i].key.pack(arena);
+        more_string_values[i].value.pack(arena);
       }
+      for(size_t i=0; i<more_static_cstr_entries.size(); i++)
+        more_static_cstr_entries[i].key.pack(arena);
+      for(size_t i=0; i<more_array_serializers.size(); i++)
+        more_array_serializers[i].key.pack(arena);
+      if (arena.isAllocated()) {
+        more_string_values.shrink_to_fit();
+        more_static_cstr_entries.shrink_to_fit();
+        more_array_serializers.shrink_to_fit();
+      }
+    }
+
+    size_t getDiscoveryPayloadLength() const {
+      updateDiscoveryCache();
+      return discovery_payload_length;
+    }
+
+    uint32_t getDiscoveryPayloadHash() const {
+      updateDiscoveryCache();
+      return discovery_payload_hash;
+    }
+
+    // The discovery topic, payload length and payload hash are cached.
+    // The cache is invalidated by the entity's setters and when the device's revision changes.
+    // Call this function if the content of a static cstr array or of a serialized array was modified.
+    void invalidateDiscoveryCache() {
+      discovery_cache_valid = false;
+    }
+
+    // Returns true if the current discovery payload was already published successfully.
+    bool isDiscoveryPublished() const {
+      return discovery_published && published_discovery_hash == getDiscoveryPayloadHash();
+    }
+
+    // Forget about the last published discovery payload.
+    // The next call to publishMqttDiscoveryIfChanged() will publish again.
+    void clearDiscoveryPublished() {
+      discovery_published = false;
+    }
+
+    void getDiscoveryPayload(String & payload) const {
+      payload.clear();
+      payload.reserve(getDiscoveryPayloadLength());
 
-      serializeJson(doc, payload);
+      JsonWriter writer(&payload);
+      serializeDiscoveryPayload(writer);
+      writer.flush();
     }
 
     bool publishMqttDiscovery() {
       if (mqtt_adaptor == NULL) return false;
       if (!mqtt_adaptor->connected()) return false;
 
-      String topic;
-      String payload;
-      getDiscoveryTopic(topic);
-      getDiscoveryPayload(payload);
+      const ConfigString & topic = getDiscoveryTopic();
+      size_t length = getDiscoveryPayloadLength();
 
-      if (topic.isEmpty() || payload.isEmpty())
+      if (topic.isEmpty() || length == 0)
         return false;
 
+      // Stream the payload directly to the MQTT client.
+      // No intermediate document or String is required.
       static const bool retained = true;
-      bool result = mqtt_adaptor->publish(topic.c_str(), payload.c_str(), retained);
+      bool result = mqtt_adaptor->beginPublish(topic.c_str(), length, retained);
+      if (result) {
+        JsonWriter writer(mqtt_adaptor);
+        serializeDiscoveryPayload(writer);
+        writer.flush();
+        result = (!writer.hasError() && writer.length() == length);
+        result = mqtt_adaptor->endPublish() && result;
+      }
+
+      if (result) {
+        published_discovery_hash = discovery_payload_hash;
+        discovery_published = true;
+      }
 
 #     ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
       if (result) {
         HA_MQTT_DISCOVERY_PRINT_FUNC("MQTT publish: topic=");
-        HA_MQTT_DISCOVERY_PRINT_FUNC(topic);
-        HA_MQTT_DISCOVERY_PRINT_FUNC("   payload=");
-        HA_MQTT_DISCOVERY_PRINT_FUNC(payload);
+        HA_MQTT_DISCOVERY_PRINT_FUNC(topic.c_str());
+        HA_MQTT_DISCOVERY_PRINT_FUNC("   (streamed payload) size=");
+        HA_MQTT_DISCOVERY_PRINT_FUNC(length);
         HA_MQTT_DISCOVERY_PRINT_FUNC("\n");     
       } else {
         HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MQTT publish failure: topic=");
-        HA_MQTT_DISCOVERY_PRINT_FUNC(topic);
+        HA_MQTT_DISCOVERY_PRINT_FUNC(topic.c_str());
         HA_MQTT_DISCOVERY_PRINT_FUNC("\n");     
       }
 #     endif
@@ -336,7 +516,16 @@ class HaMqttEntity {
       return result;
     }
 
+    // Publish the discovery payload only if it differs from the last one published.
+    // Discovery configs are retained by the broker, there is no need to send them again on every reconnect.
+    bool publishMqttDiscoveryIfChanged() {
+      if (isDiscoveryPublished())
+        return true; // nothing to do
+      return publishMqttDiscovery();
+    }
+
     bool publishMqttState(bool retained = false) {
+      retained = (retained || state_retained);
       if (mqtt_adaptor == NULL) return false;
       if (!mqtt_adaptor->connected()) return false;
 
@@ -349,10 +538,10 @@ class HaMqttEntity {
 
       bool result = false;
       bool is_binary_payload =  state.isBinary();
-      bool is_string_payload = !is_string_payload;
+      bool is_string_payload = !is_binary_payload;
 
       if (is_string_payload) {
-        const char * payload = state.getStringValue().c_str();
+        const char * payload = state.getStringValue();
         result = mqtt_adaptor->publish(topic, payload, retained);
 
 #       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
@@ -370,7 +559,7 @@ class HaMqttEntity {
 #       endif
       } else {
         // binary payload
-        const MqttState::Buffer & bin_payload = state.getBinaryValue();
+        const MqttState::Buffer bin_payload = state.getBinaryValue();
         result = mqtt_adaptor->publish(topic, bin_payload.buffer, bin_payload.size, retained);
 
 #       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
@@ -389,7 +578,38 @@ class HaMqttEntity {
       }
 
       if (result)
-        state.clear();
+        state.setPublished();
+
+      return result;
+    }
+
+    // Publishes a past value of the state, see MqttEventQueue.
+    // The state is published too if it has the same value.
+    bool publishMqttEvent(const uint8_t * value, size_t length) {
+      if (mqtt_adaptor == NULL) return false;
+      if (!mqtt_adaptor->connected()) return false;
+
+      if (state_topic.isEmpty()) return true; // nothing configured
+
+      const char * topic = state_topic.c_str();
+      bool result = mqtt_adaptor->publish(topic, value, length, state_retained);
+
+#     ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+      if (result) {
+        HA_MQTT_DISCOVERY_PRINT_FUNC("MQTT publish: topic=");
+        HA_MQTT_DISCOVERY_PRINT_FUNC(topic);
+        HA_MQTT_DISCOVERY_PRINT_FUNC("   (event) size=");
+        HA_MQTT_DISCOVERY_PRINT_FUNC(length);
+        HA_MQTT_DISCOVERY_PRINT_FUNC("\n");     
+      } else {
+        HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MQTT publish failure: topic=");
+        HA_MQTT_DISCOVERY_PRINT_FUNC(topic);
+        HA_MQTT_DISCOVERY_PRINT_FUNC("\n");     
+      }
+#     endif
+
+      if (result && fnv1a(value, length) == state.getValueHash())
+        state.setPublished();
 
       return result;
     }
@@ -419,33 +639,130 @@ class HaMqttEntity {
     }
 
   private:
+    template<size_t COUNT> friend class HaMqttEntityTable; // configures the members directly
+
+    void buildDiscoveryTopic(ConfigString & topic) const {
+      if (!unique_id.isEmpty()) {
+        topic = ha_discovery_prefix + "/" + toString(type) + "/" + unique_id.c_str() + "/config";
+      } else {
+        const ConfigString * device_identifier = NULL;
+        if (device) {
+          device_identifier = device->getIdentifier(0);
+        }
+        if (device_identifier)
+          topic = ha_discovery_prefix + "/" + toString(type) + "/" + device_identifier->c_str() + "_" + unique_id.c_str() + "/config";
+        else
+          topic = ha_discovery_prefix + "/" + toString(type) + "/" + unique_id.c_str() + "/config";
+      }
+    }
+
+    static bool hasBaseTopic(const ConfigString & topic, const char * base_topic) {
+      size_t base_length = strlen(base_topic);
+      if (base_length == 0 || topic.length() <= base_length)
+        return false;
+      return (strncmp(topic.c_str(), base_topic, base_length) == 0 && topic.c_str()[base_length] == '/');
+    }
+
+    static void serializeTopic(JsonWriter & writer, const char * key, const ConfigString & topic, const char * base_topic) {
+      writer.key(key);
+      if (base_topic && hasBaseTopic(topic, base_topic))
+        writer.value("~", topic.c_str() + strlen(base_topic));
+      else
+        writer.value(topic.c_str());
+    }
+
+    void addToDevice() {
+      size_t index = device->addEntity(this);
+      if (index < HaMqttDevice::MAX_DIRTY_TRACKED_ENTITIES) {
+        state.setDirtySet(device->getDirtyEntitiesSet(), 1UL << index);
+      } else {
+#       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+        HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "Entity '" + name.c_str() + "' is not tracked in the device's dirty set.\n");
+#       endif
+      }
+    }
+
+    void updateDiscoveryCache() const {
+      uint32_t device_revision = (device ? device->getRevision() : 0);
+      if (discovery_cache_valid && discovery_device_revision == device_revision)
+        return;
+
+      buildDiscoveryTopic(discovery_topic);
+
+      JsonWriter counter;
+      serializeDiscoveryPayload(counter);
+      discovery_payload_length = counter.length();
+      discovery_payload_hash = counter.hash();
+
+      discovery_device_revision = device_revision;
+      discovery_cache_valid = true;
+    }
+
     MqttAdaptor * mqtt_adaptor;
     HaMqttDevice * device;
+    CommandHandler command_handler;
     MqttState state;
+    bool state_retained;
 
     HA_MQTT_INTEGRATION_TYPE type;
-    String name;
-    String unique_id;
-    String object_id;
-    String command_topic;
-    String state_topic;
+    ConfigString name;
+    ConfigString unique_id;
+    ConfigString object_id;
+    ConfigString command_topic;
+    ConfigString state_topic;
 
     struct KEY_VALUE_PAIR {
-      String key;
-      String value;
+      ConfigString key;
+      ConfigString value;
     };
     typedef std::vector<KEY_VALUE_PAIR> KeyValuePairVector;
     KeyValuePairVector more_string_values;
 
     struct STATIC_CSTR_ARRAY_ENTRY {
-      String key;
+      ConfigString key;
       STATIC_CSTR_ARRAY the_array;
     };
     typedef std::vector<STATIC_CSTR_ARRAY_ENTRY> StaticCStrArrayVector;
     StaticCStrArrayVector more_static_cstr_entries;
+
+    struct ARRAY_SERIALIZER_ENTRY {
+      ConfigString key;
+      ArraySerializer serializer;
+    };
+    typedef std::vector<ARRAY_SERIALIZER_ENTRY> ArraySerializerVector;
+    ArraySerializerVector more_array_serializers;
+
+    // Discovery cache
+    mutable bool discovery_cache_valid;
+    mutable uint32_t discovery_device_revision;
+    mutable ConfigString discovery_topic;
+    mutable size_t discovery_payload_length;
+    mutable uint32_t discovery_payload_hash;
+    bool discovery_published;
+    uint32_t published_discovery_hash;
     
 };
 
+// Moves the configuration strings of a device and of all its entities to a single heap block.
+// Call once the device and its entities are configured. The arena must outlive them.
+// The first pass measures the required size and allocates the arena, the second one copies the strings.
+// Setters still work after packing, the new value is allocated on the heap.
+inline bool packConfiguration(HaMqttDevice & device, ConfigArena & arena) {
+  const HaMqttDevice::EntityPtrVector & entities = device.getEntities();
+  if (!arena.isAllocated()) {
+    device.pack(arena);
+    for(size_t i=0; i<entities.size(); i++)
+      entities[i]->pack(arena);
+    if (!arena.allocate(arena.getUsed()))
+      return false;
+  }
+
+  device.pack(arena);
+  for(size_t i=0; i<entities.size(); i++)
+    entities[i]->pack(arena);
+  return true;
+}
+
 }; // namespace HaMqttDiscovery
 
 #endif // HA_MQTT_DISCOVERY_ENTITY
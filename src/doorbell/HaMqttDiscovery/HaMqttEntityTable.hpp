@@ -0,0 +1,212 @@
+#ifndef HA_MQTT_DISCOVERY_ENTITY_TABLE
+#define HA_MQTT_DISCOVERY_ENTITY_TABLE
+
+#include "HaMqttDiscovery.hpp"
+#include "HaMqttDevice.hpp"
+#include "HaMqttEntity.hpp"
+
+namespace HaMqttDiscovery {
+
+// Appends a key and its value to the key_values of an entity definition:
+//   HA_MQTT_KEY_VALUE("device_class", "duration") HA_MQTT_KEY_VALUE("unit_of_measurement", "ms")
+// A value starting with '~' is a topic: the '~' is replaced by the device identifier,
+// like Home Assistant's base topic abbreviation.
+#define HA_MQTT_KEY_VALUE(key, value) key "\0" value "\0"
+
+// Static description of an entity.
+// Topics are appended to the device identifier, use "" if the entity does not have such a topic.
+struct HA_MQTT_ENTITY_DEFINITION {
+  HA_MQTT_INTEGRATION_TYPE type;
+  const char * name;
+  const char * command_topic;
+  const char * state_topic;
+  const char * key_values; // HA_MQTT_KEY_VALUE() pairs, or ""
+};
+
+// Configures the entities of a device from a table of definitions known at compile time.
+// The type index of each entity, used in its unique_id, is computed by the compiler with buildTable()
+// and isValid() / hasUniqueTopics() are meant for static_assert. At boot, configure() only appends
+// the definitions to the device identifier. Names and keys are not copied, they stay in the definitions.
+template<size_t COUNT>
+class HaMqttEntityTable {
+  public:
+    static const size_t MAX_TYPE_INDEX = 0xFF;
+
+    struct TABLE {
+      uint8_t type_indices[COUNT]; // index of each entity among the entities of the same type
+    };
+
+    // Returns true if all entities have a unique name.
+    static constexpr bool isValid(const HA_MQTT_ENTITY_DEFINITION (&definitions)[COUNT]) {
+      for(size_t i=0; i<COUNT; i++) {
+        const HA_MQTT_ENTITY_DEFINITION & definition = definitions[i];
+        if (definition.name == NULL || definition.name[0] == '\0')
+          return false;
+        if (definition.command_topic == NULL || definition.state_topic == NULL || definition.key_values == NULL)
+          return false;
+        for(size_t j=0; j<i; j++) {
+          if (isSameString(definition.name, definitions[j].name))
+            return false;
+        }
+      }
+      return (COUNT <= MAX_TYPE_INDEX);
+    }
+
+    // Returns true if no two entities share a topic.
+    // An entity may use the same topic for its commands and its state.
+    static constexpr bool hasUniqueTopics(const HA_MQTT_ENTITY_DEFINITION (&definitions)[COUNT]) {
+      for(size_t i=0; i<COUNT; i++) {
+        for(size_t a=0; getTopic(definitions[i], a) != NULL; a++) {
+          const char * topic = getTopic(definitions[i], a);
+          for(size_t j=0; j<i; j++) {
+            for(size_t b=0; getTopic(definitions[j], b) != NULL; b++) {
+              const char * other = getTopic(definitions[j], b);
+              if (topic[0] != '\0' && isSameString(topic, other))
+                return false;
+            }
+          }
+        }
+      }
+      return true;
+    }
+
+    static constexpr TABLE buildTable(const HA_MQTT_ENTITY_DEFINITION (&definitions)[COUNT]) {
+      TABLE table = {};
+      for(size_t i=0; i<COUNT; i++) {
+        size_t index = 0;
+        for(size_t j=0; j<i; j++) {
+          if (definitions[j].type == definitions[i].type)
+            index++;
+        }
+        table.type_indices[i] = (uint8_t)index;
+      }
+      return table;
+    }
+
+    // The table must be stored in flash.
+    HaMqttEntityTable(const HA_MQTT_ENTITY_DEFINITION * definitions, const TABLE * table) {
+      this->definitions = definitions;
+      this->table = table;
+    }
+
+    inline size_t getCount() const { return COUNT; }
+
+    inline const HA_MQTT_ENTITY_DEFINITION & getDefinition(size_t index) const { return definitions[index]; }
+
+    // Configures entities[i] from the definition i and adds it to the device.
+    // The device must have an identifier and no entities yet, the type indices of the table assume
+    // that the device only has these entities, in this order.
+    bool configure(HaMqttDevice & device, HaMqttEntity * (&entities)[COUNT]) const {
+      const ConfigString & identifier = device.getFirstIdentifier();
+      if (identifier.isEmpty() || !device.getEntities().empty()) {
+#       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+        HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "Entity table: the device must have an identifier and no entities.\n");
+#       endif
+        return false;
+      }
+
+      String buffer; // reused for all topics and ids
+      buffer.reserve(identifier.length() + 32);
+
+      for(size_t i=0; i<COUNT; i++) {
+        const HA_MQTT_ENTITY_DEFINITION & definition = definitions[i];
+        HaMqttEntity * entity = entities[i];
+
+        entity->type = definition.type;
+        entity->name = ConfigString::fromStatic(definition.name);
+        concat(entity->command_topic, buffer, identifier, definition.command_topic);
+        concat(entity->state_topic, buffer, identifier, definition.state_topic);
+
+        buffer = identifier.c_str();
+        buffer += '_';
+        buffer += toString(definition.type);
+        buffer += (unsigned int)pgm_read_byte(&table->type_indices[i]);
+        entity->unique_id = buffer;
+
+        buffer = identifier.c_str();
+        buffer += '_';
+        buffer += definition.name;
+        entity->object_id = buffer;
+
+        entity->more_string_values.clear();
+        entity->more_string_values.reserve(countKeyValues(definition.key_values));
+        for(const char * key = definition.key_values; *key != '\0'; ) {
+          const char * value = key + strlen(key) + 1;
+          HaMqttEntity::KEY_VALUE_PAIR pair;
+          pair.key = ConfigString::fromStatic(key);
+          if (value[0] == '~')
+            concat(pair.value, buffer, identifier, value + 1);
+          else
+            pair.value = ConfigString::fromStatic(value);
+          entity->more_string_values.push_back(std::move(pair));
+          key = value + strlen(value) + 1;
+        }
+
+        entity->device = &device;
+        entity->addToDevice();
+        entity->invalidateDiscoveryCache();
+      }
+      return true;
+    }
+
+  private:
+    static constexpr bool isSameString(const char * a, const char * b) {
+      size_t i = 0;
+      while(a[i] != '\0' && a[i] == b[i])
+        i++;
+      return a[i] == b[i];
+    }
+
+    // Returns the n-th topic of an entity: its command topic, its state topic and then
+    // the values of its key_values starting with '~' (without the '~'). Returns NULL after the last one.
+    static constexpr const char * getTopic(const HA_MQTT_ENTITY_DEFINITION & definition, size_t n) {
+      if (n == 0) return definition.command_topic;
+      if (n == 1) return (isSameString(definition.state_topic, definition.command_topic) ? "" : definition.state_topic);
+      n -= 2;
+      const char * key = definition.key_values;
+      while(*key != '\0') {
+        const char * value = key;
+        while(*value != '\0')
+          value++;
+        value++;
+        if (value[0] == '~') {
+          if (n == 0)
+            return value + 1;
+          n--;
+        }
+        key = value;
+        while(*key != '\0')
+          key++;
+        key++;
+      }
+      return NULL;
+    }
+
+    static size_t countKeyValues(const char * key) {
+      size_t count = 0;
+      while(*key != '\0') {
+        key += strlen(key) + 1; // value
+        key += strlen(key) + 1;
+        count++;
+      }
+      return count;
+    }
+
+    // Empty topics stay empty.
+    static void concat(ConfigString & target, String & buffer, const ConfigString & identifier, const char * topic) {
+      if (topic[0] == '\0') {
+        target = "";
+        return;
+      }
+      buffer = identifier.c_str();
+      buffer += topic;
+      target = buffer;
+    }
+
+    const HA_MQTT_ENTITY_DEFINITION * definitions;
+    const TABLE * table;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_ENTITY_TABLE
@@ -0,0 +1,271 @@
+#ifndef HA_MQTT_DISCOVERY_JSON_WRITER
+#define HA_MQTT_DISCOVERY_JSON_WRITER
+
+#include "HaMqttDiscovery.hpp"
+#include "MqttAdaptor.hpp"
+
+namespace HaMqttDiscovery {
+
+// Minimal streaming JSON serializer.
+// The writer does not build any document in memory. Each token is written
+// to the output as soon as it is known:
+//  - with no output, the writer only counts bytes (used to precompute a payload length).
+//  - with a String output, the tokens are appended to the String.
+//  - with a MqttAdaptor output, the tokens are written to an MQTT message opened with beginPublish().
+// Small writes are grouped in a fixed size buffer to limit the number of network writes.
+// A FNV-1a hash of the written bytes is computed in all modes.
+class JsonWriter {
+  public:
+    static const size_t BUFFER_SIZE = 64;
+    static const size_t MAX_DEPTH = 8;
+
+    JsonWriter() {
+      init();
+    }
+
+    JsonWriter(String * output) {
+      init();
+      str_output = output;
+    }
+
+    JsonWriter(MqttAdaptor * output) {
+      init();
+      mqtt_output = output;
+    }
+
+    ~JsonWriter() {
+      flush();
+    }
+
+    size_t length() const {
+      return written;
+    }
+
+    uint32_t hash() const {
+      return fnv_hash;
+    }
+
+    bool hasError() const {
+      return error;
+    }
+
+    void beginObject() {
+      beginValue();
+      writeChar('{');
+      pushLevel();
+    }
+
+    void endObject() {
+      popLevel();
+      writeChar('}');
+    }
+
+    void beginArray() {
+      beginValue();
+      writeChar('[');
+      pushLevel();
+    }
+
+    void endArray() {
+      popLevel();
+      writeChar(']');
+    }
+
+    void key(const char * name) {
+      beginValue();
+      writeString(name);
+      writeChar(':');
+      after_key = true;
+    }
+    inline void key(const String & name) { key(name.c_str()); }
+
+    void value(const char * str) {
+      beginValue();
+      writeString(str);
+    }
+    inline void value(const String & str) { value(str.c_str()); }
+
+    // Writes the concatenation of two strings as a single string value.
+    void value(const char * str1, const char * str2) {
+      beginValue();
+      writeChar('"');
+      writeEscaped(str1);
+      writeEscaped(str2);
+      writeChar('"');
+    }
+
+    // Writes a string value of the given length stored in flash (PROGMEM).
+    void value_P(const char * str, size_t length) {
+      beginValue();
+      writeChar('"');
+      char chunk[32];
+      while(length > 0) {
+        size_t chunk_size = (length < sizeof(chunk) ? length : sizeof(chunk));
+        memcpy_P(chunk, str, chunk_size);
+        writeEscaped(chunk, chunk_size);
+        str += chunk_size;
+        length -= chunk_size;
+      }
+      writeChar('"');
+    }
+
+    // Writes an unsigned integer value.
+    void number(uint32_t value) {
+      beginValue();
+      char digits[10];
+      size_t length = 0;
+      do {
+        digits[sizeof(digits) - 1 - length] = '0' + (value % 10);
+        value /= 10;
+        length++;
+      } while(value > 0);
+      writeRaw(digits + sizeof(digits) - length, length);
+    }
+
+    inline void keyValue(const char * name, const char * str) { key(name); value(str); }
+    inline void keyValue(const char * name, const String & str) { key(name); value(str.c_str()); }
+    inline void keyValue(const String & name, const String & str) { key(name.c_str()); value(str.c_str()); }
+    inline void keyNumber(const char * name, uint32_t value) { key(name); number(value); }
+
+    void flush() {
+      if (buffer_size == 0)
+        return;
+      if (mqtt_output) {
+        if (mqtt_output->write((const uint8_t *)buffer, buffer_size) != buffer_size)
+          error = true;
+      } else if (str_output) {
+        if (!str_output->concat(buffer, buffer_size))
+          error = true;
+      }
+      buffer_size = 0;
+    }
+
+  private:
+    void init() {
+      str_output = NULL;
+      mqtt_output = NULL;
+      written = 0;
+      fnv_hash = FNV_OFFSET_BASIS;
+      buffer_size = 0;
+      depth = 0;
+      first_in_level = 0;
+      after_key = false;
+      error = false;
+    }
+
+    void pushLevel() {
+      if (depth >= MAX_DEPTH) {
+        error = true;
+        return;
+      }
+      depth++;
+      first_in_level |= (1u << depth);
+    }
+
+    void popLevel() {
+      if (depth == 0) {
+        error = true;
+        return;
+      }
+      first_in_level &= ~(1u << depth);
+      depth--;
+    }
+
+    // Writes the separator required before a new key or a new value of the current level.
+    void beginValue() {
+      if (after_key) {
+        after_key = false;
+        return;
+      }
+      uint32_t mask = (1u << depth);
+      if (first_in_level & mask)
+        first_in_level &= ~mask;
+      else if (depth > 0)
+        writeChar(',');
+    }
+
+    void writeString(const char * str) {
+      writeChar('"');
+      writeEscaped(str);
+      writeChar('"');
+    }
+
+    void writeEscaped(const char * str) {
+      writeEscaped(str, strlen(str));
+    }
+
+    void writeEscaped(const char * str, size_t length) {
+      const char * run = str; // start of the characters that do not need escaping
+      const char * c = str;
+      const char * end = str + length;
+      for(; c != end; c++) {
+        char escaped = 0;
+        switch(*c) {
+          case '"':  escaped = '"';  break;
+          case '\\': escaped = '\\'; break;
+          case '\b': escaped = 'b';  break;
+          case '\f': escaped = 'f';  break;
+          case '\n': escaped = 'n';  break;
+          case '\r': escaped = 'r';  break;
+          case '\t': escaped = 't';  break;
+        };
+        if (!escaped && (uint8_t)*c >= 0x20)
+          continue;
+
+        writeRaw(run, c - run);
+        run = c + 1;
+        if (escaped) {
+          writeChar('\\');
+          writeChar(escaped);
+        } else {
+          static const char hex[] = "0123456789abcdef";
+          char unicode[] = { '\\', 'u', '0', '0', hex[((uint8_t)*c) >> 4], hex[((uint8_t)*c) & 0x0F] };
+          writeRaw(unicode, sizeof(unicode));
+        }
+      }
+      writeRaw(run, c - run);
+    }
+
+    void writeRaw(const char * str, size_t length) {
+      written += length;
+      fnv_hash = fnv1a((const uint8_t *)str, length, fnv_hash);
+      if (!mqtt_output && !str_output)
+        return; // count only
+      while(length > 0) {
+        size_t chunk = BUFFER_SIZE - buffer_size;
+        if (chunk > length)
+          chunk = length;
+        memcpy(buffer + buffer_size, str, chunk);
+        buffer_size += chunk;
+        str += chunk;
+        length -= chunk;
+        if (buffer_size == BUFFER_SIZE)
+          flush();
+      }
+    }
+
+    inline void writeChar(char c) {
+      written++;
+      fnv_hash = (fnv_hash ^ (uint8_t)c) * FNV_PRIME;
+      if (!mqtt_output && !str_output)
+        return; // count only
+      buffer[buffer_size++] = c;
+      if (buffer_size == BUFFER_SIZE)
+        flush();
+    }
+
+    String * str_output;
+    MqttAdaptor * mqtt_output;
+    size_t written;
+    uint32_t fnv_hash;
+    char buffer[BUFFER_SIZE];
+    size_t buffer_size;
+    size_t depth;
+    uint32_t first_in_level; // one bit per nesting level, set until the level's first element is written
+    bool after_key;
+    bool error;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_JSON_WRITER
@@ -10,15 +10,31 @@ class MqttAdaptor {
     MqttAdaptor() {}
     virtual ~MqttAdaptor() {}
 
-    virtual bool connected();
-
-    virtual bool publish(const char* topic, const char* payload);
-    virtual bool publish(const char* topic, const char* payload, bool retained);
-    virtual bool publish(const char* topic, const uint8_t* payload, size_t length);
-    virtual bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained);
-
-    virtual bool subscribe(const char* topic);
-    virtual bool unsubscribe(const char* topic);
+    virtual bool connected() = 0;
+
+    // Returns true while an asynchronous connection attempt is in progress.
+    virtual bool connecting() { return false; }
+
+    virtual bool publish(const char* topic, const char* payload) = 0;
+    virtual bool publish(const char* topic, const char* payload, bool retained) = 0;
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length) = 0;
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained) = 0;
+
+    // Streamed publishing: the payload is written in chunks after the message header.
+    // The total payload length must be known when calling beginPublish().
+    virtual bool beginPublish(const char* topic, size_t length, bool retained) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+    virtual bool endPublish() = 0;
+
+    virtual bool subscribe(const char* topic) = 0;
+    virtual bool unsubscribe(const char* topic) = 0;
+
+    // Batched publishing: publications made between beginBatch() and flush() may be sent
+    // to the network with a single write. Returns false if the adaptor does not batch,
+    // publications are then sent immediately. A publication accepted in a batch is only
+    // sent by flush(), which returns false if the batch could not be written.
+    virtual bool beginBatch() { return false; }
+    virtual bool flush() { return true; }
 
 };
 
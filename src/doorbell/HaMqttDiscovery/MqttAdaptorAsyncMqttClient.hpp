@@ -0,0 +1,231 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_ADAPTOR_ASYNCMQTTCLIENT
+#define HA_MQTT_DISCOVERY_MQTT_ADAPTOR_ASYNCMQTTCLIENT
+
+#include <vector>
+
+#include "HaMqttDiscovery.hpp"
+#include "MqttAdaptor.hpp"
+#include "MqttLastWillAndTestament.hpp"
+#include <AsyncMqttClient.h> // https://github.com/marvinroger/async-mqtt-client (requires ESPAsyncTCP)
+
+namespace HaMqttDiscovery {
+
+// Event-driven adaptor: AsyncMqttClient runs on top of ESPAsyncTCP and never blocks loop().
+// A publication is copied to the TCP send buffer and publish() returns immediately, false if
+// the buffer is full or the client is not connected. Acknowledged publications (QoS 1) are
+// reported to the publish handler. Incoming messages are delivered to the message handler
+// from the TCP callbacks, there is nothing to poll. Messages received in several chunks are
+// reassembled first, up to the maximum message size.
+// On ESP8266, the callbacks run between two calls to loop(), never in the middle of one.
+// Streamed publications are assembled in a buffer reused by all publications.
+class MqttAdaptorAsyncMqttClient : public virtual MqttAdaptor {
+  public:
+    typedef void (*MessageHandler)(const char* topic, const uint8_t* payload, unsigned int length);
+    typedef void (*PublishHandler)(uint16_t packet_id);
+
+    static const size_t DEFAULT_MAX_MESSAGE_SIZE = 512;
+
+  private:
+    AsyncMqttClient * client;
+    MessageHandler message_handler;
+    PublishHandler publish_handler;
+    uint8_t qos;
+    bool is_connecting;
+    uint8_t disconnect_reason;
+
+    // Connection parameters, AsyncMqttClient keeps pointers to them
+    String client_id;
+    String user;
+    String password;
+    MqttLastWillAndTestament lwt;
+
+    // Streamed publication
+    String stream_topic;
+    std::vector<uint8_t> stream_buffer;
+    size_t stream_length;
+    bool stream_retained;
+    bool streaming;
+
+    // Chunked incoming message
+    std::vector<uint8_t> message_buffer;
+    size_t max_message_size;
+
+  public:
+    MqttAdaptorAsyncMqttClient() {
+      client = NULL;
+      message_handler = NULL;
+      publish_handler = NULL;
+      qos = 0;
+      is_connecting = false;
+      disconnect_reason = 0;
+      stream_length = 0;
+      stream_retained = false;
+      streaming = false;
+      max_message_size = DEFAULT_MAX_MESSAGE_SIZE;
+    }
+    virtual ~MqttAdaptorAsyncMqttClient() {}
+  private:
+    // Disable copy ctor, the client's callbacks refer to this instance
+    MqttAdaptorAsyncMqttClient(const MqttAdaptorAsyncMqttClient & copy) {}
+  public:
+
+    // Registers the adaptor's callbacks. Must be called once, before connect().
+    void setAsyncMqttClient(AsyncMqttClient * client) {
+      this->client = client;
+      if (client == NULL)
+        return;
+      client->onConnect([this](bool session_present) {
+        is_connecting = false;
+      });
+      client->onDisconnect([this](AsyncMqttClientDisconnectReason reason) {
+        is_connecting = false;
+        disconnect_reason = (uint8_t)reason;
+        message_buffer.clear();
+      });
+      client->onPublish([this](uint16_t packet_id) {
+        if (publish_handler)
+          publish_handler(packet_id);
+      });
+      client->onMessage([this](char* topic, char* payload, AsyncMqttClientMessageProperties properties, size_t length, size_t index, size_t total) {
+        onMessage(topic, (const uint8_t*)payload, length, index, total);
+      });
+    }
+
+    inline void setMessageHandler(MessageHandler handler) { message_handler = handler; }
+    inline void setPublishHandler(PublishHandler handler) { publish_handler = handler; }
+
+    // QoS of publications and subscriptions. With QoS 0, publications are never acknowledged.
+    inline void setQos(uint8_t qos) { this->qos = (qos > 2 ? 2 : qos); }
+    inline uint8_t getQos() const { return qos; }
+
+    // Larger incoming messages are discarded.
+    inline void setMaxMessageSize(size_t size) { max_message_size = size; }
+
+    // Bytes held by the streamed publication and the reassembly buffers. They keep their largest size.
+    inline size_t getBufferSize() const { return stream_buffer.capacity() + message_buffer.capacity(); }
+
+    // AsyncMqttClientDisconnectReason of the last disconnection.
+    inline uint8_t getDisconnectReason() const { return disconnect_reason; }
+
+    // Starts connecting and returns immediately. connecting() is true until the broker
+    // accepts the connection or the attempt fails.
+    bool connect(const char* client_id, const char* user, const char* password, const MqttLastWillAndTestament * lwt) {
+      if (client == NULL) return false;
+      if (client->connected() || is_connecting)
+        return false;
+
+      this->client_id = client_id;
+      this->user = user;
+      this->password = password;
+      client->setClientId(this->client_id.c_str());
+      client->setCredentials(this->user.c_str(), this->password.c_str());
+      if (lwt && lwt->isValid()) {
+        this->lwt = *lwt;
+        client->setWill(this->lwt.topic.c_str(), this->lwt.qos, this->lwt.retain, this->lwt.payload.c_str());
+      }
+
+      is_connecting = true;
+      client->connect();
+      return true;
+    }
+
+    virtual bool connected() {
+      if (client == NULL) return false;
+      return client->connected();
+    }
+
+    virtual bool connecting() {
+      return is_connecting;
+    }
+
+    virtual bool publish(const char* topic, const char* payload) {
+      return publish(topic, (const uint8_t*)payload, strlen(payload), false);
+    }
+
+    virtual bool publish(const char* topic, const char* payload, bool retained) {
+      return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+    }
+
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length) {
+      return publish(topic, payload, length, false);
+    }
+
+    // Returns true once the packet is queued, its packet id is given to the publish handler when
+    // the broker acknowledges it.
+    virtual bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained) {
+      if (client == NULL) return false;
+      return client->publish(topic, qos, retained, (const char*)payload, length) != 0;
+    }
+
+    virtual bool beginPublish(const char* topic, size_t length, bool retained) {
+      if (client == NULL) return false;
+      stream_topic = topic;
+      stream_buffer.clear();
+      stream_buffer.reserve(length);
+      stream_length = length;
+      stream_retained = retained;
+      streaming = true;
+      return true;
+    }
+
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+      if (!streaming || stream_buffer.size() + size > stream_length)
+        return 0;
+      stream_buffer.insert(stream_buffer.end(), buffer, buffer + size);
+      return size;
+    }
+
+    virtual bool endPublish() {
+      if (!streaming)
+        return false;
+      streaming = false;
+      if (stream_buffer.size() != stream_length)
+        return false;
+      return publish(stream_topic.c_str(), stream_buffer.data(), stream_buffer.size(), stream_retained);
+    }
+
+    virtual bool subscribe(const char* topic) {
+      if (client == NULL) return false;
+      return client->subscribe(topic, qos) != 0;
+    }
+
+    virtual bool unsubscribe(const char* topic) {
+      if (client == NULL) return false;
+      return client->unsubscribe(topic) != 0;
+    }
+
+  private:
+    void onMessage(const char* topic, const uint8_t* payload, size_t length, size_t index, size_t total) {
+      if (message_handler == NULL)
+        return;
+
+      // Most messages fit in a single chunk
+      if (index == 0 && length == total) {
+        message_handler(topic, payload, (unsigned int)length);
+        return;
+      }
+
+      if (total > max_message_size) {
+#       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+        if (index == 0)
+          HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MqttAdaptorAsyncMqttClient: message too large on topic '" + topic + "'.\n");
+#       endif
+        return;
+      }
+
+      if (index == 0)
+        message_buffer.resize(total);
+      if (message_buffer.size() != total || index + length > total)
+        return; // the first chunk was missed
+      memcpy(message_buffer.data() + index, payload, length);
+      if (index + length == total) {
+        message_handler(topic, message_buffer.data(), (unsigned int)total);
+        message_buffer.clear();
+      }
+    }
+
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_ADAPTOR_ASYNCMQTTCLIENT
@@ -3,19 +3,36 @@
 
 #include "HaMqttDiscovery.hpp"
 #include "MqttAdaptor.hpp"
+#include "MqttPacketBatch.hpp"
 #include <PubSubClient.h>   // https://www.arduino.cc/reference/en/libraries/pubsubclient/
 
 namespace HaMqttDiscovery {
 
+// Batches are written directly to the network client given to setNetworkClient(),
+// the same one used by the PubSubClient. Packets too large for the batch buffer are
+// published by the PubSubClient after the pending batch is written.
 class MqttAdaptorPubSubClient : public virtual MqttAdaptor {
   private:
     PubSubClient * client;
+    Client * network;
+    MqttPacketBatch batch;
+    bool batching;
+    bool batch_streaming; // the current streamed publication goes to the batch
+    bool batch_failed;
   public:
     MqttAdaptorPubSubClient() {
       client = NULL;
+      network = NULL;
+      batching = false;
+      batch_streaming = false;
+      batch_failed = false;
     }
     MqttAdaptorPubSubClient(PubSubClient * client) {
-      client = NULL;
+      this->client = NULL;
+      network = NULL;
+      batching = false;
+      batch_streaming = false;
+      batch_failed = false;
       setPubSubClient(client);
     }
     virtual ~MqttAdaptorPubSubClient() {}
@@ -24,31 +41,60 @@ class MqttAdaptorPubSubClient : public virtual MqttAdaptor {
       this->client = client;
     }
 
+    // Enables batching. The capacity should not exceed a TCP segment (1460 bytes).
+    bool setBatchCapacity(Client * network, size_t capacity) {
+      this->network = network;
+      return batch.setCapacity(capacity);
+    }
+
     virtual bool connected() {
       if (client == NULL) return false;
       return client->connected();
     }
 
     virtual bool publish(const char* topic, const char* payload) {
-      if (client == NULL) return false;
-      return client->publish(topic, payload);
+      return publish(topic, (const uint8_t*)payload, strlen(payload), false);
     }
 
     virtual bool publish(const char* topic, const char* payload, bool retained) {
-      if (client == NULL) return false;
-      return client->publish(topic, payload, retained);
+      return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
     }
 
     virtual bool publish(const char* topic, const uint8_t* payload, size_t length) {
-      if (client == NULL) return false;
-      return client->publish(topic, payload, length);
+      return publish(topic, payload, length, false);
     }
 
     virtual bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained) {
       if (client == NULL) return false;
+      if (batching && prepareBatch(topic, length))
+        return batch.append(topic, payload, length, retained);
       return client->publish(topic, payload, length, retained);
     }
 
+    virtual bool beginPublish(const char* topic, size_t length, bool retained) {
+      if (client == NULL) return false;
+      batch_streaming = (batching && prepareBatch(topic, length) && batch.beginPacket(topic, length, retained));
+      if (batch_streaming)
+        return true;
+      return client->beginPublish(topic, length, retained);
+    }
+
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+      if (client == NULL) return 0;
+      if (batch_streaming)
+        return batch.write(buffer, size);
+      return client->write(buffer, size);
+    }
+
+    virtual bool endPublish() {
+      if (client == NULL) return false;
+      if (batch_streaming) {
+        batch_streaming = false;
+        return batch.endPacket();
+      }
+      return client->endPublish() == 1;
+    }
+
     virtual bool subscribe(const char* topic) {
       if (client == NULL) return false;
       return client->subscribe(topic);
@@ -59,6 +105,40 @@ class MqttAdaptorPubSubClient : public virtual MqttAdaptor {
       return client->unsubscribe(topic);
     }
 
+    virtual bool beginBatch() {
+      if (client == NULL || network == NULL || batch.getCapacity() == 0) return false;
+      batching = true;
+      return true;
+    }
+
+    virtual bool flush() {
+      bool success = writeBatch();
+      batching = false;
+      success = success && !batch_failed;
+      batch_failed = false;
+      return success;
+    }
+
+  private:
+    // Makes room in the batch for a publication.
+    // Returns false if the publication must be sent by the PubSubClient.
+    bool prepareBatch(const char* topic, size_t length) {
+      size_t packet_size = MqttPacketBatch::getPublishPacketSize(strlen(topic), length);
+      if (!batch.canAppend(packet_size) || packet_size > batch.getCapacity())
+        writeBatch(); // keep the publications in order
+      return (packet_size <= batch.getCapacity());
+    }
+
+    bool writeBatch() {
+      if (batch.isEmpty())
+        return true;
+      bool success = (client->connected() && network->write(batch.getData(), batch.getSize()) == batch.getSize());
+      if (!success)
+        batch_failed = true;
+      batch.clear();
+      return success;
+    }
+
 };
 
 }; // namespace HaMqttDiscovery
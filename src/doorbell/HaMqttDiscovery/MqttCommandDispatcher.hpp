@@ -0,0 +1,125 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_COMMAND_DISPATCHER
+#define HA_MQTT_DISCOVERY_MQTT_COMMAND_DISPATCHER
+
+#include <vector>
+
+#include "HaMqttDiscovery.hpp"
+#include "HaMqttDevice.hpp"
+#include "HaMqttEntity.hpp"
+
+namespace HaMqttDiscovery {
+
+// Resolves the topic of an incoming MQTT message to the entity owning this command topic
+// and calls the entity's command handler.
+// Topics are indexed in an open addressing hash table built when entities are added.
+// Command topics of a device usually share a long prefix (the device identifier). The hash
+// only covers the topic length and its last characters, which is enough to tell them apart.
+// Resolving a topic costs a strlen(), a short hash and, most of the time, a single memcmp().
+// Call build() again if the command topic of a registered entity changes.
+class MqttCommandDispatcher {
+  public:
+    MqttCommandDispatcher() {
+      mask = 0;
+    }
+
+    void clear() {
+      entities.clear();
+      table.clear();
+      mask = 0;
+    }
+
+    bool addEntity(HaMqttEntity * entity) {
+      if (entity == NULL) return false;
+      if (entity->getCommandTopic().isEmpty()) return false;
+      entities.push_back(entity);
+      build();
+      return true;
+    }
+
+    // Register all entities of the device that have a command topic.
+    void addEntities(const HaMqttDevice & device) {
+      const HaMqttDevice::EntityPtrVector & device_entities = device.getEntities();
+      for(size_t i=0; i<device_entities.size(); i++) {
+        HaMqttEntity * entity = device_entities[i];
+        if (!entity->getCommandTopic().isEmpty())
+          entities.push_back(entity);
+      }
+      build();
+    }
+
+    size_t getEntityCount() const {
+      return entities.size();
+    }
+
+    void build() {
+      // Keep the table at most half full to limit probing
+      size_t capacity = 4;
+      while(capacity < 2*entities.size())
+        capacity *= 2;
+      mask = capacity - 1;
+
+      SLOT empty_slot = {0, 0, NULL};
+      table.assign(capacity, empty_slot);
+
+      for(size_t i=0; i<entities.size(); i++) {
+        HaMqttEntity * entity = entities[i];
+        const ConfigString & topic = entity->getCommandTopic();
+        uint32_t hash = topicHash(topic.c_str(), topic.length());
+        size_t index = hash & mask;
+        while(table[index].entity != NULL)
+          index = (index + 1) & mask;
+        table[index].hash = hash;
+        table[index].length = topic.length();
+        table[index].entity = entity;
+      }
+    }
+
+    HaMqttEntity * findEntity(const char * topic) const {
+      if (table.empty() || topic == NULL)
+        return NULL;
+
+      size_t length = strlen(topic);
+      uint32_t hash = topicHash(topic, length);
+      size_t index = hash & mask;
+      while(table[index].entity != NULL) {
+        const SLOT & slot = table[index];
+        if (slot.hash == hash && slot.length == length && memcmp(slot.entity->getCommandTopic().c_str(), topic, length) == 0)
+          return slot.entity;
+        index = (index + 1) & mask;
+      }
+      return NULL;
+    }
+
+    // Returns true if the topic belongs to an entity with a command handler.
+    bool dispatch(const char * topic, const uint8_t * payload, size_t length) const {
+      HaMqttEntity * entity = findEntity(topic);
+      if (entity == NULL)
+        return false;
+      return entity->handleCommand(payload, length);
+    }
+
+  private:
+    static const size_t HASHED_SUFFIX_LENGTH = 8;
+
+    static uint32_t topicHash(const char * topic, size_t length) {
+      size_t suffix_length = (length < HASHED_SUFFIX_LENGTH ? length : HASHED_SUFFIX_LENGTH);
+      uint32_t hash = (FNV_OFFSET_BASIS ^ (uint32_t)length) * FNV_PRIME;
+      return fnv1a((const uint8_t *)topic + length - suffix_length, suffix_length, hash);
+    }
+
+    struct SLOT {
+      uint32_t hash;
+      size_t length;
+      HaMqttEntity * entity;
+    };
+    typedef std::vector<SLOT> SlotVector;
+    typedef std::vector<HaMqttEntity*> EntityPtrVector;
+
+    EntityPtrVector entities;
+    SlotVector table;
+    size_t mask;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_COMMAND_DISPATCHER
@@ -0,0 +1,208 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_EVENT_QUEUE
+#define HA_MQTT_DISCOVERY_MQTT_EVENT_QUEUE
+
+#include <vector>
+
+#include "HaMqttDiscovery.hpp"
+#include "HaMqttEntity.hpp"
+
+namespace HaMqttDiscovery {
+
+// A state change of an entity, published as is on the entity's state topic.
+struct MQTT_EVENT {
+  static const size_t MAX_VALUE_SIZE = 15;
+
+  uint32_t time;          // millis() when the event was queued
+  HaMqttEntity * entity;
+  uint8_t length;
+  char value[MAX_VALUE_SIZE + 1];
+};
+
+// Secondary storage for the events which do not fit in a MqttEventQueue.
+// Events are appended by write() and read back in the same order.
+// Entities are referenced by address, a store must be cleared at boot.
+class MqttEventStore {
+  public:
+    MqttEventStore() {}
+    virtual ~MqttEventStore() {}
+
+    virtual bool write(const MQTT_EVENT & event) = 0;
+    virtual bool peek(MQTT_EVENT & event) = 0;   // oldest event
+    virtual bool pop() = 0;                      // removes the oldest event
+    virtual size_t getCount() = 0;
+    virtual void clear() = 0;
+};
+
+// Bounded queue of the state changes that must all reach the broker, in order.
+// An entity's MqttState only holds its latest value: a quick ON then OFF while the connection
+// is down is published as OFF only and Home Assistant never sees the ring. Events queued here
+// are published one at a time by publishNext(), oldest first, and stay in the queue until the
+// broker accepts them, so they are replayed after a reconnection.
+// When the queue is full, OVERFLOW_DROP_OLDEST makes room for the new event and OVERFLOW_DROP_NEWEST
+// rejects it. With a MqttEventStore, the oldest event is moved to the store instead of being dropped.
+// Events older than the maximum age, if any, are dropped instead of being published.
+class MqttEventQueue {
+  public:
+    enum OVERFLOW_POLICY {
+      OVERFLOW_DROP_OLDEST,
+      OVERFLOW_DROP_NEWEST,
+    };
+
+    struct STATS {
+      uint32_t queued;
+      uint32_t published;
+      uint32_t dropped;   // overflows, values too long and events of an unreadable store
+      uint32_t expired;   // older than the maximum age when they were about to be published
+      uint32_t spilled;   // moved to the store
+      uint32_t failures;  // failed publications, the event was kept
+    };
+
+    MqttEventQueue(size_t capacity, OVERFLOW_POLICY policy = OVERFLOW_DROP_OLDEST) {
+      events.resize(capacity == 0 ? 1 : capacity);
+      this->policy = policy;
+      head = 0;
+      count = 0;
+      max_age = 0;
+      store = NULL;
+      resetStats();
+    }
+  private:
+    // Disable copy ctor
+    MqttEventQueue(const MqttEventQueue & copy) {}
+  public:
+
+    inline void setOverflowPolicy(OVERFLOW_POLICY policy) { this->policy = policy; }
+    inline OVERFLOW_POLICY getOverflowPolicy() const { return policy; }
+
+    // Events older than max_age milliseconds are not published. 0 for no limit.
+    inline void setMaxAge(uint32_t max_age) { this->max_age = max_age; }
+
+    inline void setStore(MqttEventStore * store) { this->store = store; }
+
+    inline const STATS & getStats() const { return stats; }
+    void resetStats() {
+      memset(&stats, 0, sizeof(stats));
+    }
+
+    inline size_t getCapacity() const { return events.size(); }
+
+    // Number of events in RAM and in the store.
+    size_t getCount() const {
+      return count + (store ? store->getCount() : 0);
+    }
+
+    inline bool isEmpty() const { return getCount() == 0; }
+
+    void clear() {
+      head = 0;
+      count = 0;
+      if (store)
+        store->clear();
+    }
+
+    // Returns false if the event was rejected. With OVERFLOW_DROP_OLDEST, the event is always queued
+    // but the oldest one may have been dropped. See getStats().
+    bool push(HaMqttEntity * entity, const char * value, uint32_t time) {
+      size_t length = (value ? strlen(value) : 0);
+      if (entity == NULL || length > MQTT_EVENT::MAX_VALUE_SIZE) {
+        stats.dropped++;
+#       ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+        HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MqttEventQueue: invalid event.\n");
+#       endif
+        return false;
+      }
+
+      if (count == events.size()) {
+        // Make room for the new event
+        if (store && store->write(events[head])) {
+          stats.spilled++;
+        } else if (policy == OVERFLOW_DROP_NEWEST) {
+          stats.dropped++;
+          return false;
+        } else {
+          stats.dropped++;
+        }
+        head = (head + 1) % events.size();
+        count--;
+      }
+
+      MQTT_EVENT & event = events[(head + count) % events.size()];
+      event.time = time;
+      event.entity = entity;
+      event.length = (uint8_t)length;
+      memcpy(event.value, value, length);
+      event.value[length] = '\0';
+      count++;
+      stats.queued++;
+      return true;
+    }
+
+    // Returns the oldest event without removing it.
+    bool peek(MQTT_EVENT & event) const {
+      if (store && store->getCount() > 0)
+        return store->peek(event);
+      if (count == 0)
+        return false;
+      event = events[head];
+      return true;
+    }
+
+    // Publishes the oldest event which is not expired.
+    // Returns false if the publication failed, the event stays in the queue.
+    // Returns true if an event was published or if the queue is empty.
+    // A store whose events can not be read back is cleared and counted as a failure, its events are lost.
+    bool publishNext(uint32_t now) {
+      MQTT_EVENT event;
+      while(!isEmpty()) {
+        if (!peek(event)) {
+          stats.failures++;
+          stats.dropped += (uint32_t)store->getCount();
+          store->clear();
+#         ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+          HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MqttEventQueue: failed reading the store, its events are dropped.\n");
+#         endif
+          return false;
+        }
+        if (max_age != 0 && now - event.time > max_age) {
+          stats.expired++;
+          pop();
+          continue;
+        }
+
+        if (!event.entity->publishMqttEvent((const uint8_t *)event.value, event.length)) {
+          stats.failures++;
+          return false;
+        }
+        stats.published++;
+        pop();
+        return true;
+      }
+      return true;
+    }
+
+  private:
+    void pop() {
+      if (store && store->getCount() > 0) {
+        store->pop();
+        return;
+      }
+      if (count == 0)
+        return;
+      head = (head + 1) % events.size();
+      count--;
+    }
+
+    typedef std::vector<MQTT_EVENT> EventVector;
+
+    EventVector events; // ring buffer, allocated once
+    size_t head;        // index of the oldest event in RAM
+    size_t count;
+    OVERFLOW_POLICY policy;
+    uint32_t max_age;
+    MqttEventStore * store;
+    STATS stats;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_EVENT_QUEUE
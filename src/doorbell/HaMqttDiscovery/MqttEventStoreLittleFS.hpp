@@ -0,0 +1,83 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_EVENT_STORE_LITTLEFS
+#define HA_MQTT_DISCOVERY_MQTT_EVENT_STORE_LITTLEFS
+
+#include <LittleFS.h>
+
+#include "HaMqttDiscovery.hpp"
+#include "MqttEventQueue.hpp"
+
+namespace HaMqttDiscovery {
+
+// Stores the overflow of a MqttEventQueue in a LittleFS file.
+// Events are appended to the file and read back from a read offset kept in RAM.
+// The file is removed when it is emptied, so flash is only written while the queue overflows.
+// LittleFS must be mounted before begin() is called.
+class MqttEventStoreLittleFS : public virtual MqttEventStore {
+  public:
+    MqttEventStoreLittleFS(const char * path, size_t max_count) {
+      this->path = path;
+      this->max_count = max_count;
+      read_offset = 0;
+      count = 0;
+    }
+    virtual ~MqttEventStoreLittleFS() {}
+
+    // Removes the events of a previous boot, their entity addresses are meaningless now.
+    void begin() {
+      clear();
+    }
+
+    virtual bool write(const MQTT_EVENT & event) {
+      if (count >= max_count)
+        return false;
+      File file = LittleFS.open(path, "a");
+      if (!file)
+        return false;
+      bool success = (file.write((const uint8_t *)&event, sizeof(event)) == sizeof(event));
+      file.close();
+      if (success)
+        count++;
+      return success;
+    }
+
+    virtual bool peek(MQTT_EVENT & event) {
+      if (count == 0)
+        return false;
+      File file = LittleFS.open(path, "r");
+      if (!file)
+        return false;
+      bool success = (file.seek(read_offset) && file.read((uint8_t *)&event, sizeof(event)) == sizeof(event));
+      file.close();
+      return success;
+    }
+
+    virtual bool pop() {
+      if (count == 0)
+        return false;
+      count--;
+      read_offset += sizeof(MQTT_EVENT);
+      if (count == 0)
+        clear();
+      return true;
+    }
+
+    virtual size_t getCount() {
+      return count;
+    }
+
+    virtual void clear() {
+      LittleFS.remove(path);
+      read_offset = 0;
+      count = 0;
+    }
+
+  private:
+    const char * path;
+    size_t max_count;
+    size_t read_offset;
+    size_t count;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_EVENT_STORE_LITTLEFS
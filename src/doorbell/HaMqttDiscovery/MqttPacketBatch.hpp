@@ -0,0 +1,148 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_PACKET_BATCH
+#define HA_MQTT_DISCOVERY_MQTT_PACKET_BATCH
+
+#include "HaMqttDiscovery.hpp"
+
+namespace HaMqttDiscovery {
+
+// Encodes MQTT 3.1.1 PUBLISH packets (QoS 0) back to back in a fixed size buffer,
+// so that an adaptor can send several publications with a single write to the network.
+// The buffer is allocated once by setCapacity(). A packet is either appended completely or not at all.
+class MqttPacketBatch {
+  public:
+    static const size_t MAX_HEADER_SIZE = 7; // fixed header, up to 4 bytes of remaining length and the topic length
+
+    MqttPacketBatch() {
+      buffer = NULL;
+      capacity = 0;
+      size = 0;
+      packet_count = 0;
+      packet_start = 0;
+      stream_remaining = 0;
+      streaming = false;
+    }
+    ~MqttPacketBatch() {
+      if (buffer)
+        free(buffer);
+    }
+  private:
+    // Disable copy ctor
+    MqttPacketBatch(const MqttPacketBatch & copy) {}
+  public:
+
+    bool setCapacity(size_t capacity) {
+      if (buffer)
+        free(buffer);
+      buffer = NULL;
+      this->capacity = 0;
+      clear();
+      if (capacity == 0)
+        return true;
+      buffer = (uint8_t *)malloc(capacity);
+      if (buffer == NULL)
+        return false;
+      this->capacity = capacity;
+      return true;
+    }
+
+    inline size_t getCapacity() const { return capacity; }
+    inline size_t getSize() const { return size; }
+    inline const uint8_t * getData() const { return buffer; }
+    inline size_t getPacketCount() const { return packet_count; }
+    inline bool isEmpty() const { return size == 0; }
+    inline bool isStreaming() const { return streaming; }
+
+    void clear() {
+      size = 0;
+      packet_count = 0;
+      streaming = false;
+      stream_remaining = 0;
+    }
+
+    // Returns the size of a PUBLISH packet with the given topic and payload lengths.
+    static size_t getPublishPacketSize(size_t topic_length, size_t payload_length) {
+      uint8_t header[MAX_HEADER_SIZE];
+      return encodePublishHeader(header, topic_length, payload_length, false) + topic_length + payload_length;
+    }
+
+    // Writes the fixed header, the remaining length and the topic length of a PUBLISH packet.
+    // The topic and the payload follow. Returns the number of bytes written.
+    static size_t encodePublishHeader(uint8_t * header, size_t topic_length, size_t payload_length, bool retained) {
+      size_t remaining_length = 2 + topic_length + payload_length;
+      size_t offset = 0;
+      header[offset++] = 0x30 | (retained ? 0x01 : 0x00);
+      do {
+        uint8_t digit = remaining_length & 0x7F;
+        remaining_length >>= 7;
+        if (remaining_length > 0)
+          digit |= 0x80;
+        header[offset++] = digit;
+      } while(remaining_length > 0 && offset < 5);
+      header[offset++] = (uint8_t)(topic_length >> 8);
+      header[offset++] = (uint8_t)(topic_length & 0xFF);
+      return offset;
+    }
+
+    inline bool canAppend(size_t packet_size) const {
+      return !streaming && size + packet_size <= capacity;
+    }
+
+    // Returns false if the packet does not fit in the remaining space.
+    bool append(const char * topic, const uint8_t * payload, size_t length, bool retained) {
+      if (!beginPacket(topic, length, retained))
+        return false;
+      write(payload, length);
+      return endPacket();
+    }
+
+    // Streamed packets: the payload is appended by write() calls.
+    bool beginPacket(const char * topic, size_t length, bool retained) {
+      size_t topic_length = strlen(topic);
+      if (!canAppend(getPublishPacketSize(topic_length, length)))
+        return false;
+      packet_start = size;
+      size += encodePublishHeader(buffer + size, topic_length, length, retained);
+      memcpy(buffer + size, topic, topic_length);
+      size += topic_length;
+      stream_remaining = length;
+      streaming = true;
+      return true;
+    }
+
+    size_t write(const uint8_t * data, size_t length) {
+      if (!streaming || length > stream_remaining)
+        return 0;
+      if (length > 0)
+        memcpy(buffer + size, data, length);
+      size += length;
+      stream_remaining -= length;
+      return length;
+    }
+
+    // An incomplete packet is removed from the batch.
+    bool endPacket() {
+      if (!streaming)
+        return false;
+      streaming = false;
+      if (stream_remaining != 0) {
+        size = packet_start;
+        stream_remaining = 0;
+        return false;
+      }
+      packet_count++;
+      return true;
+    }
+
+  private:
+    uint8_t * buffer;
+    size_t capacity;
+    size_t size;
+    size_t packet_count;
+    size_t packet_start;     // offset of the packet being streamed
+    size_t stream_remaining; // payload bytes expected by write()
+    bool streaming;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_PACKET_BATCH
@@ -0,0 +1,278 @@
+#ifndef HA_MQTT_DISCOVERY_MQTT_PUBLISH_SCHEDULER
+#define HA_MQTT_DISCOVERY_MQTT_PUBLISH_SCHEDULER
+
+#include <vector>
+#include <algorithm>
+
+#include "HaMqttDiscovery.hpp"
+#include "HaMqttDevice.hpp"
+#include "HaMqttEntity.hpp"
+#include "MqttEventQueue.hpp"
+
+namespace HaMqttDiscovery {
+
+// Paces the publications of a device without blocking.
+// Publications are queued by priority and published one at a time by process(), which
+// is called from loop(). A token bucket limits the publication rate: one token is added
+// every interval, up to the burst size, and each publication consumes a token.
+// Publications of the same priority are published in the order they were scheduled.
+// Scheduling the state or the discovery of an entity which is already queued only
+// raises its priority, the entity is published once.
+// An event queue is published one event per request, it stays scheduled until it is empty.
+// With a batch adaptor, a token allows a batch of publications sent with a single write.
+class MqttPublishScheduler {
+  public:
+    enum PUBLISH_TYPE {
+      PUBLISH_STATE,
+      PUBLISH_DISCOVERY,
+      PUBLISH_DEVICE_STATUS,
+      PUBLISH_EVENTS,
+    };
+
+    // Lower values are published first
+    static const uint8_t PRIORITY_URGENT = 0;
+    static const uint8_t PRIORITY_STATE = 1;
+    static const uint8_t PRIORITY_DEVICE_STATUS = 2;
+    static const uint8_t PRIORITY_DISCOVERY = 3;
+    static const uint8_t PRIORITY_DIAGNOSTIC = 4; // diagnostic sensors, when nothing else is pending
+
+    struct REQUEST {
+      uint8_t priority;
+      uint8_t type;     // PUBLISH_TYPE
+      bool online;      // for PUBLISH_DEVICE_STATUS
+      uint8_t failures; // number of failed attempts
+      uint32_t sequence;
+      HaMqttEntity * entity;
+      HaMqttDevice * device;
+      MqttEventQueue * events;
+    };
+
+    // Called after each attempt to publish a request.
+    typedef void (*ResultHandler)(const REQUEST & request, bool success);
+
+    MqttPublishScheduler() {
+      interval = 100;
+      burst = 1;
+      max_failures = 5;
+      tokens = 1;
+      last_refill = 0;
+      sequence = 0;
+      result_handler = NULL;
+      batch_adaptor = NULL;
+      batch_size = 1;
+    }
+
+    // Allow one publication every interval milliseconds, with up to burst publications in a row after an idle period.
+    void setRate(uint32_t interval, uint8_t burst) {
+      this->interval = interval;
+      this->burst = (burst == 0 ? 1 : burst);
+      if (tokens > this->burst)
+        tokens = this->burst;
+    }
+
+    // A request is dropped after the given number of failed attempts.
+    inline void setMaxFailures(uint8_t max_failures) { this->max_failures = max_failures; }
+    inline void setResultHandler(ResultHandler handler) { result_handler = handler; }
+
+    // Up to batch_size publications are batched with the given adaptor for each token.
+    // NULL to publish them one at a time.
+    // The batched publications are reported to the result handler once the batch is written
+    // (see MqttAdaptor::flush()). If the write fails they all count as failed attempts and are
+    // retried, the states are dirty again. Event queues are never batched: an event leaves its
+    // queue when it is published and could not be retried.
+    void setBatchAdaptor(MqttAdaptor * adaptor, uint8_t batch_size) {
+      batch_adaptor = adaptor;
+      this->batch_size = (batch_size == 0 ? 1 : batch_size);
+      if (adaptor != NULL)
+        batched.reserve(this->batch_size);
+    }
+
+    void clear() {
+      requests.clear();
+    }
+
+    inline size_t getPendingCount() const { return requests.size(); }
+    inline bool isEmpty() const { return requests.empty(); }
+
+    bool isScheduled(const HaMqttEntity * entity, PUBLISH_TYPE type) const {
+      return findRequest(entity, type) != requests.end();
+    }
+
+    bool scheduleState(HaMqttEntity * entity, uint8_t priority = PRIORITY_STATE) {
+      return scheduleEntity(entity, PUBLISH_STATE, priority);
+    }
+
+    bool scheduleDiscovery(HaMqttEntity * entity, uint8_t priority = PRIORITY_DISCOVERY) {
+      return scheduleEntity(entity, PUBLISH_DISCOVERY, priority);
+    }
+
+    // Device status requests are not merged, they are all published.
+    bool scheduleDeviceStatus(HaMqttDevice * device, bool online, uint8_t priority = PRIORITY_DEVICE_STATUS) {
+      if (device == NULL) return false;
+      REQUEST request = {priority, PUBLISH_DEVICE_STATUS, online, 0, 0, NULL, device, NULL};
+      push(request);
+      return true;
+    }
+
+    bool scheduleEvents(MqttEventQueue * events, uint8_t priority = PRIORITY_URGENT) {
+      if (events == NULL) return false;
+      for(size_t i=0; i<requests.size(); i++) {
+        REQUEST & request = requests[i];
+        if (request.events == events) {
+          if (priority < request.priority) {
+            request.priority = priority;
+            std::make_heap(requests.begin(), requests.end(), compare);
+          }
+          return true;
+        }
+      }
+      REQUEST request = {priority, PUBLISH_EVENTS, false, 0, 0, NULL, NULL, events};
+      push(request);
+      return true;
+    }
+
+    // Publishes the most urgent request, or batch of requests, if the rate limit allows it.
+    // Returns true if a publication was attempted.
+    bool process(uint32_t now) {
+      refill(now);
+      if (requests.empty() || tokens == 0)
+        return false;
+      tokens--;
+
+      bool batching = (batch_adaptor != NULL && batch_size > 1 && requests.size() > 1 && isBatchable(requests.front()) && batch_adaptor->beginBatch());
+      size_t count = 0;
+      do {
+        processNext(now, batching);
+        count++;
+      } while(batching && count < batch_size && !requests.empty() && isBatchable(requests.front()));
+      if (batching)
+        endBatch(batch_adaptor->flush());
+      return true;
+    }
+
+  private:
+    typedef std::vector<REQUEST> RequestVector;
+
+    static inline bool isBatchable(const REQUEST & request) {
+      return request.type != PUBLISH_EVENTS;
+    }
+
+    void processNext(uint32_t now, bool batching) {
+      REQUEST request = requests.front();
+      std::pop_heap(requests.begin(), requests.end(), compare);
+      requests.pop_back();
+
+      bool success = publish(request, now);
+      if (success && batching) {
+        batched.push_back(request); // reported by endBatch()
+        return;
+      }
+      onResult(request, success);
+    }
+
+    // Reports the publications of the batch, once it is written or not.
+    void endBatch(bool written) {
+      for(size_t i=0; i<batched.size(); i++) {
+        REQUEST & request = batched[i];
+        if (!written && request.type == PUBLISH_STATE) {
+          // The state was marked published when it was added to the batch
+          request.entity->getState().clearPublished();
+          request.entity->getState().setDirty();
+        }
+        onResult(request, written);
+      }
+      batched.clear();
+    }
+
+    void onResult(REQUEST & request, bool success) {
+      if (!success)
+        request.failures++;
+      if (result_handler)
+        result_handler(request, success);
+
+      // Try again later, after the other requests of the same priority
+      if (!success && request.failures < max_failures)
+        push(request);
+      else if (success && request.type == PUBLISH_EVENTS && !request.events->isEmpty()) {
+        request.failures = 0;
+        push(request); // the next event
+      }
+    }
+
+    // Returns true if left must be published after right.
+    static bool compare(const REQUEST & left, const REQUEST & right) {
+      if (left.priority != right.priority)
+        return left.priority > right.priority;
+      return (int32_t)(left.sequence - right.sequence) > 0;
+    }
+
+    RequestVector::const_iterator findRequest(const HaMqttEntity * entity, PUBLISH_TYPE type) const {
+      for(RequestVector::const_iterator it = requests.begin(); it != requests.end(); ++it) {
+        if (it->entity == entity && it->type == type)
+          return it;
+      }
+      return requests.end();
+    }
+
+    bool scheduleEntity(HaMqttEntity * entity, PUBLISH_TYPE type, uint8_t priority) {
+      if (entity == NULL) return false;
+      for(size_t i=0; i<requests.size(); i++) {
+        REQUEST & request = requests[i];
+        if (request.entity == entity && request.type == type) {
+          if (priority < request.priority) {
+            request.priority = priority;
+            std::make_heap(requests.begin(), requests.end(), compare);
+          }
+          return true;
+        }
+      }
+      REQUEST request = {priority, (uint8_t)type, false, 0, 0, entity, NULL, NULL};
+      push(request);
+      return true;
+    }
+
+    void push(REQUEST & request) {
+      request.sequence = sequence++;
+      requests.push_back(request);
+      std::push_heap(requests.begin(), requests.end(), compare);
+    }
+
+    void refill(uint32_t now) {
+      if (tokens >= burst) {
+        last_refill = now;
+        return;
+      }
+      uint32_t elapsed = now - last_refill;
+      if (elapsed < interval)
+        return;
+      uint32_t added = (interval == 0 ? burst : elapsed / interval);
+      tokens = (added >= (uint32_t)(burst - tokens) ? burst : tokens + added);
+      last_refill += added * interval;
+    }
+
+    static bool publish(const REQUEST & request, uint32_t now) {
+      switch(request.type) {
+        case PUBLISH_STATE: return request.entity->publishMqttState();
+        case PUBLISH_DISCOVERY: return request.entity->publishMqttDiscovery();
+        case PUBLISH_DEVICE_STATUS: return request.device->publishMqttDeviceStatus(request.online);
+        case PUBLISH_EVENTS: return request.events->publishNext(now);
+        default: return false;
+      };
+    }
+
+    RequestVector requests; // binary heap, the most urgent request first
+    RequestVector batched;  // publications of the current batch, until it is written
+    uint32_t interval;
+    uint8_t burst;
+    uint8_t max_failures;
+    uint8_t tokens;
+    uint32_t last_refill;
+    uint32_t sequence;
+    ResultHandler result_handler;
+    MqttAdaptor * batch_adaptor;
+    uint8_t batch_size;
+};
+
+}; // namespace HaMqttDiscovery
+
+#endif // HA_MQTT_DISCOVERY_MQTT_PUBLISH_SCHEDULER
@@ -5,94 +5,220 @@
 
 namespace HaMqttDiscovery {
 
+// The value of an entity's state and whether it must be published.
+// The state remembers a hash of the last value acknowledged by the broker (see setPublished()).
+// Setting a value identical to the acknowledged one does not make the state dirty, so changes
+// that return to the published value before they are published coalesce into nothing.
+// Values shorter than INLINE_CAPACITY are stored inside the object. Larger values are stored
+// on the heap and the heap buffer is reused by the following values that fit in it.
+// The value is always followed by a null character, so string values can be read as a C string.
 class MqttState {
   public:
+    static const size_t INLINE_CAPACITY = 32; // including the terminating null character
 
     struct Buffer {
-      uint8_t * buffer;
+      const uint8_t * buffer;
       size_t size;
     };
 
     MqttState() {
-      memset(&bin_value, 0, sizeof(bin_value));
+      inline_data[0] = '\0';
+      heap_data = NULL;
+      heap_capacity = 0;
+      size = 0;
       is_binary = false;
       is_dirty = false;
+      is_published = false;
+      value_hash = FNV_OFFSET_BASIS;
+      published_hash = 0;
+      dirty_set = NULL;
+      dirty_bit = 0;
     }
-    virtual ~MqttState() {
-      clear();
+    ~MqttState() {
+      if (heap_data)
+        free(heap_data);
+      dirty_set = NULL;
     }
   private:
     // Disable copy ctor
     MqttState(const MqttState & copy) {}
   public:
 
-    virtual void clear() {
-      if (bin_value.buffer) {
-        free(bin_value.buffer);
-        memset(&bin_value, 0, sizeof(bin_value));
-      } else {
-        str_value.clear();
+    // Moves the value and the publication status. The dirty set registration of
+    // each state is kept, it belongs to the entity owning the state.
+    MqttState(MqttState && other) : MqttState() {
+      moveFrom(other);
+    }
+
+    MqttState & operator=(MqttState && other) {
+      if (this != &other) {
+        if (heap_data)
+          free(heap_data);
+        heap_data = NULL;
+        heap_capacity = 0;
+        moveFrom(other);
       }
+      return *this;
+    }
+
+    // Empties the value and releases the heap buffer, if any.
+    void clear() {
+      if (heap_data)
+        free(heap_data);
+      heap_data = NULL;
+      heap_capacity = 0;
+      inline_data[0] = '\0';
+      size = 0;
       is_binary = false;
       is_dirty = false;
+      value_hash = FNV_OFFSET_BASIS;
+      updateDirtySet();
     }
 
-    virtual bool isBinary() {
+    inline bool isBinary() const {
       return is_binary;
     }
 
-    virtual bool isDirty() {
+    inline bool isDirty() const {
       return is_dirty;
     }
 
-    virtual void setDirty(bool value = true) {
+    inline void setDirty(bool value = true) {
       is_dirty = value;
+      updateDirtySet();
     }
 
-    virtual void set(const char * value) {
-      if (is_binary)
-        clear();
-      is_binary = false;
-      is_dirty = true;
-      str_value = value;
+    // Mirrors the dirty flag to a bit of the owner's dirty set. See HaMqttDevice::getDirtyEntities().
+    void setDirtySet(uint32_t * dirty_set, uint32_t dirty_bit) {
+      if (this->dirty_set)
+        *this->dirty_set &= ~this->dirty_bit;
+      this->dirty_set = dirty_set;
+      this->dirty_bit = dirty_bit;
+      updateDirtySet();
+    }
+
+    inline void set(const char * value) {
+      if (value == NULL)
+        value = "";
+      assign((const uint8_t *)value, strlen(value), false);
+    }
+
+    inline void set(const String & value) {
+      assign((const uint8_t *)value.c_str(), value.length(), false);
+    }
+
+    inline void set(const uint8_t * value, size_t length) {
+      assign(value, length, true);
+    }
+
+    // Call when the broker has acknowledged the current value.
+    void setPublished() {
+      published_hash = value_hash;
+      is_published = true;
+      setDirty(false);
     }
-    
-    virtual void set(const String & value) {
-      if (is_binary)
-        clear();
-      is_binary = false;
-      is_dirty = true;
-      str_value = value;
-    }
-    
-    virtual void set(const uint8_t * value, size_t length) {
-      if (is_binary)
-        clear();
-      uint8_t * tmp = (uint8_t *)malloc(length);
-      if (!tmp)
-        return;
-      memcpy(tmp, value, length);
-      bin_value.buffer = tmp;
-      bin_value.size = length;
 
-      is_binary = true;
-      is_dirty = true;
+    // Forget the acknowledged value, the next set() always makes the state dirty.
+    void clearPublished() {
+      is_published = false;
     }
 
-    const String & getStringValue() const {
-      return str_value;
+    inline bool isPublished() const { return is_published; }
+    inline uint32_t getValueHash() const { return value_hash; }
+
+    inline const char * getStringValue() const {
+      return (const char *)getData();
     }
 
-    const Buffer & getBinaryValue() const {
-      return bin_value;
+    inline Buffer getBinaryValue() const {
+      Buffer value = {getData(), size};
+      return value;
     }
 
+    inline const uint8_t * getData() const { return (heap_data ? heap_data : inline_data); }
+    inline size_t getSize() const { return size; }
+    inline bool isInline() const { return heap_data == NULL; }
+
   private:
+    void assign(const uint8_t * value, size_t length, bool binary) {
+      uint8_t * data = (heap_data ? heap_data : inline_data);
+      size_t capacity = (heap_data ? heap_capacity : INLINE_CAPACITY);
+      uint8_t * previous_heap_data = NULL;
+      if (length + 1 > capacity) {
+        data = (uint8_t *)malloc(length + 1);
+        if (data == NULL) {
+#         ifdef HA_MQTT_DISCOVERY_PRINT_FUNC
+          HA_MQTT_DISCOVERY_PRINT_FUNC(error_message_prefix + "MqttState: out of memory, the state is unchanged.\n");
+#         endif
+          return;
+        }
+        // The previous value may be the source of the new one, it is freed after the copy.
+        previous_heap_data = heap_data;
+        heap_data = data;
+        heap_capacity = length + 1;
+      }
+
+      if (length > 0)
+        memmove(data, value, length);
+      data[length] = '\0';
+      size = length;
+      is_binary = binary;
+      if (previous_heap_data)
+        free(previous_heap_data);
+      setValueHash(fnv1a(data, length));
+    }
+
+    void moveFrom(MqttState & other) {
+      if (other.heap_data) {
+        heap_data = other.heap_data;
+        heap_capacity = other.heap_capacity;
+        other.heap_data = NULL;
+        other.heap_capacity = 0;
+      } else {
+        memcpy(inline_data, other.inline_data, other.size + 1);
+      }
+      size = other.size;
+      is_binary = other.is_binary;
+      is_published = other.is_published;
+      value_hash = other.value_hash;
+      published_hash = other.published_hash;
+      is_dirty = other.is_dirty;
+      updateDirtySet();
+
+      other.inline_data[0] = '\0';
+      other.size = 0;
+      other.is_binary = false;
+      other.is_published = false;
+      other.value_hash = FNV_OFFSET_BASIS;
+      other.setDirty(false);
+    }
+
+    void setValueHash(uint32_t hash) {
+      value_hash = hash;
+      is_dirty = !(is_published && value_hash == published_hash);
+      updateDirtySet();
+    }
+
+    inline void updateDirtySet() {
+      if (dirty_set == NULL)
+        return;
+      if (is_dirty)
+        *dirty_set |= dirty_bit;
+      else
+        *dirty_set &= ~dirty_bit;
+    }
+
+    uint8_t inline_data[INLINE_CAPACITY];
+    uint8_t * heap_data;    // NULL while the value is stored in inline_data
+    size_t heap_capacity;
+    size_t size;            // length of the value, without the terminating null character
     bool is_binary;
     bool is_dirty;
-
-    String str_value;
-    Buffer bin_value;
+    bool is_published;      // true if published_hash is the hash of a value acknowledged by the broker
+    uint32_t value_hash;    // FNV-1a hash of the current value
+    uint32_t published_hash;
+    uint32_t * dirty_set;
+    uint32_t dirty_bit;
 };
 
 }; // namespace HaMqttDiscovery
@@ -0,0 +1,98 @@
+#ifndef DOORBELL_LATENCY_HISTOGRAM
+#define DOORBELL_LATENCY_HISTOGRAM
+
+#include <Arduino.h>
+
+// Fixed size histogram of latencies in microseconds.
+// Recording a value never allocates and only costs a few integer operations.
+// Buckets are logarithmic: values below 4 us have their own bucket, and each following
+// power of two is split in 4 buckets. Percentiles are reported as the upper bound of
+// a bucket, which is at most 25% above the actual value.
+// Values above 2^25 us (~33 seconds) are counted in the last bucket.
+class LatencyHistogram {
+  public:
+    static const size_t SUB_BUCKETS = 4;
+    static const size_t BUCKET_COUNT = 100;
+
+    LatencyHistogram() {
+      clear();
+    }
+
+    void clear() {
+      memset(buckets, 0, sizeof(buckets));
+      count = 0;
+      min_value = 0;
+      max_value = 0;
+    }
+
+    void record(uint32_t value) {
+      size_t index = getBucketIndex(value);
+      if (buckets[index] == 0xFFFF) {
+        // Halve all buckets to keep the distribution instead of saturating.
+        for(size_t i=0; i<BUCKET_COUNT; i++)
+          buckets[i] = (buckets[i] + 1) / 2;
+      }
+      buckets[index]++;
+
+      if (count == 0 || value < min_value)
+        min_value = value;
+      if (count == 0 || value > max_value)
+        max_value = value;
+      count++;
+    }
+
+    inline uint32_t getCount() const { return count; }
+    inline uint32_t getMin() const { return min_value; }
+    inline uint32_t getMax() const { return max_value; }
+
+    // Returns the upper bound of the bucket containing the given percentile (0 to 100).
+    uint32_t getPercentile(uint8_t percent) const {
+      uint32_t total = 0;
+      for(size_t i=0; i<BUCKET_COUNT; i++)
+        total += buckets[i];
+      if (total == 0)
+        return 0;
+
+      uint32_t rank = (total * percent + 99) / 100;
+      if (rank == 0)
+        rank = 1;
+      uint32_t cumulative = 0;
+      for(size_t i=0; i<BUCKET_COUNT; i++) {
+        cumulative += buckets[i];
+        if (cumulative >= rank) {
+          uint32_t upper_bound = getBucketUpperBound(i);
+          return (upper_bound < max_value ? upper_bound : max_value);
+        }
+      }
+      return max_value;
+    }
+
+    inline uint16_t getBucket(size_t index) const { return (index < BUCKET_COUNT ? buckets[index] : 0); }
+
+    static size_t getBucketIndex(uint32_t value) {
+      if (value < SUB_BUCKETS)
+        return value;
+      size_t msb = 31 - __builtin_clz(value); // 2 or more
+      size_t index = (msb - 1) * SUB_BUCKETS + ((value >> (msb - 2)) & (SUB_BUCKETS - 1));
+      return (index < BUCKET_COUNT ? index : BUCKET_COUNT - 1);
+    }
+
+    static uint32_t getBucketUpperBound(size_t index) {
+      if (index < SUB_BUCKETS)
+        return index;
+      if (index >= BUCKET_COUNT - 1)
+        return 0xFFFFFFFF;
+      size_t msb = index / SUB_BUCKETS + 1;
+      size_t sub = index % SUB_BUCKETS;
+      uint32_t width = (1UL << (msb - 2));
+      return (SUB_BUCKETS + sub) * width + width - 1;
+    }
+
+  private:
+    uint16_t buckets[BUCKET_COUNT];
+    uint32_t count;
+    uint32_t min_value;
+    uint32_t max_value;
+};
+
+#endif // DOORBELL_LATENCY_HISTOGRAM
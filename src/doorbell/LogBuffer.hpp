@@ -0,0 +1,226 @@
+#ifndef DOORBELL_LOG_BUFFER
+#define DOORBELL_LOG_BUFFER
+
+#include <Arduino.h>
+#include <type_traits>
+
+// Log levels. Messages above LOG_LEVEL are compiled out: the LOG_* macros expand to nothing
+// and their arguments are not evaluated.
+#define LOG_LEVEL_NONE    0
+#define LOG_LEVEL_ERROR   1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_INFO    3
+#define LOG_LEVEL_DEBUG   4
+
+#ifndef LOG_LEVEL
+#   define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Name of the LogBuffer the LOG_* macros add to.
+#ifndef LOG_BUFFER_INSTANCE
+#   define LOG_BUFFER_INSTANCE log_buffer
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#   define LOG_ERROR(...) LOG_BUFFER_INSTANCE.add(LOG_LEVEL_ERROR, millis(), __VA_ARGS__)
+#else
+#   define LOG_ERROR(...) do {} while(0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARNING
+#   define LOG_WARNING(...) LOG_BUFFER_INSTANCE.add(LOG_LEVEL_WARNING, millis(), __VA_ARGS__)
+#else
+#   define LOG_WARNING(...) do {} while(0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#   define LOG_INFO(...) LOG_BUFFER_INSTANCE.add(LOG_LEVEL_INFO, millis(), __VA_ARGS__)
+#else
+#   define LOG_INFO(...) do {} while(0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#   define LOG_DEBUG(...) LOG_BUFFER_INSTANCE.add(LOG_LEVEL_DEBUG, millis(), __VA_ARGS__)
+#else
+#   define LOG_DEBUG(...) do {} while(0)
+#endif
+
+// A string which does not outlive the call, copied into the record. It needs no terminating null.
+struct LOG_TEXT {
+  const char * str;
+  size_t length;
+};
+inline LOG_TEXT log_text(const char * str, size_t length) { LOG_TEXT text = { str, length }; return text; }
+inline LOG_TEXT log_text(const char * str) { return log_text(str, strlen(str)); }
+
+// Deferred logging: a message is stored as a fixed size record with the format string's address,
+// its arguments and the time, and is only formatted when the record is drained, in idle time.
+// Adding a record never allocates memory nor writes to the serial port.
+// The format string must be a literal. Supported conversions:
+//   %d %u %x  integer argument
+//   %c        character argument
+//   %a        IPv4 address argument, in IPAddress's uint32_t layout
+//   %s        string argument which lives as long as the program (a literal or __FUNCTION__)
+//   %t        LOG_TEXT argument, copied into the record (truncated to what is left of TEXT_SIZE)
+//   %%        percent sign
+// Up to MAX_ARGS arguments. Other pointers, String and IPAddress are rejected at compile time.
+// When the buffer is full, new records are dropped and counted. Not safe to call from an interrupt.
+template<size_t CAPACITY, size_t TEXT_SIZE>
+class LogBuffer {
+  public:
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+    static_assert(TEXT_SIZE > 0 && TEXT_SIZE <= 0xFF, "TEXT_SIZE must be between 1 and 255");
+
+    static const size_t MAX_ARGS = 3;
+
+    struct RECORD {
+      uint32_t time;
+      const char * format;
+      uintptr_t args[MAX_ARGS]; // %t arguments are an offset in text
+      uint8_t level;
+      uint8_t arg_count;
+      uint8_t text_length;
+      char text[TEXT_SIZE];     // null terminated copies of the %t arguments
+    };
+
+    LogBuffer() {
+      head = 0;
+      tail = 0;
+      dropped = 0;
+    }
+  private:
+    // Disable copy ctor
+    LogBuffer(const LogBuffer & copy) {}
+  public:
+
+    // Returns false and counts the record as dropped if the buffer is full.
+    template<typename... ARGS>
+    bool add(uint8_t level, uint32_t time, const char * format, ARGS... args) {
+      static_assert(sizeof...(ARGS) <= MAX_ARGS, "too many log arguments");
+      size_t next = (head + 1) & (CAPACITY - 1);
+      if (next == tail) {
+        dropped++;
+        return false;
+      }
+      RECORD & record = records[head];
+      record.time = time;
+      record.format = format;
+      record.level = level;
+      record.arg_count = 0;
+      record.text_length = 0;
+      int expand[] = { 0, (store(record, args), 0)... };
+      (void)expand;
+      head = next;
+      return true;
+    }
+
+    // Returns the oldest record without removing it, NULL if the buffer is empty.
+    inline const RECORD * peek() const { return (head == tail ? NULL : &records[tail]); }
+    inline void pop() {
+      if (head != tail)
+        tail = (tail + 1) & (CAPACITY - 1);
+    }
+
+    inline bool isEmpty() const { return head == tail; }
+    inline size_t getCount() const { return (head - tail) & (CAPACITY - 1); }
+    inline size_t getCapacity() const { return CAPACITY - 1; }
+
+    // Number of records dropped since the last call.
+    uint32_t takeDropped() {
+      uint32_t count = dropped;
+      dropped = 0;
+      return count;
+    }
+
+    // Formats the message of a record, without the time and the level. The message is truncated to fit.
+    // Returns the length of the message.
+    static size_t format(const RECORD & record, char * buffer, size_t size) {
+      if (size == 0)
+        return 0;
+      size_t length = 0;
+      size_t arg = 0;
+      for(const char * f = record.format; *f != '\0'; f++) {
+        if (*f != '%' || f[1] == '\0') {
+          append(buffer, size, length, *f);
+          continue;
+        }
+        char conversion = *++f;
+        if (conversion == '%') {
+          append(buffer, size, length, '%');
+          continue;
+        }
+        if (arg >= record.arg_count) {
+          append(buffer, size, length, '?');
+          continue;
+        }
+        uintptr_t value = record.args[arg++];
+        char number[16];
+        switch(conversion) {
+          case 'd': snprintf(number, sizeof(number), "%ld", (long)(intptr_t)value); append(buffer, size, length, number); break;
+          case 'u': snprintf(number, sizeof(number), "%lu", (unsigned long)value); append(buffer, size, length, number); break;
+          case 'x': snprintf(number, sizeof(number), "%lx", (unsigned long)value); append(buffer, size, length, number); break;
+          case 'c': append(buffer, size, length, (char)value); break;
+          case 'a':
+            snprintf(number, sizeof(number), "%u.%u.%u.%u", (unsigned)(value & 0xFF), (unsigned)((value >> 8) & 0xFF), (unsigned)((value >> 16) & 0xFF), (unsigned)((value >> 24) & 0xFF));
+            append(buffer, size, length, number);
+            break;
+          case 's': append(buffer, size, length, (const char *)value); break;
+          case 't': append(buffer, size, length, &record.text[value]); break;
+          default: append(buffer, size, length, '?'); break;
+        }
+      }
+      buffer[length] = '\0';
+      return length;
+    }
+
+    static const char * getLevelName(uint8_t level) {
+      switch(level) {
+        case LOG_LEVEL_ERROR:   return "E";
+        case LOG_LEVEL_WARNING: return "W";
+        case LOG_LEVEL_INFO:    return "I";
+        case LOG_LEVEL_DEBUG:   return "D";
+      };
+      return "?";
+    }
+
+  private:
+    static inline void store(RECORD & record, const char * str) {
+      record.args[record.arg_count++] = (uintptr_t)(str == NULL ? "(null)" : str);
+    }
+
+    static void store(RECORD & record, const LOG_TEXT & text) {
+      // Each copy is null terminated, an empty string when the text area is full
+      size_t offset = record.text_length;
+      if (offset >= TEXT_SIZE)
+        offset = TEXT_SIZE - 1; // the last byte is always a terminating null
+      size_t length = TEXT_SIZE - 1 - offset;
+      if (text.length < length)
+        length = text.length;
+      if (length > 0)
+        memcpy(&record.text[offset], text.str, length);
+      record.text[offset + length] = '\0';
+      record.text_length = (uint8_t)(offset + length + 1);
+      record.args[record.arg_count++] = (uintptr_t)offset;
+    }
+
+    template<typename T>
+    static inline void store(RECORD & record, T value) {
+      static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+        "log arguments must be integers, literals or LOG_TEXT");
+      record.args[record.arg_count++] = (uintptr_t)value;
+    }
+
+    static inline void append(char * buffer, size_t size, size_t & length, char c) {
+      if (length + 1 < size)
+        buffer[length++] = c;
+    }
+
+    static void append(char * buffer, size_t size, size_t & length, const char * str) {
+      for(; *str != '\0' && length + 1 < size; str++)
+        buffer[length++] = *str;
+    }
+
+    RECORD records[CAPACITY];
+    size_t head; // next record to add
+    size_t tail; // oldest record
+    uint32_t dropped;
+};
+
+#endif // DOORBELL_LOG_BUFFER
@@ -0,0 +1,199 @@
+#ifndef DOORBELL_MELODY_CATALOG
+#define DOORBELL_MELODY_CATALOG
+
+#include <Arduino.h>
+
+#include "HaMqttDiscovery/JsonWriter.hpp"
+
+// Appends a RTTTL melody to a catalog data array.
+// Melodies are stored back to back in a single PROGMEM char array, each one followed by a null character:
+//   static constexpr char melodies_data[] PROGMEM =
+//     MELODY("Nokia:d=4,o=4,b=180:8e5,8d5,f#,g#")
+//     MELODY("Intel:d=16,o=5,b=320:d,p,d,p,d,p,g");
+// An entry can also be a name only, for melodies stored in another format (see rtttl_library.h).
+#define MELODY(rtttl) rtttl "\0"
+
+// Returns the number of melodies in a catalog data array.
+template<size_t SIZE>
+constexpr size_t countMelodies(const char (&data)[SIZE]) {
+  size_t count = 0;
+  for(size_t i=0; i+1<SIZE; i++) { // the last null character terminates the string literal
+    if (data[i] == '\0')
+      count++;
+  }
+  return count;
+}
+
+// Read only access to RTTTL melodies stored in flash.
+// The offset, the name length and the alphabetical rank of each melody are computed
+// by the compiler with buildTable() and stored in flash next to the melodies.
+// Nothing is copied to RAM: names are read from flash when they are needed.
+template<size_t COUNT>
+class MelodyCatalog {
+  public:
+    static const size_t INVALID_INDEX = (size_t)-1;
+    static const size_t MAX_DATA_SIZE = 0xFFFF;
+    static const size_t MAX_NAME_LENGTH = 0xFF;
+
+    struct TABLE {
+      uint16_t offsets[COUNT];        // offset of each melody in the catalog data
+      uint8_t name_lengths[COUNT];    // number of characters before the ':' or the end of each melody
+      uint16_t sorted_indices[COUNT]; // melody indices sorted by name, for binary searches
+    };
+
+    // Returns true if all melodies have a name and fit in a TABLE.
+    template<size_t SIZE>
+    static constexpr bool isValid(const char (&data)[SIZE]) {
+      if (SIZE > MAX_DATA_SIZE || countMelodies(data) != COUNT)
+        return false;
+      size_t start = 0;
+      for(size_t i=0; i<COUNT; i++) {
+        size_t length = findNameLength(data, start);
+        if (length == 0 || length > MAX_NAME_LENGTH)
+          return false;
+        while(data[start] != '\0')
+          start++;
+        start++;
+      }
+      return true;
+    }
+
+    template<size_t SIZE>
+    static constexpr TABLE buildTable(const char (&data)[SIZE]) {
+      TABLE table = {};
+      size_t start = 0;
+      for(size_t i=0; i<COUNT; i++) {
+        table.offsets[i] = (uint16_t)start;
+        table.name_lengths[i] = (uint8_t)findNameLength(data, start);
+        while(data[start] != '\0')
+          start++;
+        start++;
+      }
+
+      // Insertion sort
+      for(size_t i=0; i<COUNT; i++) {
+        size_t j = i;
+        while(j > 0 && compareNames(data, table, table.sorted_indices[j-1], i) > 0) {
+          table.sorted_indices[j] = table.sorted_indices[j-1];
+          j--;
+        }
+        table.sorted_indices[j] = (uint16_t)i;
+      }
+      return table;
+    }
+
+    // Both data and table must be stored in flash.
+    MelodyCatalog(const char * data, const TABLE * table) {
+      this->data = data;
+      this->table = table;
+    }
+
+    inline size_t getCount() const { return COUNT; }
+
+    // Returns the catalog entry at the given index, a RTTTL melody or a name. The pointer is in flash.
+    const char * getMelody(size_t index) const {
+      if (index >= COUNT)
+        return NULL;
+      return data + pgm_read_word(&table->offsets[index]);
+    }
+
+    size_t getNameLength(size_t index) const {
+      if (index >= COUNT)
+        return 0;
+      return pgm_read_byte(&table->name_lengths[index]);
+    }
+
+    void getName(size_t index, String & name) const {
+      name.clear();
+      const char * melody = getMelody(index);
+      size_t length = getNameLength(index);
+      name.reserve(length);
+      for(size_t i=0; i<length; i++)
+        name += (char)pgm_read_byte(melody + i);
+    }
+
+    // Copies the name into a buffer, truncated to size-1 characters and null terminated.
+    // Returns the length of the copy. Does not allocate, unlike the String version.
+    size_t getName(size_t index, char * buffer, size_t size) const {
+      if (size == 0)
+        return 0;
+      size_t length = getNameLength(index);
+      if (length > size - 1)
+        length = size - 1;
+      if (length > 0)
+        memcpy_P(buffer, getMelody(index), length);
+      buffer[length] = '\0';
+      return length;
+    }
+
+    // Returns the index of the melody matching the given name or INVALID_INDEX.
+    // The name does not need to be null terminated.
+    size_t find(const uint8_t * name, size_t length) const {
+      if (name == NULL || length == 0)
+        return INVALID_INDEX;
+
+      size_t low = 0;
+      size_t high = COUNT;
+      while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        size_t index = pgm_read_word(&table->sorted_indices[middle]);
+        int result = compareName(index, name, length);
+        if (result == 0)
+          return index;
+        if (result < 0)
+          low = middle + 1;
+        else
+          high = middle;
+      }
+      return INVALID_INDEX;
+    }
+    inline size_t find(const char * name) const { return (name == NULL ? INVALID_INDEX : find((const uint8_t *)name, strlen(name))); }
+    inline size_t find(const String & name) const { return find((const uint8_t *)name.c_str(), name.length()); }
+
+    // Writes all melody names as json values, directly from flash.
+    void serializeNames(HaMqttDiscovery::JsonWriter & writer) const {
+      for(size_t i=0; i<COUNT; i++)
+        writer.value_P(getMelody(i), getNameLength(i));
+    }
+
+  private:
+    static constexpr size_t findNameLength(const char * data, size_t start) {
+      size_t length = 0;
+      while(data[start + length] != '\0' && data[start + length] != ':')
+        length++;
+      return length;
+    }
+
+    // Same ordering as strcmp() on the melody names.
+    static constexpr int compareNames(const char * data, const TABLE & table, size_t left, size_t right) {
+      const char * left_name = data + table.offsets[left];
+      const char * right_name = data + table.offsets[right];
+      size_t left_length = table.name_lengths[left];
+      size_t right_length = table.name_lengths[right];
+      for(size_t i=0; i<left_length && i<right_length; i++) {
+        if (left_name[i] != right_name[i])
+          return ((uint8_t)left_name[i] < (uint8_t)right_name[i] ? -1 : 1);
+      }
+      if (left_length == right_length)
+        return 0;
+      return (left_length < right_length ? -1 : 1);
+    }
+
+    int compareName(size_t index, const uint8_t * name, size_t length) const {
+      const char * melody = getMelody(index);
+      size_t melody_name_length = getNameLength(index);
+      for(size_t i=0; i<melody_name_length && i<length; i++) {
+        uint8_t c = pgm_read_byte(melody + i);
+        if (c != name[i])
+          return (c < name[i] ? -1 : 1);
+      }
+      if (melody_name_length == length)
+        return 0;
+      return (melody_name_length < length ? -1 : 1);
+    }
+
+    const char * data;
+    const TABLE * table;
+};
+
+#endif // DOORBELL_MELODY_CATALOG
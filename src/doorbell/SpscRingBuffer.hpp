@@ -0,0 +1,75 @@
+#ifndef DOORBELL_SPSC_RING_BUFFER
+#define DOORBELL_SPSC_RING_BUFFER
+
+#include <Arduino.h>
+
+// Fixed size, lock-free queue between a single producer and a single consumer.
+// The producer is typically an interrupt service routine and the consumer is loop().
+// The producer only writes the head index and the consumer only writes the tail index,
+// so neither side has to disable interrupts. Only push() may be called from an ISR:
+// it is forced inline so that its code ends up in the caller, which must be IRAM_ATTR.
+// An out of line template instance would be placed in flash and crash the ISR when the
+// flash cache is busy. The other methods are for the consumer, outside interrupts.
+// SIZE must be a power of two. The queue holds up to SIZE-1 items.
+template<typename T, size_t SIZE>
+class SpscRingBuffer {
+  public:
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two");
+
+    SpscRingBuffer() {
+      head = 0;
+      tail = 0;
+      dropped = 0;
+    }
+
+    // Producer side. Returns false and counts the item as dropped if the queue is full.
+    __attribute__((always_inline)) inline bool push(const T & item) {
+      size_t current = head;
+      size_t next = (current + 1) & (SIZE - 1);
+      if (next == tail) {
+        dropped++;
+        return false;
+      }
+      items[current] = item;
+      __sync_synchronize(); // the item must be visible before the new head
+      head = next;
+      return true;
+    }
+
+    // Consumer side. Returns false if the queue is empty.
+    bool pop(T & item) {
+      size_t current = tail;
+      if (current == head)
+        return false;
+      __sync_synchronize(); // read the item after the head
+      item = items[current];
+      __sync_synchronize(); // the item must be read before the slot is released
+      tail = (current + 1) & (SIZE - 1);
+      return true;
+    }
+
+    // Consumer side. Returns the oldest item without removing it.
+    bool peek(T & item) const {
+      size_t current = tail;
+      if (current == head)
+        return false;
+      __sync_synchronize();
+      item = items[current];
+      return true;
+    }
+
+    inline bool isEmpty() const { return head == tail; }
+    inline size_t getCount() const { return (head - tail) & (SIZE - 1); }
+    inline size_t getCapacity() const { return SIZE - 1; }
+
+    // Number of items rejected by push() because the queue was full.
+    inline uint32_t getDropped() const { return dropped; }
+
+  private:
+    T items[SIZE];
+    volatile size_t head; // next slot written by the producer
+    volatile size_t tail; // next slot read by the consumer
+    volatile uint32_t dropped;
+};
+
+#endif // DOORBELL_SPSC_RING_BUFFER
@@ -1,11 +1,13 @@
+//************************************************************
+//   Build options, used by the included headers
+//************************************************************
+
+//#define MQTT_ASYNC_CLIENT // use AsyncMqttClient (requires ESPAsyncTCP) instead of PubSubClient: the network never blocks loop()
+#define LOG_LEVEL LOG_LEVEL_INFO // messages above this level are compiled out, see LogBuffer.hpp
+
 #include <ESP8266WiFi.h>    // https://github.com/esp8266/Arduino/tree/master/libraries/ESP8266WiFi
-#include <PubSubClient.h>   // https://www.arduino.cc/reference/en/libraries/pubsubclient/
+#include <lwip/dns.h>       // for dns_gethostbyname
 #include <SoftTimers.h>     // https://www.arduino.cc/reference/en/libraries/softtimers/
-#include <ArduinoJson.h>    // https://www.arduino.cc/reference/en/libraries/arduinojson/
-#include <Button.h>         // https://www.arduino.cc/reference/en/libraries/button/
-#include <anyrtttl.h>       // https://www.arduino.cc/reference/en/libraries/anyrtttl/
-#include <binrtttl.h>       // https://www.arduino.cc/reference/en/libraries/anyrtttl/
-#include <pitches.h>        // https://www.arduino.cc/reference/en/libraries/anyrtttl/
 
 
 #include <strings.h>  // for strcasecmp
@@ -13,10 +15,33 @@
 
 #include "arduino_secrets.h"
 
+#include "LogBuffer.hpp"
+#if LOG_LEVEL < LOG_LEVEL_DEBUG
+#define HA_MQTT_DISCOVERY_NO_PRINT // the library prints every publication synchronously, the sketch logs the failures
+#endif
 #include "HaMqttDiscovery/HaMqttDiscovery.hpp"
 #include "HaMqttDiscovery/HaMqttEntity.hpp"
 #include "HaMqttDiscovery/HaMqttDevice.hpp"
+#include "HaMqttDiscovery/HaMqttEntityTable.hpp"
+#ifdef MQTT_ASYNC_CLIENT
+#include "HaMqttDiscovery/MqttAdaptorAsyncMqttClient.hpp"
+#else
 #include "HaMqttDiscovery/MqttAdaptorPubSubClient.hpp"
+#endif
+#include "HaMqttDiscovery/MqttCommandDispatcher.hpp"
+#include "HaMqttDiscovery/MqttPublishScheduler.hpp"
+#include "HaMqttDiscovery/MqttEventQueue.hpp"
+#include "HaMqttDiscovery/MqttEventStoreLittleFS.hpp"
+
+#include "MelodyCatalog.hpp"
+#include "BinaryMelodyPlayer.hpp"
+#include "LatencyHistogram.hpp"
+#include "SpscRingBuffer.hpp"
+#include "DeadlineScheduler.hpp"
+#include "FastBootCache.hpp"
+#include "BrokerList.hpp"
+#include "DeviceDiagnostics.hpp"
+#include "rtttl_library.h"    // generated from the rtttl_*.txt files by src/rtttl2bin
 
 using namespace HaMqttDiscovery;
 
@@ -37,6 +62,44 @@ static const uint8_t BUZZER_PIN = D1;
 #define ERROR_MESSAGE_PREFIX "*** --> "
 #define MAX_PUBLISH_RETRY 5
 #define DELAY_BETWEEN_MQTT_TRANSACTIONS 100
+#define MQTT_PUBLISH_BURST 2
+#define MQTT_BATCH_MAX_PUBLICATIONS 8 // publications sent in a single write while connecting
+#define MQTT_BATCH_SIZE 1460 // one TCP segment
+#define DOORBELL_DEBOUNCE_TIME_US 100000
+#define MQTT_RETRY_DELAY_MIN 1000
+#define MQTT_RETRY_DELAY_MAX 60000
+#define DOORBELL_EDGE_QUEUE_SIZE 16
+#define BELL_EVENT_QUEUE_SIZE 32
+#define BELL_EVENT_MAX_AGE 900000 // do not replay rings older than 15 minutes
+//#define BELL_EVENT_SPILL_FILE "/bell_events.bin" // keep the events which do not fit in BELL_EVENT_QUEUE_SIZE in flash
+#define BELL_EVENT_SPILL_MAX_COUNT 256
+#define DEVICE_TIMER_COUNT 9
+#define LOOP_MAX_IDLE_TIME 10 // loop() idles until the next timer deadline, but no longer: bounds the latency added to a ring
+#define DOORBELL_RING_DELAY 5000
+#define IDENTIFY_DELAY 2500
+#define TEST_BUTTON_DURATION 200
+#define ACTIVITY_LED_DURATION 1000
+#define ONLINE_LED_ON_TIME 100
+#define ONLINE_LED_OFF_TIME 4900
+#define HEARTBEAT_PERIOD (5*60*1000)
+#define FAST_BOOT // reuse the access point, IP lease and broker address of the previous boot, see FastBootCache.hpp
+#define FAST_BOOT_RTC_OFFSET 0 // in blocks of 4 bytes of the RTC user memory, which survives a reset
+#define FAST_BOOT_FILE "/fast_boot.bin" // copy of the cache in flash, which survives a power loss. Only written when it changes.
+#define FAST_BOOT_WIFI_TIMEOUT 3000 // scan and use DHCP if the cached access point does not accept the connection
+#define FAST_BOOT_MAX_LEASE_REUSES 8 // consecutive boots which reuse the IP lease, the next one renews it with DHCP
+#define MQTT_BROKER_MAX_COUNT 4
+#define MQTT_BROKER_PORT 1883
+#define MQTT_BROKER_DNS_TTL 300000 // resolve the broker host again after 5 minutes, or after repeated connection failures
+#define MQTT_BROKER_DNS_TIMEOUT 5000
+#define MQTT_BROKER_RESOLVE_AFTER_FAILURES 2
+#define MQTT_BROKER_FAILOVER_AFTER_FAILURES 3 // connect to the next broker after 3 failures, a few seconds with the retry backoff
+#define MQTT_BROKER_FAILURE_DECAY 60000 // a failure is forgotten after a minute, the preferred broker is tried again
+#define LOG_BUFFER_SIZE 16 // records, a power of two
+#define LOG_TEXT_SIZE 64 // bytes of copied strings per record: an MQTT topic and a short payload
+#define LOG_LINE_SIZE 80 // a drained line must fit in the 128 bytes UART FIFO with its time and level
+#define LOG_DRAIN_MAX_RECORDS 4 // per loop()
+#define DIAGNOSTICS_PERIOD 60000 // sample the diagnostic sensors every minute, only changed values are published
+#define MQTT_BUFFER_MAX_SIZE 4096 // increase_mqtt_buffer() never grows PubSubClient's buffer further
 
 //************************************************************
 //   Variables
@@ -48,6 +111,16 @@ struct LED_STATE {
   const char * name;
 };
 
+struct PIN_EDGE {
+  uint32_t time; // micros() when the edge was detected
+  bool pressed;
+};
+typedef SpscRingBuffer<PIN_EDGE, DOORBELL_EDGE_QUEUE_SIZE> PinEdgeQueue;
+
+typedef DeadlineScheduler<DEVICE_TIMER_COUNT> DeviceTimers;
+typedef DeviceTimers::TimerId DeviceTimer;
+typedef LogBuffer<LOG_BUFFER_SIZE, LOG_TEXT_SIZE> DeviceLog;
+
 struct BELL_SENSOR_STATE {
   bool detected;
 };
@@ -55,6 +128,7 @@ struct SMART_BELL_SENSOR {
   HaMqttEntity entity;
   BELL_SENSOR_STATE state;
   BELL_SENSOR_STATE previous;
+  bool new_ring; // set when the sensor turns ON, cleared by loop() once the ring is handled
 };
 
 struct MELODY_STATE {
@@ -82,40 +156,144 @@ struct SMART_BUTTON {
   BUTTON_STATE previous;
 };
 
+struct RING_LATENCY_STATE {
+  uint32_t ring_time; // micros() when the ring was detected
+  bool state_pending;
+  bool chime_pending;
+  bool publish_pending;
+  LatencyHistogram state_latency;   // ring to bell sensor setState("ON")
+  LatencyHistogram chime_latency;   // ring to melody start
+  LatencyHistogram publish_latency; // ring to the publication of its bell event
+};
+struct SMART_LATENCY_SENSOR {
+  HaMqttEntity entity;
+  RING_LATENCY_STATE state;
+  bool attributes_dirty;
+};
+
+struct BOOT_TIMINGS {
+  uint32_t wifi;      // millis() when WiFi is connected
+  uint32_t setup;     // millis() at the end of setup()
+  uint32_t mqtt;      // millis() when the broker accepted the first connection
+  uint32_t ready;     // millis() when the device is first online in Home Assistant
+  bool fast_wifi;     // connected with the cached access point, without a scan
+  bool cached_broker; // connected to the cached broker address
+};
+struct SMART_BOOT_SENSOR {
+  HaMqttEntity entity;
+  BOOT_TIMINGS timings;
+  bool attributes_dirty;
+};
+
+// Diagnostic sensors of the device's health, published at the lowest priority.
+struct SMART_DIAGNOSTICS {
+  DeviceDiagnostics counters;
+  HaMqttEntity free_heap;
+  HaMqttEntity largest_free_block;
+  HaMqttEntity heap_fragmentation;
+  HaMqttEntity loop_rate;
+  HaMqttEntity publish_successes;
+  HaMqttEntity publish_failures;
+  HaMqttEntity publish_retries;
+  HaMqttEntity reconnects;
+  HaMqttEntity mqtt_buffer_size;
+};
+
+// Steps of the MQTT connection.
+// Each step schedules its publications and the next step starts when they are all published.
+enum MQTT_CONNECTION_STEP {
+  MQTT_STEP_DISCONNECTED, // waiting for the retry delay, then connect
+  MQTT_STEP_CONNECTING,   // waiting for the broker to accept the connection
+  MQTT_STEP_OFFLINE,      // publish the device as offline while entities are updated
+  MQTT_STEP_SUBSCRIBE,    // subscribe to Home Assistant's birth message and all command topics
+  MQTT_STEP_DISCOVERY,    // publish the discovery topics
+  MQTT_STEP_STATE,        // publish the state of all entities
+  MQTT_STEP_ONLINE,       // publish the device as online once, the status is retained
+  MQTT_STEP_READY,
+};
+struct MQTT_CONNECTION {
+  MQTT_CONNECTION_STEP step;
+  bool force_discovery;   // publish discovery topics even if the broker already has them
+  uint32_t retry_delay;   // exponential backoff, in milliseconds
+  DeviceTimer retry_timer; // delay between each connection attempt
+};
+
+// Brokers, in order of preference. Failover brokers are optional in arduino_secrets.h.
+static const BROKER_ENDPOINT mqtt_broker_endpoints[] = {
 #ifdef SECRET_MQTT_SERVER_HOST
-String mqtt_server = SECRET_MQTT_SERVER_HOST;
+  {SECRET_MQTT_SERVER_HOST, MQTT_BROKER_PORT},
 #else
-String mqtt_server = SECRET_MQTT_SERVER_IP;
+  {SECRET_MQTT_SERVER_IP, MQTT_BROKER_PORT},
+#endif
+#ifdef SECRET_MQTT_FAILOVER_SERVER_HOST
+  {SECRET_MQTT_FAILOVER_SERVER_HOST, MQTT_BROKER_PORT},
 #endif
+#ifdef SECRET_MQTT_FAILOVER_SERVER_HOST_2
+  {SECRET_MQTT_FAILOVER_SERVER_HOST_2, MQTT_BROKER_PORT},
+#endif
+};
+static const size_t mqtt_broker_endpoints_count = sizeof(mqtt_broker_endpoints)/sizeof(mqtt_broker_endpoints[0]);
+static_assert(mqtt_broker_endpoints_count <= MQTT_BROKER_MAX_COUNT, "Too many MQTT brokers.");
+
+// Host name resolution of a broker, completed by lwIP's DNS callback
+struct MQTT_BROKER_RESOLUTION {
+  size_t index;         // of the endpoint being resolved
+  bool pending;
+  volatile bool done;
+  volatile uint32_t address;
+  uint32_t start_time;
+  uint32_t generation;  // of the pending lookup, lwIP may call back after the sketch gave up on a previous one
+};
 
 WiFiClient wifi_client;
 SoftTimer hello_timer; //millisecond timer to show a LED flashing animation when booting.
-SoftTimer test_timer; //millisecond timer to force the magnetic ring detection when TEST button is pressed.
-SoftTimer online_on_timer; //millisecond timer to define how long the ONLINE led must be ON.
-SoftTimer online_off_timer; //millisecond timer to define how long the ONLINE led must be OFF.
-SoftTimer activity_off_timer; //millisecond timer to automatically turn off the ACTIVITY led.
-SoftTimer doorbell_ring_delay_timer; //millisecond timer, to delay between each doorbell ring
-SoftTimer identify_delay_timer; //millisecond timer, to delay between each play of the identify RTTTL melody.
-SoftTimer force_publish_timer; //millisecond timer, to force republishing all mqtt data.
+DeviceTimers device_timers; // all timeouts of the device, fired by loop()
+DeviceTimer test_timer; //timer to force the magnetic ring detection when TEST button is pressed.
+DeviceTimer online_on_timer; //timer to define how long the ONLINE led must be ON.
+DeviceTimer online_off_timer; //timer to define how long the ONLINE led must be OFF.
+DeviceTimer activity_off_timer; //timer to automatically turn off the ACTIVITY led.
+DeviceTimer doorbell_ring_delay_timer; //timer, to delay between each doorbell ring
+DeviceTimer identify_delay_timer; //timer, to delay between each play of the identify RTTTL melody.
+DeviceTimer heartbeat_timer; //timer, to publish the device's online status periodically.
+DeviceTimer diagnostics_timer; //timer, to sample the diagnostic sensors periodically.
+MQTT_CONNECTION mqtt_connection;
+BrokerList<MQTT_BROKER_MAX_COUNT> mqtt_brokers;
+MQTT_BROKER_RESOLUTION mqtt_broker_resolution;
+DeviceLog log_buffer; // messages of the LOG_* macros, printed by log_drain()
 
 static const String device_identifier_prefix = "doorbell";
 String device_identifier_postfix;  // matches the last 4 digits of the MAC address
 String device_identifier; // defined as device_identifier_prefix followed by device_identifier_postfix
 
 // MQTT support variables
+#ifdef MQTT_ASYNC_CLIENT
+AsyncMqttClient mqtt_client;
+MqttAdaptorAsyncMqttClient publish_adaptor;
+#else
 PubSubClient mqtt_client(wifi_client);
 MqttAdaptorPubSubClient publish_adaptor;
+#endif
 
 // Home Assistant support variables
 HaMqttDevice this_device;
+MqttCommandDispatcher command_dispatcher; // resolves command topics to entities
+MqttPublishScheduler publish_scheduler;   // paces all entity publications
+ConfigArena config_arena;                 // single heap block for the configuration strings of the device and its entities
 
 LED_STATE led_online;
 LED_STATE led_activity;
 LED_STATE * leds[] = {&led_online, &led_activity};
 size_t leds_count = sizeof(leds)/sizeof(leds[0]);
 
-Button bell_sensor_reader(DOORBELL_PIN);
+// DOORBELL pin edges, pushed by on_doorbell_pin_change() and popped by loop()
+PinEdgeQueue bell_edges;
+volatile bool bell_pin_pressed = false;   // last level pushed to bell_edges
+volatile uint32_t bell_pin_edge_time = 0; // micros() of the last edge pushed to bell_edges
 SMART_BELL_SENSOR bell_sensor;
+MqttEventQueue bell_events(BELL_EVENT_QUEUE_SIZE, MqttEventQueue::OVERFLOW_DROP_OLDEST); // every bell state change, replayed after a disconnection
+#ifdef BELL_EVENT_SPILL_FILE
+MqttEventStoreLittleFS bell_events_store(BELL_EVENT_SPILL_FILE, BELL_EVENT_SPILL_MAX_COUNT);
+#endif
 
 SMART_MELODY_SELECTOR melody_selector;
 
@@ -124,14 +302,101 @@ SMART_BUTTON test_button;
 SMART_SWITCH identify;
 size_t identify_melody_index = 0;
 
+SMART_LATENCY_SENSOR ring_latency;
+
+SMART_BOOT_SENSOR boot_time;
+FastBootCache boot_cache;   // loaded by fast_boot_load(), saved when the device is online
+bool boot_cache_valid = false;
+bool boot_lease_valid = false;  // the cached IP lease may be used without DHCP
+bool boot_lease_reused = false; // this boot connected with the cached IP lease
+uint32_t boot_config_hash = 0;
+bool file_system_mounted = false;
+
+SMART_DIAGNOSTICS diagnostics;
+
+bool ha_birth_detected = false; // set when Home Assistant (re)starts and requires all discovery topics
+
 HaMqttEntity * entities[] = {
   &bell_sensor.entity,
   &melody_selector.entity,
   &test_button.entity,
   &identify.entity,
+  &ring_latency.entity,
+  &boot_time.entity,
+  &diagnostics.free_heap,
+  &diagnostics.largest_free_block,
+  &diagnostics.heap_fragmentation,
+  &diagnostics.loop_rate,
+  &diagnostics.publish_successes,
+  &diagnostics.publish_failures,
+  &diagnostics.publish_retries,
+  &diagnostics.reconnects,
+  &diagnostics.mqtt_buffer_size,
 };
 size_t entities_count = sizeof(entities)/sizeof(entities[0]);
 
+// Definition of each entity of entities[], in the same order.
+// Topics are appended to device_identifier by setup_device(). See HaMqttEntityTable.hpp.
+static constexpr HA_MQTT_ENTITY_DEFINITION entity_definitions[] = {
+  // type                 name            command topic     state topic        more keys
+  {HA_MQTT_BINARY_SENSOR, "Bell",         "",               "/doorbell/state", HA_MQTT_KEY_VALUE("device_class","sound")},
+  {HA_MQTT_SELECT,        "Melody",       "/melody/set",    "/melody/state",   ""},
+  {HA_MQTT_BUTTON,        "Test",         "/test/set",      "/test/set",       ""},
+  {HA_MQTT_SWITCH,        "Identify",     "/identify/set",  "/identify/state", HA_MQTT_KEY_VALUE("device_class","switch")},
+  {HA_MQTT_SENSOR,        "Ring latency", "",               "/latency/state",
+    HA_MQTT_KEY_VALUE("json_attributes_topic","~/latency/attributes")
+    HA_MQTT_KEY_VALUE("device_class","duration")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","ms")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Boot time",    "",               "/boot/state",
+    HA_MQTT_KEY_VALUE("json_attributes_topic","~/boot/attributes")
+    HA_MQTT_KEY_VALUE("device_class","duration")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","ms")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Free heap",    "",               "/heap/free/state",
+    HA_MQTT_KEY_VALUE("device_class","data_size")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","B")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Largest free block", "",         "/heap/block/state",
+    HA_MQTT_KEY_VALUE("device_class","data_size")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","B")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Heap fragmentation", "",         "/heap/fragmentation/state",
+    HA_MQTT_KEY_VALUE("unit_of_measurement","%")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Loop rate",    "",               "/loop/rate/state",
+    HA_MQTT_KEY_VALUE("device_class","frequency")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","Hz")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Publish successes", "",          "/publish/successes/state",
+    HA_MQTT_KEY_VALUE("state_class","total_increasing")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Publish failures", "",           "/publish/failures/state",
+    HA_MQTT_KEY_VALUE("state_class","total_increasing")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "Publish retries", "",            "/publish/retries/state",
+    HA_MQTT_KEY_VALUE("state_class","total_increasing")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "MQTT reconnects", "",            "/mqtt/reconnects/state",
+    HA_MQTT_KEY_VALUE("state_class","total_increasing")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+  {HA_MQTT_SENSOR,        "MQTT buffer size", "",           "/mqtt/buffer/state",
+    HA_MQTT_KEY_VALUE("device_class","data_size")
+    HA_MQTT_KEY_VALUE("unit_of_measurement","B")
+    HA_MQTT_KEY_VALUE("state_class","measurement")
+    HA_MQTT_KEY_VALUE("entity_category","diagnostic")},
+};
+typedef HaMqttEntityTable<sizeof(entity_definitions)/sizeof(entity_definitions[0])> DoorbellEntityTable;
+static_assert(DoorbellEntityTable::isValid(entity_definitions), "Each entity must have a unique name.");
+static_assert(DoorbellEntityTable::hasUniqueTopics(entity_definitions), "Two entities share the same topic.");
+static constexpr DoorbellEntityTable::TABLE entities_table PROGMEM = DoorbellEntityTable::buildTable(entity_definitions);
+const DoorbellEntityTable entity_table(entity_definitions, &entities_table);
+
 HaMqttEntity * subscribable_entities[] = {
   &melody_selector.entity,
   &test_button.entity,
@@ -143,40 +408,31 @@ HaMqttEntity * publishable_entities[] = {
   &bell_sensor.entity,
   &melody_selector.entity,
   &identify.entity,
+  &ring_latency.entity,
+  &boot_time.entity,
+  &diagnostics.free_heap,
+  &diagnostics.largest_free_block,
+  &diagnostics.heap_fragmentation,
+  &diagnostics.loop_rate,
+  &diagnostics.publish_successes,
+  &diagnostics.publish_failures,
+  &diagnostics.publish_retries,
+  &diagnostics.reconnects,
+  &diagnostics.mqtt_buffer_size,
 };
 size_t publishable_entities_count = sizeof(publishable_entities)/sizeof(publishable_entities[0]);
-
-static const char* melodies_array[] PROGMEM = {
-  "None:d=4,o=5,b=900:32p",
-  "Beethoven Fifth Symphony:d=4,o=5,b=125:8p,8g5,8g5,8g5,2d#5",
-  "Coca Cola:d=4,o=5,b=125:8f#6,8f#6,8f#6,8f#6,g6,8f#6,e6,8e6,8a6,f#6,d6",
-  "Duke Nukem (short):d=4,o=5,b=90:16f#4,16a4,16p,16b4,8p,16f#4,16b4,16p,16c#,8p",
-  "Entertaine (short):d=4,o=5,b=140:8d,8d#,8e,c6,8e,c6,8e,2c.6,8c6,8d6,8d#6,8e6,8c6,8d6,e6,8b,d6,2c6",
-  "Flintstones (short):d=4,o=5,b=200:g#,c#,8p,c#6,8a#,g#,c#,8p,g#,8f#,8f,8f,8f#,8g#,c#,d#,2f",
-  "Intel:d=16,o=5,b=320:d,p,d,p,d,p,g,p,g,p,g,p,d,p,d,p,d,p,a,p,a,p,a,2p,d,p,d,p,d,p,g,p,g,p,g,p,d,p,d,p,d,p,a,p,a,p,a,2p",
-  "Mission Impossible - Intro:d=16,o=6,b=95:32d,32d#,32d,32d#,32d,32d#,32d,32d#,32d,32d,32d#,32e,32f,32f#,32g,g",
-  "Mission Impossible (short):d=16,o=6,b=95:a#,g,2d,32p,a#,g,2c#,32p,a#,g,2c,a#5,8c,2p,32p,a#5,g5,2f#,32p,a#5,g5,2f,32p,a#5,g5,2e,d#,8d",
-  "Mosaic-long:d=8,o=6,b=400:c,e,g,e,c,g,e,g,c,g,c,e,c,g,e,g,e,c,p,c5,e5,g5,e5,c5,g5,e5,g5,c5,g5,c5,e5,c5,g5,e5,g5,e5,c5",
-  "Nokia:d=4,o=4,b=180:8e5,8d5,f#,g#,8c#5,8b,d,e,8b,8a,c#,e,2a",
-  "Pacman:d=4,o=5,b=112:32b,32p,32b6,32p,32f#6,32p,32d#6,32p,32b6,32f#6,16p,16d#6,16p,32c6,32p,32c7,32p,32g6,32p,32e6,32p,32c7,32g6,16p,16e6,16p,32b,32p,32b6,32p,32f#6,32p,32d#6,32p,32b6,32f#6,16p,16d#6,16p,32d#6,32e6,32f6,32p,32f6,32f#6,32g6,32p,32g6,32g#6,32a6,32p,32b.6",
-  "Popeye (short):d=8,o=6,b=160:a5,c,c,c,4a#5,a5,4c",
-  "Star Wars - Cantina (short):d=4,o=5,b=250:8a,8p,8d6,8p,8a,8p,8d6,8p,8a,8d6,8p,8a,8p,8g#,a,8a,8g#,8a,g,8f#,8g,8f#,f.,8d.,16p",
-  "Star Wars - Imperial March (short):d=4,o=5,b=100:e,e,e,8c,16p,16g,e,8c,16p,16g,e",
-  "Star Wars (short):d=4,o=5,b=45:32p,32f#,32f#,32f#,8b.,8f#.6,32e6,32d#6,32c#6,8b.6,16f#.6,32e6,32d#6,32c#6,8b.6,16f#.6,32e6,32d#6,32e6,8c#.6",
-  "Super Mario Bros. 1 (short):d=4,o=5,b=100:16e6,16e6,32p,8e6,16c6,8e6,8g6,8p,8g",
-  "Super Mario Bros. 3 Level 1 (short):d=4,o=5,b=80:16g,32c,16g.,16a,32c,16a.,16b,32c,16b,16a.,32g#,16a.,16g,32c,16g.,16a,32c,16a,4b.",
-  "Super Mario Bros. Death:d=4,o=5,b=90:32c6,32c6,32c6,8p,16b,16f6,16p,16f6,16f.6,16e.6,16d6,16c6,16p,16e,16p,16c",
-  "Sweet Child:d=8,o=5,b=140:d,d6,a,g,g6,a,f#6,a,d,d6,a,g,g6,a,8f#6",
-  "The Good the Bad and the Ugly (short):d=4,o=5,b=56:32p,32a#,32d#6,32a#,32d#6,8a#.,16f#.,16g#.,d#",
-  "The Itchy Scratchy Show:d=4,o=5,b=160:8c6,8a,p,8c6,8a6,p,8c6,8a,8c6,8a,8c6,8a6,p,8p,8c6,8d6,8e6,8p,8e6,8f6,8g6,p,8d6,8c6,d6,8f6,a#6,a6,2c7",
-  "Tones:d=8,o=5,b=500:b,16p,b,2p,g,16p,g,2p,d6,16p,d6,2p,d,16p,d.,1p,b,16p,b,2p,g,16p,g,2p,d6,16p,d6,2p,d,16p,d.",
-  "Trio:d=32,o=6,b=320:d#,a#5,d#,a#5,d#,a#5,d#,a#5,d#,a#5,d#,p,g,d#,g,d#,g,d#,g,d#,g,d#,g,p,a#,g,a#,g,a#,g,a#,g,a#,g,a#",
-  "Wolf Whistle:d=16,o=5,b=900:8a4,a#4,b4,c,c#,d,d#,e,f,f#,g,g#,a,a#,b,c6,8c#6,d6,d#6,e6,f6,4p,4p,a4,a#4,b4,c,c#,d,d#,e,f,f#,g,g#,a,a#,b,a#,a,g#,g,f#,f,e,d#,d,c#,c,b4,a#4,a4",
-  "X-Files (short):d=4,o=5,b=125:e,b,a,b,d6,2b.,8p,e,b,a,b,d6,2b.",
-};
-static const size_t melodies_array_count = sizeof(melodies_array) / sizeof(melodies_array[0]);
-static const char* melody_names[melodies_array_count] = {0};
-static const size_t INVALID_MELODY_INDEX = (size_t)-1;
+uint32_t publishable_entities_mask = 0; // bits of publishable_entities in this_device.getDirtyEntities()
+uint32_t diagnostic_entities_mask = 0; // bits of the diagnostics entities, published after everything else
+
+// All melodies and their names stay in flash. See MelodyCatalog.hpp and rtttl_library.h.
+static constexpr size_t melodies_count = countMelodies(rtttl_library_names);
+typedef MelodyCatalog<melodies_count> DoorbellMelodyCatalog;
+static_assert(DoorbellMelodyCatalog::isValid(rtttl_library_names), "Each melody must be named and the catalog must be smaller than 64 KB.");
+static constexpr DoorbellMelodyCatalog::TABLE melodies_table PROGMEM = DoorbellMelodyCatalog::buildTable(rtttl_library_names);
+const DoorbellMelodyCatalog melody_catalog(rtttl_library_names, &melodies_table);
+static const size_t INVALID_MELODY_INDEX = DoorbellMelodyCatalog::INVALID_INDEX;
+static_assert(sizeof(rtttl_library_offsets) / sizeof(rtttl_library_offsets[0]) == melodies_count, "rtttl_library.h must define an offset for each melody name.");
+BinaryMelodyPlayer melody_player;
 
 /*
 class StateChangeNotifyer
@@ -263,32 +519,20 @@ const char * connection_states[] = {"disconnected", "connected"};
 StateChangeNotifyer connection_debugger("connection", connection_states, 2);
 */
 
+// Logs the entry and exit of a scope. Compiled out below LOG_LEVEL_DEBUG.
+// The name must be a literal or __FUNCTION__.
 class ScopeDebugger
 {
 private:
-  String name;
+  const char * name;
 
 public:
   ScopeDebugger(const char * name) {
     this->name = name;
-
-    // Print scope enter message
-    String msg;
-    msg += "<";
-    msg += name;
-    msg += ">";
-    Serial.println(msg);
+    LOG_DEBUG("<%s>", name);
   }
   ~ScopeDebugger() {
-    if (name.isEmpty())
-      return;
-
-    // Print scope leave message
-    String msg;
-    msg += "</";
-    msg += name;
-    msg += ">";
-    Serial.println(msg);
+    LOG_DEBUG("</%s>", name);
   }
 };
 
@@ -299,8 +543,18 @@ public:
 void setup();
 void setup_melody_names();
 void setup_wifi();
+bool setup_wifi_fast();
 void setup_device();
 void setup_mqtt();
+bool mqtt_broker_prepare();
+void mqtt_broker_resolve(size_t index);
+void on_mqtt_broker_resolved(const char * name, const ip_addr_t * ipaddr, void * arg);
+void print_mqtt_broker_report();
+void fast_boot_load();
+void fast_boot_save();
+void fast_boot_fallback();
+void boot_time_ready();
+void serialize_boot_time_attributes(JsonWriter & writer);
 void play_hello_animation();
 void led_turn_on(size_t led_index);
 void led_turn_off(size_t led_index);
@@ -309,25 +563,50 @@ void led_turn_off(LED_STATE * led);
 bool is_digit(const char c);
 bool is_ip_address(const char * value);
 String ip_to_string(const ip_addr_t * ipaddr);
-size_t print_cstr_without_terminating_null(const char* str, size_t length, size_t max_chunk_size);
-bool is_publishable(HaMqttEntity & test_entity);
-bool is_subscribable(HaMqttEntity & test_entity);
+void on_melody_selector_command(HaMqttEntity & entity, const uint8_t * payload, size_t length);
+void on_test_button_command(HaMqttEntity & entity, const uint8_t * payload, size_t length);
+void on_identify_command(HaMqttEntity & entity, const uint8_t * payload, size_t length);
 void mqtt_subscription_callback(const char* topic, const byte* payload, unsigned int length);
-void mqtt_reconnect();
-void mqtt_publish_entities_dirty_state(size_t max = -1);
-void mqtt_publish_entities_discovery();
-void mqtt_force_publish_entities_state();
+void mqtt_connection_set_step(MQTT_CONNECTION_STEP step);
+void mqtt_connection_schedule_retry();
+void mqtt_connection_update();
+bool mqtt_connect();
+void mqtt_schedule_dirty_states();
+void mqtt_schedule_bell_events();
+void set_bell_sensor_state(bool detected);
+void on_publish_result(const MqttPublishScheduler::REQUEST & request, bool success);
 void mqtt_subscribe_all_entities();
 bool parse_boolean(const char * value);
 uint8_t parse_uint8(const char * value);
 String parse_string_without_terminating_null(const uint8_t * buffer, size_t length);
-size_t find_melody_by_name(const char * name);
-size_t find_melody_by_name(const String & name);
-size_t find_melody_by_name(const uint8_t * buffer, size_t length);
-void extract_melody_name(const __FlashStringHelper* str, String & name);
-void extract_melody_name(size_t index, String & name);
+void serialize_melody_names(JsonWriter & writer);
+const uint8_t * get_binary_melody(size_t index);
+IRAM_ATTR bool push_doorbell_edge(uint32_t time, bool pressed);
+IRAM_ATTR void on_doorbell_pin_change();
+void sync_doorbell_pin();
+void ring_latency_start(uint32_t ring_time);
+void ring_latency_record(LatencyHistogram & histogram, bool & pending);
+void ring_latency_update_sensor();
+void serialize_latency_histogram(JsonWriter & writer, const char * name, const LatencyHistogram & histogram);
+void serialize_ring_latency_attributes(JsonWriter & writer);
+bool mqtt_publish_json_attributes(HaMqttEntity & entity, void (*serialize)(JsonWriter & writer));
+void print_latency_histogram(const char * name, const LatencyHistogram & histogram, bool print_buckets);
+void print_ring_latency_report(bool print_buckets);
+#ifndef MQTT_ASYNC_CLIENT
 void increase_mqtt_buffer(uint16_t new_buffer_size = 0);
-void timer_force_timed_out(SoftTimer & timer);
+#endif
+void setup_timers();
+void device_timer_start(DeviceTimer timer, uint32_t delay_ms);
+void on_test_timer();
+void on_online_on_timer();
+void on_online_off_timer();
+void on_activity_off_timer();
+void on_heartbeat_timer();
+void on_diagnostics_timer();
+void set_diagnostic_state(HaMqttEntity & entity, uint32_t value);
+void print_diagnostics_report();
+void loop_idle();
+void log_drain();
 String get_pretty_compilation_date();
 
 //************************************************************
@@ -406,21 +685,21 @@ String ip_to_string(const ip_addr_t * ipaddr) {
 }
 
 void setup_melody_names() {
-  for(size_t i=0; i<melodies_array_count; i++) {
-    // Find the name of this rtttl melody
-    String name;
-    extract_melody_name(i, name);
-
+  LOG_INFO("Found %u melodies.", melody_catalog.getCount());
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  // Hundreds of lines, too many for the log buffer: printed synchronously, which delays the boot
+  char name[LOG_TEXT_SIZE];
+  for(size_t i=0; i<melody_catalog.getCount(); i++) {
+    melody_catalog.getName(i, name, sizeof(name));
     Serial.print("Found melody ");
-    Serial.print(String(i));
+    Serial.print(i);
     Serial.print(": ");
     Serial.println(name);
-
-    melody_names[i] = strdup(name.c_str());
   }
+#endif
 
   // Find our IDENTIFY RTTL melody by name
-  identify_melody_index = find_melody_by_name("Trio");
+  identify_melody_index = melody_catalog.find("Trio");
   if (identify_melody_index == INVALID_MELODY_INDEX)
     identify_melody_index = 1;
 }
@@ -434,11 +713,14 @@ void setup_wifi() {
   Serial.println(wifi_ssid);
 
   WiFi.mode(WIFI_STA);
-  WiFi.begin(wifi_ssid, wifi_pass);
+  boot_time.timings.fast_wifi = (boot_cache_valid && setup_wifi_fast());
+  if (!boot_time.timings.fast_wifi) {
+    WiFi.begin(wifi_ssid, wifi_pass);
 
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(521); // 521 is a good prime number
-    Serial.print(".");
+    while (WiFi.status() != WL_CONNECTED) {
+      delay(521); // 521 is a good prime number
+      Serial.print(".");
+    }
   }
 
   Serial.println();
@@ -464,6 +746,181 @@ void setup_wifi() {
   
   // init random number generator
   randomSeed(micros());
+
+  boot_time.timings.wifi = millis();
+}
+
+// Connects to the cached access point without a scan. The cached IP lease is also used,
+// skipping DHCP, if boot_lease_valid. Returns false, with DHCP enabled again, if the connection
+// is not established quickly.
+bool setup_wifi_fast() {
+#ifdef FAST_BOOT
+  const FAST_BOOT_DATA & data = boot_cache.getData();
+  Serial.print("Fast connect on channel ");
+  Serial.print(data.channel);
+  if (boot_lease_valid) {
+    Serial.print(" with IP address ");
+    Serial.println(IPAddress(data.local_ip));
+    WiFi.config(IPAddress(data.local_ip), IPAddress(data.gateway), IPAddress(data.subnet), IPAddress(data.dns));
+  } else {
+    Serial.println(" with DHCP");
+  }
+  WiFi.begin(wifi_ssid, wifi_pass, data.channel, data.bssid);
+
+  uint32_t start_time = millis();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (millis() - start_time > FAST_BOOT_WIFI_TIMEOUT) {
+      Serial.println(String(ERROR_MESSAGE_PREFIX) + "Fast connect failed, scanning.");
+      WiFi.disconnect();
+      WiFi.config(0u, 0u, 0u); // back to DHCP
+      return false;
+    }
+    delay(10);
+  }
+  boot_lease_reused = boot_lease_valid;
+  return true;
+#else
+  return false;
+#endif
+}
+
+// The IP lease is only reused from the RTC copy: RTC memory is lost with the power, a valid copy
+// means that the device was reset or browned out, not turned off for an unknown time during which
+// the lease may have expired. The copy in flash only skips the scan. Every FAST_BOOT_MAX_LEASE_REUSES
+// boots the lease is renewed with DHCP anyway, in case the DHCP server gave the address to another device.
+void fast_boot_load() {
+  boot_config_hash = FastBootCache::hashConfig(wifi_ssid);
+  for(size_t i=0; i<mqtt_broker_endpoints_count; i++)
+    boot_config_hash = FastBootCache::hashConfig(mqtt_broker_endpoints[i].host, boot_config_hash);
+  boot_cache_valid = false;
+  boot_lease_valid = false;
+  boot_lease_reused = false;
+#ifdef FAST_BOOT
+  if (ESP.rtcUserMemoryRead(FAST_BOOT_RTC_OFFSET, (uint32_t *)&boot_cache.getData(), sizeof(FAST_BOOT_DATA)))
+    boot_cache_valid = boot_cache.isValid(boot_config_hash);
+  boot_lease_valid = (boot_cache_valid && boot_cache.canReuseLease(FAST_BOOT_MAX_LEASE_REUSES));
+#ifdef FAST_BOOT_FILE
+  if (!boot_cache_valid && file_system_mounted) {
+    File file = LittleFS.open(FAST_BOOT_FILE, "r");
+    if (file) {
+      if (file.read((uint8_t *)&boot_cache.getData(), sizeof(FAST_BOOT_DATA)) == sizeof(FAST_BOOT_DATA))
+        boot_cache_valid = boot_cache.isValid(boot_config_hash);
+      file.close();
+    }
+  }
+#endif
+  if (!boot_cache_valid) {
+    boot_cache.clear();
+    Serial.println("No fast boot parameters.");
+  } else {
+    Serial.println(boot_lease_valid ? "Fast boot parameters found." : "Fast boot parameters found, renewing the IP lease.");
+  }
+#endif
+}
+
+// Saves the parameters which reached the broker for the next boot.
+// The flash copy is only written when the network parameters change, not for the count of lease reuses.
+void fast_boot_save() {
+#ifdef FAST_BOOT
+  FastBootCache cache;
+  FAST_BOOT_DATA & data = cache.getData();
+  memcpy(data.bssid, WiFi.BSSID(), sizeof(data.bssid));
+  data.channel = (uint8_t)WiFi.channel();
+  data.local_ip = WiFi.localIP();
+  data.gateway = WiFi.gatewayIP();
+  data.subnet = WiFi.subnetMask();
+  data.dns = WiFi.dnsIP(0);
+  data.broker_index = (uint8_t)mqtt_brokers.getCurrent();
+  data.broker_ip = mqtt_brokers.getAddress(mqtt_brokers.getCurrent());
+  data.lease_reuses = (boot_lease_reused ? boot_cache.getData().lease_reuses + 1 : 0);
+  cache.seal(boot_config_hash);
+
+  bool parameters_changed = (!boot_cache_valid || !cache.hasSameParameters(boot_cache));
+  if (!parameters_changed && cache == boot_cache)
+    return; // nothing changed
+  boot_cache = cache;
+  boot_cache_valid = true;
+  if (!ESP.rtcUserMemoryWrite(FAST_BOOT_RTC_OFFSET, (uint32_t *)&boot_cache.getData(), sizeof(FAST_BOOT_DATA)))
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to save the fast boot parameters to RTC memory.");
+  if (!parameters_changed)
+    return; // only the count of lease reuses
+#ifdef FAST_BOOT_FILE
+  if (file_system_mounted) {
+    File file = LittleFS.open(FAST_BOOT_FILE, "w");
+    if (!file || file.write((const uint8_t *)&boot_cache.getData(), sizeof(FAST_BOOT_DATA)) != sizeof(FAST_BOOT_DATA))
+      Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to save the fast boot parameters to flash.");
+    if (file)
+      file.close();
+  }
+#endif
+  Serial.println("Fast boot parameters saved.");
+#endif
+}
+
+// The broker was not reached with the cached parameters: forget them and take the slow path.
+void fast_boot_fallback() {
+  if (!boot_cache_valid)
+    return;
+  LOG_WARNING("Fast boot parameters rejected, using DHCP and DNS.");
+  boot_cache_valid = false;
+  boot_lease_valid = false;
+  boot_lease_reused = false;
+  boot_cache.clear();
+#ifdef FAST_BOOT
+  ESP.rtcUserMemoryWrite(FAST_BOOT_RTC_OFFSET, (uint32_t *)&boot_cache.getData(), sizeof(FAST_BOOT_DATA));
+#ifdef FAST_BOOT_FILE
+  if (file_system_mounted)
+    LittleFS.remove(FAST_BOOT_FILE);
+#endif
+#endif
+
+  if (boot_time.timings.fast_wifi) {
+    boot_time.timings.fast_wifi = false;
+    WiFi.config(0u, 0u, 0u); // back to DHCP
+    WiFi.reconnect();
+  }
+  if (boot_time.timings.cached_broker) {
+    boot_time.timings.cached_broker = false;
+    for(size_t i=0; i<mqtt_brokers.getCount(); i++)
+      mqtt_brokers.invalidate(i);
+  }
+}
+
+// Called when the device is online in Home Assistant for the first time since boot.
+void boot_time_ready() {
+  BOOT_TIMINGS & timings = boot_time.timings;
+  timings.ready = millis();
+
+  char value[16];
+  sprintf(value, "%lu", (unsigned long)timings.ready);
+  boot_time.entity.setState(value);
+  boot_time.attributes_dirty = true;
+
+  Serial.print("Boot timings: wifi=");
+  Serial.print(timings.wifi);
+  Serial.print(timings.fast_wifi ? "ms (fast)" : "ms (scan)");
+  Serial.print(" setup=");
+  Serial.print(timings.setup);
+  Serial.print("ms mqtt=");
+  Serial.print(timings.mqtt);
+  Serial.print(timings.cached_broker ? "ms (cached)" : "ms");
+  Serial.print(" ready=");
+  Serial.print(timings.ready);
+  Serial.println("ms");
+
+  fast_boot_save();
+}
+
+void serialize_boot_time_attributes(JsonWriter & writer) {
+  const BOOT_TIMINGS & timings = boot_time.timings;
+  writer.beginObject();
+  writer.keyNumber("wifi_ms", timings.wifi);
+  writer.keyNumber("setup_ms", timings.setup);
+  writer.keyNumber("mqtt_ms", timings.mqtt);
+  writer.keyNumber("ready_ms", timings.ready);
+  writer.keyValue("wifi", timings.fast_wifi ? "fast" : "scan");
+  writer.keyValue("broker", timings.cached_broker ? "cached" : "resolved");
+  writer.endObject();
 }
 
 void setup_device() {
@@ -490,66 +947,97 @@ void setup_device() {
   this_device.setHardwareVersion("1.0");
   this_device.setSoftwareVersion(get_pretty_compilation_date() + ", " __TIME__);
   this_device.setMqttAdaptor(&publish_adaptor);
-
-  // Configure DOORBELL entity attributes
-  bell_sensor.entity.setIntegrationType(HA_MQTT_BINARY_SENSOR);
-  bell_sensor.entity.setName("Bell");
-  bell_sensor.entity.setStateTopic(device_identifier + "/doorbell/state");
-  bell_sensor.entity.addKeyValue("device_class","sound");
-  bell_sensor.entity.setDevice(&this_device); // this also adds the entity to the device and generates a unique_id based on the first identifier of the device.
-  bell_sensor.entity.setMqttAdaptor(&publish_adaptor);
-
-  // Configure MELODY_SELECTOR entity attributes
-  melody_selector.entity.setIntegrationType(HA_MQTT_SELECT);
-  melody_selector.entity.setName("Melody");
-  melody_selector.entity.setCommandTopic(device_identifier + "/melody/set");
-  melody_selector.entity.setStateTopic(device_identifier + "/melody/state");
-  melody_selector.entity.addStaticCStrArray("options", melody_names, melodies_array_count);
-  melody_selector.entity.setDevice(&this_device); // this also adds the entity to the device and generates a unique_id based on the first identifier of the device.
-  melody_selector.entity.setMqttAdaptor(&publish_adaptor);
-
-  // Configure test_button entity attributes
-  test_button.entity.setIntegrationType(HA_MQTT_BUTTON);
-  test_button.entity.setName("Test");
-  test_button.entity.setCommandTopic(device_identifier + "/test/set");
-  test_button.entity.setStateTopic(  device_identifier + "/test/set");
-  test_button.entity.setDevice(&this_device); // this also adds the entity to the device and generates a unique_id based on the first identifier of the device.
-  test_button.entity.setMqttAdaptor(&publish_adaptor);
-
-  // Configure identify switch entity attributes
-  identify.entity.setIntegrationType(HA_MQTT_SWITCH);
-  identify.entity.setName("Identify");
-  identify.entity.setCommandTopic(device_identifier + "/identify/set");
-  identify.entity.setStateTopic(device_identifier + "/identify/state");
-  identify.entity.addKeyValue("device_class","switch");
-  identify.entity.setDevice(&this_device); // this also adds the entity to the device and generates a unique_id based on the first identifier of the device.
-  identify.entity.setMqttAdaptor(&publish_adaptor);
+  this_device.setCompactDiscovery(true); // use Home Assistant's abbreviations to reduce discovery payload sizes
+
+  // Configure all entities from entity_definitions
+  if (!entity_table.configure(this_device, entities))
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to configure the entities.");
+  for(size_t i=0; i<entities_count; i++)
+    entities[i]->setMqttAdaptor(&publish_adaptor);
+
+  // Runtime attributes of the entities
+  melody_selector.entity.setCommandHandler(on_melody_selector_command);
+  melody_selector.entity.addArraySerializer("options", serialize_melody_names); // melody names are streamed from flash
+  test_button.entity.setCommandHandler(on_test_button_command);
+  identify.entity.setCommandHandler(on_identify_command);
+
+  // Publish retained states, the broker keeps them for Home Assistant
+  for(size_t i=0; i<publishable_entities_count; i++)
+    publishable_entities[i]->setStateRetained(true);
+
+  // Index all command topics for mqtt_subscription_callback()
+  command_dispatcher.clear();
+  command_dispatcher.addEntities(this_device);
+
+  // Track the publishable entities in the device's dirty set
+  publishable_entities_mask = 0;
+  for(size_t i=0; i<publishable_entities_count; i++) {
+    uint32_t entity_bit = this_device.getEntityBit(publishable_entities[i]);
+    if (entity_bit == 0)
+      Serial.println(String(ERROR_MESSAGE_PREFIX) + "Entity '" + publishable_entities[i]->getName().c_str() + "' is not tracked in the device's dirty set.");
+    publishable_entities_mask |= entity_bit;
+  }
+  HaMqttEntity * diagnostic_entities[] = {
+    &diagnostics.free_heap,
+    &diagnostics.largest_free_block,
+    &diagnostics.heap_fragmentation,
+    &diagnostics.loop_rate,
+    &diagnostics.publish_successes,
+    &diagnostics.publish_failures,
+    &diagnostics.publish_retries,
+    &diagnostics.reconnects,
+    &diagnostics.mqtt_buffer_size,
+  };
+  diagnostic_entities_mask = 0;
+  for(size_t i=0; i<sizeof(diagnostic_entities)/sizeof(diagnostic_entities[0]); i++)
+    diagnostic_entities_mask |= this_device.getEntityBit(diagnostic_entities[i]);
+
+  // The configuration does not change anymore, move all its strings to a single heap block
+  if (packConfiguration(this_device, config_arena)) {
+    Serial.print("Configuration packed in ");
+    Serial.print(config_arena.getCapacity());
+    Serial.println(" bytes.");
+  } else {
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to pack the configuration.");
+  }
 }
 
 void setup_mqtt() {
-  // Convert MQTT server host to an IP, if required.
-  if (!is_ip_address(mqtt_server.c_str())) {
-    String host = mqtt_server;
-    Serial.println("Resolving IP address of '" + host + "'.");
-
-    // resolve ip address of host name
-    IPAddress remote_ip;
-    remote_ip.clear();
-    if (WiFi.hostByName(host.c_str(), remote_ip) == 1) {
-      mqtt_server = remote_ip.toString(); // override host name with actual IP address
-      Serial.println("Found IP address '" + mqtt_server + "'.");
-    } else {
-      Serial.println("Failed to resolve IP. Keeping hostname for connection...");
-    }
+  // Brokers are resolved in the background before connecting, see mqtt_broker_prepare()
+  mqtt_brokers.setTtl(MQTT_BROKER_DNS_TTL);
+  mqtt_brokers.setResolveAfterFailures(MQTT_BROKER_RESOLVE_AFTER_FAILURES);
+  mqtt_brokers.setFailoverAfterFailures(MQTT_BROKER_FAILOVER_AFTER_FAILURES);
+  mqtt_brokers.setDecayPeriod(MQTT_BROKER_FAILURE_DECAY);
+  for(size_t i=0; i<mqtt_broker_endpoints_count; i++)
+    mqtt_brokers.add(mqtt_broker_endpoints[i]);
+  mqtt_broker_resolution.pending = false;
+  mqtt_broker_resolution.generation = 0;
+
+  // Start with the broker address of the previous boot instead of a DNS lookup
+  const FAST_BOOT_DATA & data = boot_cache.getData();
+  if (boot_cache_valid && data.broker_ip != 0 && data.broker_index < mqtt_brokers.getCount()) {
+    mqtt_brokers.setResolved(data.broker_index, data.broker_ip, millis());
+    boot_time.timings.cached_broker = true;
+    Serial.print("Using cached IP address ");
+    Serial.print(IPAddress(data.broker_ip));
+    Serial.print(" of '");
+    Serial.print(mqtt_brokers.getEndpoint(data.broker_index).host);
+    Serial.println("'.");
   }
 
-  Serial.println("MQTT server IP address set to '" + mqtt_server + "'.");
-  mqtt_client.setServer(mqtt_server.c_str(), 1883);
-  mqtt_client.setCallback(mqtt_subscription_callback);
   mqtt_client.setKeepAlive(30);
+#ifdef MQTT_ASYNC_CLIENT
+  // QoS 0 and no publish handler: publish() returns true once the packet is in the TCP send buffer,
+  // so bell events leave bell_events before the broker has them. See the README.
+  publish_adaptor.setMessageHandler(mqtt_subscription_callback);
+#else
+  mqtt_client.setCallback(mqtt_subscription_callback);
+  mqtt_client.setSocketTimeout(5); // bound the time a connection attempt blocks loop()
   
   // Changing default buffer size. If buffer is too small, publishing and notifications are discarded.
-  increase_mqtt_buffer(2048);
+  // Discovery payloads are streamed and do not need to fit in the buffer. Only states and commands do.
+  increase_mqtt_buffer(512);
+#endif
 }
 
 bool is_printable(const byte* payload, unsigned int length) {
@@ -560,271 +1048,387 @@ bool is_printable(const byte* payload, unsigned int length) {
   return true;
 }
 
-size_t print_cstr_without_terminating_null(const char* str, size_t length, size_t max_chunk_size) {
-  // Allocate memory for chunks
-  char * chunk_buffer = new char[max_chunk_size];
-  if (chunk_buffer == NULL)
-    return (size_t)-1;
-  
-  size_t printed_length = 0;
-  while(printed_length < length) {
-    // Compute how much byte remains to be printed
-    size_t remains = length - printed_length;
-    if (remains == 0)
-      return printed_length;
-    
-    // Compute how much we can print as a single chumk
-    size_t chunk_size = (max_chunk_size - 1); // default maximum chunk size
-    if (remains < chunk_size) {
-      chunk_size = remains;
-    }
-    
-    // Grab next print chunk
-    size_t offset = printed_length;
-    memcpy(chunk_buffer, &str[offset], chunk_size);
-
-    // Make it safe to print
-    chunk_buffer[chunk_size] = '\0';
+void on_melody_selector_command(HaMqttEntity & entity, const uint8_t * payload, size_t length) {
+  size_t melody_name_index = INVALID_MELODY_INDEX;
+  if (is_printable(payload, length))
+    melody_name_index = melody_catalog.find(payload, length);
 
-    // Print it
-    Serial.print(chunk_buffer);
-    printed_length += chunk_size;
+  if (melody_name_index == INVALID_MELODY_INDEX) {
+    LOG_WARNING("MQTT error: unknown melody.");
+    return;
   }
 
-  return printed_length;
+  melody_selector.state.selected_melody = melody_name_index;
+  String name;
+  melody_catalog.getName(melody_selector.state.selected_melody, name);
+  melody_selector.entity.setState(name);
 }
 
-bool is_publishable(HaMqttEntity & test_entity)
-{
-  for(size_t i=0; i<publishable_entities_count; i++) {
-    HaMqttEntity & entity = *(publishable_entities[i]);
-    if (&entity == &test_entity)
-      return true;
-  }
-  return false;
-}
+void on_test_button_command(HaMqttEntity & entity, const uint8_t * payload, size_t length) {
+  // Interrupt what ever we are playing.
+  if (melody_player.isPlaying())
+    melody_player.stop();
 
-bool is_subscribable(HaMqttEntity & test_entity)
-{
-  for(size_t i=0; i<subscribable_entities_count; i++) {
-    HaMqttEntity & entity = *(subscribable_entities[i]);
-    if (&entity == &test_entity)
-      return true;
-  }
-  return false;
+  // Apply command
+  test_button.state.is_pressed = true;
+  device_timer_start(test_timer, TEST_BUTTON_DURATION); // when the timer expires, the state will change to false
 }
 
-void mqtt_subscription_callback(const char* topic, const byte* payload, unsigned int length) {
-  Serial.print("MQTT notify: ");
-  Serial.print(length);
-  Serial.print(" bytes. topic=");
-  Serial.print(topic);
-
-  bool printable = is_printable(payload, length);
-  if (!printable) {
-    Serial.println();
-  } else {
-    Serial.print(" payload=");
-    print_cstr_without_terminating_null((const char*)payload, length, 256);
-    Serial.println();
-  }
+void on_identify_command(HaMqttEntity & entity, const uint8_t * payload, size_t length) {
+  // Interrupt what ever we are playing.
+  if (melody_player.isPlaying())
+    melody_player.stop();
 
-  // Is this a MELODY selector command topic?
-  if (melody_selector.entity.getCommandTopic() == topic) {
-    if (printable) {
-      size_t melody_name_index = find_melody_by_name(payload, length);
-      if (melody_name_index != INVALID_MELODY_INDEX) {
-        melody_selector.state.selected_melody = melody_name_index;
-        melody_selector.entity.setState(melody_names[melody_selector.state.selected_melody]);
+  String value = parse_string_without_terminating_null(payload, length);
 
-        return; // this topic is handled
-      }
-    }
+  // Apply command
+  bool turn_on = parse_boolean(value.c_str());
+  if (turn_on != identify.state.is_on) {
+    // the state has changed
+    identify.state.is_on = turn_on;
+    identify.entity.setState((identify.state.is_on ? "ON" : "OFF"));
   }
+}
 
-  // Is this a TEST button command topic?
-  if (test_button.entity.getCommandTopic() == topic) {
-    // Interrupt what ever we are playing.
-    if (anyrtttl::nonblocking::isPlaying())
-      anyrtttl::nonblocking::stop();
-
-    // Apply command
-    test_button.state.is_pressed = true;
-    test_timer.reset(); // start test timer, when the timer expires, the state will change to false
+void mqtt_subscription_callback(const char* topic, const byte* payload, unsigned int length) {
+  if (is_printable(payload, length))
+    LOG_INFO("MQTT notify: %u bytes. topic=%t payload=%t", length, log_text(topic), log_text((const char*)payload, length));
+  else
+    LOG_INFO("MQTT notify: %u bytes. topic=%t", length, log_text(topic));
 
+  // Is this an entity command topic?
+  if (command_dispatcher.dispatch(topic, payload, length))
     return; // this topic is handled
-  }
-
-  // Is this the IDENTIFY switch command topic?
-  if (identify.entity.getCommandTopic() == topic) {
-    // Interrupt what ever we are playing.
-    if (anyrtttl::nonblocking::isPlaying())
-      anyrtttl::nonblocking::stop();
 
+  // Is this Home Assistant's birth message?
+  if (ha_status_topic == topic) {
     String value = parse_string_without_terminating_null(payload, length);
-
-    // Apply command
-    bool turn_on = parse_boolean(value.c_str());
-    if (turn_on != identify.state.is_on) {
-      // the state has changed
-      identify.state.is_on = turn_on;
-      identify.entity.setState((identify.state.is_on ? "ON" : "OFF"));
-    }
+    if (value == ha_availability_online)
+      ha_birth_detected = true; // discovery is published from loop(), outside of PubSubClient's callback
 
     return; // this topic is handled
   }
 
-  Serial.print(String(ERROR_MESSAGE_PREFIX) + "MQTT error: unknown topic: ");
-  Serial.println(topic);
+  LOG_WARNING("MQTT error: unknown topic: %t", log_text(topic));
 }
 
-void mqtt_reconnect() {
-  ScopeDebugger scope_debugger(__FUNCTION__);
+void mqtt_connection_set_step(MQTT_CONNECTION_STEP step) {
+  mqtt_connection.step = step;
 
-  // Loop until we're reconnected
-  while (!mqtt_client.connected()) {
-    led_turn_off(&led_online);
-
-    Serial.print("Attempting MQTT connection... ");
-
-    bool connect_success = false;
-
-    // Attempt to connect
-    MqttLastWillAndTestament lwt;
-    if (this_device.getLastWillAndTestamentInfo(lwt)) {
-      // Connect and setup an MQTT Last Will and Testament
-      connect_success = mqtt_client.connect(
-          device_identifier.c_str(),
-          mqtt_user,
-          mqtt_pass,
-          lwt.topic.c_str(),
-          lwt.qos,
-          lwt.retain,
-          lwt.payload.c_str());
-    } else {
-      // Connect normally
-      connect_success = mqtt_client.connect(device_identifier.c_str(), mqtt_user, mqtt_pass);
-    }
-    
-    if (connect_success) {
-      Serial.print("connected as '");
-      Serial.print(device_identifier.c_str());
-      Serial.println("'.");
-    } else {
-      Serial.print("failed, mqtt-state=");
-      Serial.print(mqtt_client.state());
-      Serial.println(" try again in 5 seconds");
-      // Wait 5 seconds before retrying
-      delay(5000);
-    }
-
-    // Do initialization stuff when we first connect.
-    if (mqtt_client.connected()) {
-      
-      bool success = false;
+  // The publications of the connection steps are batched: fewer, larger writes to the network.
+  // They are all published again if the connection drops before the device is ready.
+  bool connecting = (step != MQTT_STEP_DISCONNECTED && step != MQTT_STEP_READY);
+  publish_scheduler.setBatchAdaptor(connecting ? &publish_adaptor : NULL, MQTT_BATCH_MAX_PUBLICATIONS);
+}
 
-      // Set device as "offline" while we update all entity states.
-      // This will "disable" all entities in Home Assistant while we update.
-      this_device.publishMqttDeviceStatus(false);
+void mqtt_connection_schedule_retry() {
+  // Exponential backoff with jitter: wait between half and all of the current delay,
+  // so that many devices restarted together do not reconnect all at once.
+  uint32_t delay_ms = mqtt_connection.retry_delay / 2 + random(mqtt_connection.retry_delay / 2 + 1);
+  device_timer_start(mqtt_connection.retry_timer, delay_ms);
 
-      // Subscribe to all entities to receive commands from Home Assistant
-      mqtt_subscribe_all_entities();
+  mqtt_connection.retry_delay *= 2;
+  if (mqtt_connection.retry_delay > MQTT_RETRY_DELAY_MAX)
+    mqtt_connection.retry_delay = MQTT_RETRY_DELAY_MAX;
 
-      // Force publish all entities discovery by Home Assistant.
-      mqtt_publish_entities_discovery();
+  // The broker was never reached since boot, the fast boot parameters may be stale
+  if (boot_time.timings.mqtt == 0)
+    fast_boot_fallback();
 
-      // Force all entities to be published to initialize Home Assistant UI
-      // This also sets the device as back "online"
-      mqtt_force_publish_entities_state();
+  LOG_INFO("Trying MQTT connection again in %u ms.", delay_ms);
+}
 
-      led_turn_on(&led_online);
-      online_on_timer.reset();  //start counting now
+// Selects the broker of the next connection attempt and sets its address to the MQTT client.
+// A host name which was never resolved, whose TTL expired or which failed repeatedly is resolved
+// in the background first. Returns false while the resolution is in progress, or when the broker
+// has no address: the attempt is counted as failed and retried later, the client never resolves
+// the host name itself since that would block loop().
+bool mqtt_broker_prepare() {
+  uint32_t now = millis();
+  MQTT_BROKER_RESOLUTION & resolution = mqtt_broker_resolution;
+  if (resolution.pending) {
+    if (!resolution.done && now - resolution.start_time < MQTT_BROKER_DNS_TIMEOUT)
+      return false;
+    resolution.pending = false;
+    mqtt_brokers.setResolved(resolution.index, (resolution.done ? resolution.address : 0), now);
+    if (!resolution.done || resolution.address == 0)
+      LOG_ERROR("Failed to resolve '%s'.", mqtt_brokers.getEndpoint(resolution.index).host);
+  } else {
+    size_t index = mqtt_brokers.select(now);
+    if (index == mqtt_brokers.INVALID_INDEX)
+      return false;
+    if (mqtt_brokers.needsResolve(index, now)) {
+      mqtt_broker_resolve(index);
+      if (resolution.pending)
+        return false;
     }
-    
   }
+
+  size_t index = mqtt_brokers.getCurrent();
+  const BROKER_ENDPOINT & endpoint = mqtt_brokers.getEndpoint(index);
+  uint32_t address = mqtt_brokers.getAddress(index);
+  if (address == 0) {
+    LOG_ERROR("MQTT broker '%s' has no address.", endpoint.host);
+    mqtt_brokers.onConnectFailed(now); // fails over to the next broker after a few attempts
+    mqtt_connection_schedule_retry();
+    return false;
+  }
+  LOG_INFO("MQTT broker '%s' at %a.", endpoint.host, address);
+  mqtt_client.setServer(IPAddress(address), endpoint.port);
+  return true;
 }
 
-void mqtt_publish_entities_dirty_state(size_t max) {
-  size_t published_count = 0;
-  for(size_t i=0; i<publishable_entities_count; i++) {
-    HaMqttEntity & entity = *(publishable_entities[i]);
-
-    // Publish entity's state if dirty to refresh Home Assistant UI
-    if (entity.getState().isDirty()) {
-      bool success = false;
-      for(size_t i=0; i<MAX_PUBLISH_RETRY && !success; i++) {
-        success = entity.publishMqttState();
-        if (mqtt_client.connected() && !success) {
-          // try to increase the mqtt buffer size and try again.
-          increase_mqtt_buffer();
-        }
-      }
+void mqtt_broker_resolve(size_t index) {
+  MQTT_BROKER_RESOLUTION & resolution = mqtt_broker_resolution;
+  const char * host = mqtt_brokers.getEndpoint(index).host;
+  LOG_INFO("Resolving IP address of '%s'.", host);
+  if (boot_time.timings.mqtt == 0)
+    boot_time.timings.cached_broker = false;
+
+  resolution.index = index;
+  resolution.done = false;
+  resolution.address = 0;
+  resolution.start_time = millis();
+  resolution.generation++;
+
+  ip_addr_t address;
+  err_t error = dns_gethostbyname(host, &address, on_mqtt_broker_resolved, (void *)(uintptr_t)resolution.generation);
+  if (error == ERR_INPROGRESS) {
+    resolution.pending = true; // on_mqtt_broker_resolved() is called later
+    return;
+  }
+  mqtt_brokers.setResolved(index, (error == ERR_OK ? (uint32_t)IPAddress(&address) : 0), millis());
+}
 
-      // Limit publishing max entity state per call.
-      published_count++;
-      if (published_count == max)
-        return;
+// Called by lwIP. Only records the result, mqtt_broker_prepare() applies it.
+// arg is the generation of the lookup: the result of a lookup which timed out is ignored.
+void on_mqtt_broker_resolved(const char * name, const ip_addr_t * ipaddr, void * arg) {
+  MQTT_BROKER_RESOLUTION & resolution = mqtt_broker_resolution;
+  if (!resolution.pending || (uint32_t)(uintptr_t)arg != resolution.generation)
+    return;
+  resolution.address = (ipaddr ? (uint32_t)IPAddress(ipaddr) : 0);
+  resolution.done = true;
+}
 
-      // Allow time for Home Assistant to properly 'discover' the previous entity
-      #ifdef DELAY_BETWEEN_MQTT_TRANSACTIONS
-      delay(DELAY_BETWEEN_MQTT_TRANSACTIONS);
-      #endif
-    }
+void print_mqtt_broker_report() {
+  const BrokerList<MQTT_BROKER_MAX_COUNT>::STATS & stats = mqtt_brokers.getStats();
+  uint32_t now = millis();
+  for(size_t i=0; i<mqtt_brokers.getCount(); i++) {
+    Serial.print(i == mqtt_brokers.getCurrent() ? "* " : "  ");
+    Serial.print(mqtt_brokers.getEndpoint(i).host);
+    Serial.print(" address=");
+    Serial.print(IPAddress(mqtt_brokers.getAddress(i)));
+    Serial.print(" failures=");
+    Serial.println(mqtt_brokers.getFailures(i, now));
   }
+  Serial.print("MQTT brokers: connections=");
+  Serial.print(stats.connections);
+  Serial.print(" failures=");
+  Serial.print(stats.failures);
+  Serial.print(" failovers=");
+  Serial.print(stats.failovers);
+  Serial.print(" resolutions=");
+  Serial.print(stats.resolutions);
+  Serial.print(" resolve_failures=");
+  Serial.println(stats.resolve_failures);
 }
 
-void mqtt_force_publish_entities_state() {
-  ScopeDebugger scope_debugger(__FUNCTION__);
+bool mqtt_connect() {
+  LOG_INFO("Attempting MQTT connection...");
+
+#ifdef MQTT_ASYNC_CLIENT
+  // The connection completes in the background, see MQTT_STEP_CONNECTING
+  MqttLastWillAndTestament lwt;
+  bool has_lwt = this_device.getLastWillAndTestamentInfo(lwt);
+  bool connect_started = publish_adaptor.connect(device_identifier.c_str(), mqtt_user, mqtt_pass, (has_lwt ? &lwt : NULL));
+  if (!connect_started)
+    LOG_ERROR("MQTT connection failed to start.");
+  return connect_started;
+#else
+  bool connect_success = false;
+
+  // Attempt to connect
+  MqttLastWillAndTestament lwt;
+  if (this_device.getLastWillAndTestamentInfo(lwt)) {
+    // Connect and setup an MQTT Last Will and Testament
+    connect_success = mqtt_client.connect(
+        device_identifier.c_str(),
+        mqtt_user,
+        mqtt_pass,
+        lwt.topic.c_str(),
+        lwt.qos,
+        lwt.retain,
+        lwt.payload.c_str());
+  } else {
+    // Connect normally
+    connect_success = mqtt_client.connect(device_identifier.c_str(), mqtt_user, mqtt_pass);
+  }
 
-  Serial.println("Forcing all entities to be published again...");
+  if (connect_success)
+    LOG_INFO("MQTT connected as '%t'.", log_text(device_identifier.c_str(), device_identifier.length()));
+  else
+    LOG_ERROR("MQTT connection failed, mqtt-state=%d.", mqtt_client.state());
+  return connect_success;
+#endif
+}
 
-  // Set dirty bit to all entities
-  for(size_t i=0; i<publishable_entities_count; i++) {
-    HaMqttEntity & entity = *(publishable_entities[i]);
-    entity.getState().setDirty();
+void mqtt_connection_update() {
+  // Did we lose the connection?
+  if (mqtt_connection.step != MQTT_STEP_DISCONNECTED && !publish_adaptor.connected() && !publish_adaptor.connecting()) {
+    LOG_ERROR("MQTT connection lost.");
+    led_turn_off(&led_online);
+    device_timers.stop(online_on_timer);
+    device_timers.stop(online_off_timer);
+    device_timers.stop(heartbeat_timer);
+    publish_scheduler.clear();
+    if (mqtt_connection.step == MQTT_STEP_CONNECTING)
+      mqtt_brokers.onConnectFailed(millis()); // the asynchronous connection attempt failed
+    if (mqtt_connection.step != MQTT_STEP_READY && mqtt_connection.step != MQTT_STEP_CONNECTING)
+      mqtt_connection.force_discovery = true; // the last batch of discovery topics may be lost
+    mqtt_connection_set_step(MQTT_STEP_DISCONNECTED);
+    mqtt_connection_schedule_retry();
+    return;
   }
 
-  // Publish them all
-  mqtt_publish_entities_dirty_state();
+  if (mqtt_connection.step == MQTT_STEP_READY)
+    return;
+  if (mqtt_connection.step == MQTT_STEP_DISCONNECTED) {
+    if (device_timers.isPending(mqtt_connection.retry_timer))
+      return;
+    if (!mqtt_broker_prepare())
+      return; // resolving the broker's host name
+    if (!mqtt_connect()) {
+      mqtt_brokers.onConnectFailed(millis());
+      mqtt_connection_schedule_retry();
+      return;
+    }
+    mqtt_connection_set_step(MQTT_STEP_CONNECTING);
+  }
+  if (mqtt_connection.step == MQTT_STEP_CONNECTING) {
+    if (!publish_adaptor.connected())
+      return; // an asynchronous connection is in progress
+#ifdef MQTT_ASYNC_CLIENT
+    LOG_INFO("MQTT connected as '%t'.", log_text(device_identifier.c_str(), device_identifier.length()));
+#endif
+    mqtt_connection.retry_delay = MQTT_RETRY_DELAY_MIN;
+    mqtt_brokers.onConnected(millis());
+    diagnostics.counters.onConnected();
+    if (boot_time.timings.mqtt == 0)
+      boot_time.timings.mqtt = millis();
+    mqtt_connection_set_step(MQTT_STEP_OFFLINE);
+  }
 
-  // Also force publish the device as "online" status.
-  // Home assistant has issue detecting the 'online' state.
-  // Update the status again a few times to prevent this issue as much as possible.
-  for(size_t i=0; i<3; i++) {
-    this_device.publishMqttDeviceStatus(true);
-    
-    #ifdef DELAY_BETWEEN_MQTT_TRANSACTIONS
-    delay(DELAY_BETWEEN_MQTT_TRANSACTIONS);
-    #endif
+  // Wait for the publications of the previous step
+  if (!publish_scheduler.isEmpty())
+    return;
+
+  switch(mqtt_connection.step) {
+  case MQTT_STEP_OFFLINE:
+    // Set device as "offline" while we update all entity states.
+    // This will "disable" all entities in Home Assistant while we update.
+    publish_scheduler.scheduleDeviceStatus(&this_device, false, MqttPublishScheduler::PRIORITY_URGENT);
+    mqtt_connection_set_step(MQTT_STEP_SUBSCRIBE);
+    break;
+  case MQTT_STEP_SUBSCRIBE:
+    // Subscribe to all entities to receive commands from Home Assistant
+    mqtt_subscribe_all_entities();
+    mqtt_connection_set_step(MQTT_STEP_DISCOVERY);
+    break;
+  case MQTT_STEP_DISCOVERY:
+    // Publish all entities discovery by Home Assistant.
+    // Discovery topics are retained, only the ones that changed since the last connection are published again.
+    for(size_t i=0; i<entities_count; i++) {
+      if (mqtt_connection.force_discovery || !entities[i]->isDiscoveryPublished())
+        publish_scheduler.scheduleDiscovery(entities[i]);
+    }
+    mqtt_connection.force_discovery = false;
+    mqtt_connection_set_step(MQTT_STEP_STATE);
+    break;
+  case MQTT_STEP_STATE:
+    // Force all entities to be published to initialize Home Assistant UI
+    for(size_t i=0; i<publishable_entities_count; i++)
+      publishable_entities[i]->getState().setDirty();
+    mqtt_schedule_dirty_states();
+    mqtt_connection_set_step(MQTT_STEP_ONLINE);
+    break;
+  case MQTT_STEP_ONLINE:
+    // Set the device back "online". The status is retained like the "offline" last will,
+    // Home Assistant gets the right status even if it restarts later.
+    publish_scheduler.scheduleDeviceStatus(&this_device, true);
+    mqtt_connection_set_step(MQTT_STEP_READY);
+    device_timer_start(heartbeat_timer, HEARTBEAT_PERIOD);
+    led_turn_on(&led_online);
+    device_timer_start(online_on_timer, ONLINE_LED_ON_TIME);
+    if (boot_time.timings.ready == 0)
+      boot_time_ready();
+    break;
+  default:
+    break;
+  };
+}
+
+void mqtt_schedule_dirty_states() {
+  uint32_t dirty_entities = this_device.getDirtyEntities() & publishable_entities_mask;
+  if (!bell_events.isEmpty())
+    dirty_entities &= ~this_device.getEntityBit(&bell_sensor.entity); // the last event publishes the bell state
+  if (dirty_entities == 0)
+    return; // nothing changed, most loops end here
+
+  const HaMqttDevice::EntityPtrVector & device_entities = this_device.getEntities();
+  while (dirty_entities != 0) {
+    size_t index = __builtin_ctz(dirty_entities);
+    dirty_entities &= dirty_entities - 1; // clear the lowest bit
+    HaMqttEntity * entity = device_entities[index];
+
+    // A bell ring is published before anything else
+    uint8_t priority = MqttPublishScheduler::PRIORITY_STATE;
+    if (entity == &bell_sensor.entity)
+      priority = MqttPublishScheduler::PRIORITY_URGENT;
+    else if (diagnostic_entities_mask & (1UL << index))
+      priority = MqttPublishScheduler::PRIORITY_DIAGNOSTIC;
+    publish_scheduler.scheduleState(entity, priority);
   }
 }
 
-void mqtt_publish_entities_discovery() {
-  ScopeDebugger scope_debugger(__FUNCTION__);
+// Bell events are replayed once Home Assistant knows the device is online.
+void mqtt_schedule_bell_events() {
+  if (mqtt_connection.step == MQTT_STEP_READY && !bell_events.isEmpty())
+    publish_scheduler.scheduleEvents(&bell_events);
+}
 
-  for(size_t i=0; i<entities_count; i++) {
-    HaMqttEntity & entity = *(entities[i]);
+void set_bell_sensor_state(bool detected) {
+  if (detected && !bell_sensor.state.detected)
+    bell_sensor.new_ring = true;
+  bell_sensor.state.detected = detected;
+  const char * value = (detected ? "ON" : "OFF");
+  bell_sensor.entity.setState(value);
+  if (!bell_events.push(&bell_sensor.entity, value, millis()))
+    LOG_ERROR("Bell event dropped.");
+}
 
-    // Publish Home Assistant mqtt discovery topic
-    bool success = false;
-    for(size_t i=0; i<MAX_PUBLISH_RETRY && !success; i++) {
-      success = entity.publishMqttDiscovery();
-      if (mqtt_client.connected() && !success) {
-        // try to increase the mqtt buffer size and try again.
-        increase_mqtt_buffer();
-      }
+void on_publish_result(const MqttPublishScheduler::REQUEST & request, bool success) {
+  diagnostics.counters.onPublishResult(success, request.failures);
+  if (!success) {
+    LOG_WARNING("MQTT publish failure: request type=%u attempt=%u.", request.type, request.failures);
+#ifndef MQTT_ASYNC_CLIENT
+    if (mqtt_client.connected()) {
+      // try to increase the mqtt buffer size and try again.
+      increase_mqtt_buffer();
     }
-
-    // Allow time for Home Assistant to send updates, if any
-    #ifdef DELAY_BETWEEN_MQTT_TRANSACTIONS
-    delay(DELAY_BETWEEN_MQTT_TRANSACTIONS);
-    #endif
+#endif
+    return;
   }
+
+  if (request.type == MqttPublishScheduler::PUBLISH_EVENTS && request.events == &bell_events)
+    ring_latency_record(ring_latency.state.publish_latency, ring_latency.state.publish_pending);
 }
 
 void mqtt_subscribe_all_entities() {
   ScopeDebugger scope_debugger(__FUNCTION__);
 
+  // Subscribe to Home Assistant's birth message to know when discovery must be published again
+  publish_adaptor.subscribe(ha_status_topic.c_str());
+
   for(size_t i=0; i<subscribable_entities_count; i++) {
     HaMqttEntity & entity = *(subscribable_entities[i]);
 
@@ -872,50 +1476,157 @@ String parse_string_without_terminating_null(const uint8_t * buffer, size_t leng
   return str;
 }
 
-size_t find_melody_by_name(const char * name) { return find_melody_by_name(String(name)); }
-size_t find_melody_by_name(const String & name) {
-  for(size_t i=0; i<melodies_array_count; i++) {
-    const char * melody = melody_names[i];
-    if (name == melody) {
-      return i;
-    }
-  }
-  return INVALID_MELODY_INDEX;
+void serialize_melody_names(JsonWriter & writer) {
+  melody_catalog.serializeNames(writer);
+}
+
+const uint8_t * get_binary_melody(size_t index) {
+  if (index >= melody_catalog.getCount())
+    return NULL;
+  return rtttl_library_data + pgm_read_word(&rtttl_library_offsets[index]);
+}
+
+IRAM_ATTR bool push_doorbell_edge(uint32_t time, bool pressed) {
+  if (pressed == bell_pin_pressed || time - bell_pin_edge_time < DOORBELL_DEBOUNCE_TIME_US)
+    return false; // same level or contact bounce
+  PIN_EDGE edge = {time, pressed};
+  if (!bell_edges.push(edge))
+    return false; // queue is full, sync_doorbell_pin() will push the level later
+  bell_pin_pressed = pressed;
+  bell_pin_edge_time = time;
+  return true;
 }
-size_t find_melody_by_name(const uint8_t * buffer, size_t length) {
-  if (length == 0)
-    return INVALID_MELODY_INDEX;
-  
-  // Build a valid String from the first 'length' bytes of the given buffer
-  String test = parse_string_without_terminating_null(buffer, length);
 
-  // Now search using a String
-  return find_melody_by_name(test);
+IRAM_ATTR void on_doorbell_pin_change() {
+  // The magnetic sensor pulls the pin LOW when the bell rings
+  push_doorbell_edge(micros(), digitalRead(DOORBELL_PIN) == LOW);
 }
 
-void extract_melody_name(const __FlashStringHelper* str, String & name) {
-  name.clear();
-  if (str == NULL)
+void sync_doorbell_pin() {
+  // The interrupt misses the final level if the pin settles during the debounce time
+  // or if the queue was full. Push it from here with interrupts disabled, so that
+  // the queue still has a single producer.
+  noInterrupts();
+  push_doorbell_edge(micros(), digitalRead(DOORBELL_PIN) == LOW);
+  interrupts();
+}
+
+void ring_latency_start(uint32_t ring_time) {
+  RING_LATENCY_STATE & state = ring_latency.state;
+  state.ring_time = ring_time;
+  state.state_pending = true;
+  state.chime_pending = true;
+  state.publish_pending = true;
+}
+
+void ring_latency_record(LatencyHistogram & histogram, bool & pending) {
+  if (!pending)
     return;
+  histogram.record(micros() - ring_latency.state.ring_time);
+  pending = false;
 
-  const char * buffer = (const char *)str; // temporary storage type to allow buffer++
-  char c;
-  c = pgm_read_byte_near(buffer);
-  while(c != '\0' && c != ':') {
-    name += c;
-    buffer++;
-    c = pgm_read_byte_near(buffer);
-  }
+  // Home Assistant knows about the ring, report the new latencies
+  if (&histogram == &ring_latency.state.publish_latency)
+    ring_latency_update_sensor();
 }
 
-void extract_melody_name(size_t index, String & name) {
-  name.clear();
-  if (index >= melodies_array_count)
+void ring_latency_update_sensor() {
+  // The sensor's state is the 95th percentile of the ring to Home Assistant latency, in milliseconds
+  uint32_t p95 = ring_latency.state.publish_latency.getPercentile(95);
+  char value[16];
+  sprintf(value, "%lu.%lu", (unsigned long)(p95 / 1000), (unsigned long)((p95 % 1000) / 100));
+  ring_latency.entity.setState(value);
+  ring_latency.attributes_dirty = true;
+
+  // The full report blocks on the UART, it is only printed on request, see loop()
+  LOG_INFO("Ring to publish latency: p95=%uus count=%u.", p95, ring_latency.state.publish_latency.getCount());
+}
+
+void serialize_latency_histogram(JsonWriter & writer, const char * name, const LatencyHistogram & histogram) {
+  writer.key(name);
+  writer.beginObject();
+  writer.keyNumber("count", histogram.getCount());
+  writer.keyNumber("p50_us", histogram.getPercentile(50));
+  writer.keyNumber("p95_us", histogram.getPercentile(95));
+  writer.keyNumber("max_us", histogram.getMax());
+  writer.endObject();
+}
+
+void serialize_ring_latency_attributes(JsonWriter & writer) {
+  writer.beginObject();
+  serialize_latency_histogram(writer, "state", ring_latency.state.state_latency);
+  serialize_latency_histogram(writer, "chime", ring_latency.state.chime_latency);
+  serialize_latency_histogram(writer, "publish", ring_latency.state.publish_latency);
+  writer.endObject();
+}
+
+bool mqtt_publish_json_attributes(HaMqttEntity & entity, void (*serialize)(JsonWriter & writer)) {
+  const char * topic = entity.getKeyValue("json_attributes_topic");
+  if (topic == NULL)
+    return false;
+
+  // Compute the payload length, then stream the payload without building it in memory
+  JsonWriter counter;
+  serialize(counter);
+  if (!publish_adaptor.beginPublish(topic, counter.length(), false))
+    return false;
+  JsonWriter writer(&publish_adaptor);
+  serialize(writer);
+  writer.flush();
+  return publish_adaptor.endPublish() && !writer.hasError();
+}
+
+void print_latency_histogram(const char * name, const LatencyHistogram & histogram, bool print_buckets) {
+  Serial.print(name);
+  Serial.print(": count=");
+  Serial.print(histogram.getCount());
+  Serial.print(" min=");
+  Serial.print(histogram.getMin());
+  Serial.print("us p50=");
+  Serial.print(histogram.getPercentile(50));
+  Serial.print("us p95=");
+  Serial.print(histogram.getPercentile(95));
+  Serial.print("us max=");
+  Serial.print(histogram.getMax());
+  Serial.println("us");
+
+  if (!print_buckets)
     return;
-  const char * melody = melodies_array[index];
-  extract_melody_name((const __FlashStringHelper*)melody, name);
+  for(size_t i=0; i<LatencyHistogram::BUCKET_COUNT; i++) {
+    if (histogram.getBucket(i) == 0)
+      continue;
+    Serial.print("  <=");
+    Serial.print(LatencyHistogram::getBucketUpperBound(i));
+    Serial.print("us: ");
+    Serial.println(histogram.getBucket(i));
+  }
 }
 
+void print_ring_latency_report(bool print_buckets) {
+  print_latency_histogram("Ring to state latency", ring_latency.state.state_latency, print_buckets);
+  print_latency_histogram("Ring to chime latency", ring_latency.state.chime_latency, print_buckets);
+  print_latency_histogram("Ring to publish latency", ring_latency.state.publish_latency, print_buckets);
+  Serial.print("Dropped doorbell edges: ");
+  Serial.println(bell_edges.getDropped());
+
+  const MqttEventQueue::STATS & stats = bell_events.getStats();
+  Serial.print("Bell events: pending=");
+  Serial.print(bell_events.getCount());
+  Serial.print(" queued=");
+  Serial.print(stats.queued);
+  Serial.print(" published=");
+  Serial.print(stats.published);
+  Serial.print(" dropped=");
+  Serial.print(stats.dropped);
+  Serial.print(" expired=");
+  Serial.print(stats.expired);
+  Serial.print(" spilled=");
+  Serial.print(stats.spilled);
+  Serial.print(" failures=");
+  Serial.println(stats.failures);
+}
+
+#ifndef MQTT_ASYNC_CLIENT
 void increase_mqtt_buffer(uint16_t new_buffer_size) {
   uint16_t current_buffer_size = mqtt_client.getBufferSize();
 
@@ -928,27 +1639,184 @@ void increase_mqtt_buffer(uint16_t new_buffer_size) {
       new_buffer_size = (uint16_t)-1; // set to maximum
   }
 
-  bool success = mqtt_client.setBufferSize(new_buffer_size);
-  if (success) {
-    Serial.print("PubSubClient buffer_size increased from ");
-    Serial.print(current_buffer_size);
-    Serial.print(" bytes to ");
-    Serial.print(mqtt_client.getBufferSize());
-    Serial.println(" bytes.");
-  } else {
-    Serial.print(String(ERROR_MESSAGE_PREFIX) + "Failed increasing PubSubClient buffer_size to ");
-    Serial.print(new_buffer_size);
-    Serial.print(" bytes. PubSubClient buffer_size set to ");
-    Serial.println(mqtt_client.getBufferSize());
+  // A publication which never fits must not take all the heap
+  if (new_buffer_size > MQTT_BUFFER_MAX_SIZE)
+    new_buffer_size = MQTT_BUFFER_MAX_SIZE;
+  if (new_buffer_size <= current_buffer_size) {
+    LOG_ERROR("PubSubClient buffer_size is already %u bytes, the maximum.", current_buffer_size);
+    return;
   }
+
+  bool success = mqtt_client.setBufferSize(new_buffer_size);
+  if (success)
+    LOG_INFO("PubSubClient buffer_size increased from %u bytes to %u bytes.", current_buffer_size, mqtt_client.getBufferSize());
+  else
+    LOG_ERROR("Failed increasing PubSubClient buffer_size to %u bytes. PubSubClient buffer_size set to %u.", new_buffer_size, mqtt_client.getBufferSize());
 }
+#endif
 
-void timer_force_timed_out(SoftTimer & timer) {
-  unsigned long current_time_out_time = timer.getTimeOutTime();
-  timer.setTimeOutTime(1);
-  timer.reset();
-  delay(2);
-  timer.setTimeOutTime(current_time_out_time);
+void setup_timers() {
+  // Timers without a callback are only checked with isPending()
+  test_timer = device_timers.add(on_test_timer);
+  online_on_timer = device_timers.add(on_online_on_timer);
+  online_off_timer = device_timers.add(on_online_off_timer);
+  activity_off_timer = device_timers.add(on_activity_off_timer);
+  doorbell_ring_delay_timer = device_timers.add(NULL);
+  identify_delay_timer = device_timers.add(NULL);
+  heartbeat_timer = device_timers.add(on_heartbeat_timer);
+  diagnostics_timer = device_timers.add(on_diagnostics_timer);
+  mqtt_connection.retry_timer = device_timers.add(NULL);
+}
+
+void device_timer_start(DeviceTimer timer, uint32_t delay_ms) {
+  device_timers.start(timer, millis(), delay_ms);
+}
+
+void on_test_timer() {
+  // Force the state of the bell sensor to OFF
+  // Only update the MQTT state if the boolean state has actually transitioned.
+  if (!test_button.state.is_pressed)
+    return;
+  if (bell_sensor.state.detected)
+    set_bell_sensor_state(false);
+
+  test_button.state.is_pressed = false;
+}
+
+void on_online_on_timer() {
+  led_turn_off(&led_online);
+  device_timer_start(online_off_timer, ONLINE_LED_OFF_TIME);
+}
+
+void on_online_off_timer() {
+  // The ONLINE led stays off until the device is connected.
+  if (mqtt_connection.step != MQTT_STEP_READY)
+    return;
+  led_turn_on(&led_online);
+  device_timer_start(online_on_timer, ONLINE_LED_ON_TIME);
+}
+
+void on_activity_off_timer() {
+  led_turn_off(&led_activity);
+}
+
+void on_heartbeat_timer() {
+  // Tell the broker we are still online.
+  // States are retained by the broker, they are only published when they change.
+  if (mqtt_connection.step != MQTT_STEP_READY)
+    return; // restarted when the device is online again
+  publish_scheduler.scheduleDeviceStatus(&this_device, true);
+  device_timer_start(heartbeat_timer, HEARTBEAT_PERIOD);
+}
+
+void on_diagnostics_timer() {
+  uint32_t mqtt_buffer_size;
+#ifdef MQTT_ASYNC_CLIENT
+  mqtt_buffer_size = publish_adaptor.getBufferSize();
+#else
+  mqtt_buffer_size = mqtt_client.getBufferSize();
+#endif
+  const DEVICE_DIAGNOSTICS_SAMPLE & sample = diagnostics.counters.sample(millis(), ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(), mqtt_buffer_size);
+
+  // Only the values which changed are published
+  set_diagnostic_state(diagnostics.free_heap, sample.free_heap);
+  set_diagnostic_state(diagnostics.largest_free_block, sample.largest_free_block);
+  set_diagnostic_state(diagnostics.heap_fragmentation, sample.heap_fragmentation);
+  set_diagnostic_state(diagnostics.loop_rate, sample.loop_rate);
+  set_diagnostic_state(diagnostics.publish_successes, sample.publish_successes);
+  set_diagnostic_state(diagnostics.publish_failures, sample.publish_failures);
+  set_diagnostic_state(diagnostics.publish_retries, sample.publish_retries);
+  set_diagnostic_state(diagnostics.reconnects, sample.reconnects);
+  set_diagnostic_state(diagnostics.mqtt_buffer_size, sample.mqtt_buffer_size);
+
+  device_timer_start(diagnostics_timer, DIAGNOSTICS_PERIOD);
+}
+
+// Formats the value on the stack, sampling the heap does not allocate memory.
+void set_diagnostic_state(HaMqttEntity & entity, uint32_t value) {
+  char buffer[12];
+  snprintf(buffer, sizeof(buffer), "%lu", (unsigned long)value);
+  entity.setState(buffer);
+}
+
+void print_diagnostics_report() {
+  const DEVICE_DIAGNOSTICS_SAMPLE & sample = diagnostics.counters.getLastSample();
+  Serial.print("Heap: free=");
+  Serial.print(sample.free_heap);
+  Serial.print(" min_free=");
+  Serial.print(sample.min_free_heap);
+  Serial.print(" largest_block=");
+  Serial.print(sample.largest_free_block);
+  Serial.print(" fragmentation=");
+  Serial.print(sample.heap_fragmentation);
+  Serial.print("% mqtt_buffer=");
+  Serial.println(sample.mqtt_buffer_size);
+  Serial.print("Activity: loop_rate=");
+  Serial.print(sample.loop_rate);
+  Serial.print("Hz publish_successes=");
+  Serial.print(sample.publish_successes);
+  Serial.print(" publish_failures=");
+  Serial.print(sample.publish_failures);
+  Serial.print(" publish_retries=");
+  Serial.print(sample.publish_retries);
+  Serial.print(" reconnects=");
+  Serial.println(sample.reconnects);
+}
+
+// Sleeps until the next timer deadline when there is nothing else to do.
+// delay() lets the WiFi modem sleep between two beacons. A ring interrupts nothing: its edge is queued
+// by on_doorbell_pin_change() and handled after at most LOOP_MAX_IDLE_TIME milliseconds.
+void loop_idle() {
+  log_drain();
+
+  if (melody_player.isPlaying() ||
+      !bell_edges.isEmpty() ||
+      !publish_scheduler.isEmpty() ||
+      ring_latency.attributes_dirty ||
+      boot_time.attributes_dirty ||
+      ha_birth_detected)
+    return;
+
+  uint32_t idle_time = device_timers.getTimeUntilNext(millis());
+  if (idle_time > LOOP_MAX_IDLE_TIME)
+    idle_time = LOOP_MAX_IDLE_TIME;
+  if (idle_time > 0)
+    delay(idle_time);
+}
+
+// Prints the oldest log records. Never blocks: a record is only printed if its line fits
+// in the free space of the UART FIFO, the others are printed by the next loops.
+void log_drain() {
+  // The count is only taken when its warning fits, otherwise it would be lost with the warning
+  if (log_buffer.getCount() < log_buffer.getCapacity()) {
+    uint32_t dropped = log_buffer.takeDropped();
+    if (dropped > 0)
+      LOG_WARNING("%u log records dropped.", dropped);
+  }
+
+  char line[LOG_LINE_SIZE];
+  for(size_t i=0; i<LOG_DRAIN_MAX_RECORDS; i++) {
+    const DeviceLog::RECORD * record = log_buffer.peek();
+    if (record == NULL)
+      return;
+
+    bool is_error = (record->level <= LOG_LEVEL_WARNING);
+    size_t length = DeviceLog::format(*record, line, sizeof(line));
+    length += 10 + 3 + 2; // time, level and end of line
+    if (is_error)
+      length += strlen(ERROR_MESSAGE_PREFIX);
+    if ((size_t)Serial.availableForWrite() < length)
+      return;
+
+    Serial.print(record->time);
+    Serial.print(' ');
+    Serial.print(DeviceLog::getLevelName(record->level));
+    Serial.print(' ');
+    if (is_error)
+      Serial.print(ERROR_MESSAGE_PREFIX);
+    Serial.println(line);
+    log_buffer.pop();
+  }
 }
 
 bool split_string(const char * text, char split_char, String ** elements) {
@@ -1012,16 +1880,33 @@ void setup() {
   Serial.begin(115200);
   Serial.println("READY!");
 
-  play_hello_animation();
+#if defined(BELL_EVENT_SPILL_FILE) || defined(FAST_BOOT_FILE)
+  file_system_mounted = LittleFS.begin();
+  if (!file_system_mounted)
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to mount LittleFS.");
+#endif
+
+  // The animation is only played on the first boot, a fast boot skips it
+  fast_boot_load();
+  if (!boot_cache_valid)
+    play_hello_animation();
 
-  bell_sensor_reader.begin();
+  pinMode(DOORBELL_PIN, INPUT_PULLUP);
+  bell_pin_pressed = (digitalRead(DOORBELL_PIN) == LOW);
+  attachInterrupt(digitalPinToInterrupt(DOORBELL_PIN), on_doorbell_pin_change, CHANGE);
 
   led_online.pin = LED0_PIN;
   led_online.name = "online";
   led_activity.pin = LED1_PIN;
   led_activity.name = "activity";
 
+#ifdef MQTT_ASYNC_CLIENT
+  publish_adaptor.setAsyncMqttClient(&mqtt_client); // ESPAsyncTCP already coalesces small writes, no batch buffer
+#else
   publish_adaptor.setPubSubClient(&mqtt_client);
+  if (!publish_adaptor.setBatchCapacity(&wifi_client, MQTT_BATCH_SIZE))
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to allocate the MQTT batch buffer.");
+#endif
 
   HaMqttDiscovery::error_message_prefix = ERROR_MESSAGE_PREFIX;  
   
@@ -1034,11 +1919,27 @@ void setup() {
 
   // Set default values for other entities
   bell_sensor.state.detected = false;
+  bell_sensor.new_ring = false;
   bell_sensor.entity.setState("OFF");
+  bell_events.setMaxAge(BELL_EVENT_MAX_AGE);
+#ifdef BELL_EVENT_SPILL_FILE
+  if (file_system_mounted) {
+    bell_events_store.begin();
+    bell_events.setStore(&bell_events_store);
+  } else {
+    Serial.println(String(ERROR_MESSAGE_PREFIX) + "Failed to mount LittleFS, bell events are kept in RAM only.");
+  }
+#endif
 
   identify.state.is_on = false;
   identify.entity.setState("OFF");
 
+  ring_latency.attributes_dirty = false;
+  ring_latency.entity.setState("0.0");
+
+  boot_time.attributes_dirty = false;
+  boot_time.entity.setState("0");
+
   // Set entity's state to publish an empty payload to the command/state topic (both are identical).
   // This will 'delete' the command topic until the button is pressed again.
   test_button.state.is_pressed = false;
@@ -1047,7 +1948,8 @@ void setup() {
   setup_melody_names();
 
   melody_selector.state.selected_melody = 0;
-  const char * default_selected_melody_name = melody_names[melody_selector.state.selected_melody];
+  String default_selected_melody_name;
+  melody_catalog.getName(melody_selector.state.selected_melody, default_selected_melody_name);
   Serial.print(String() + "Set default melody selector state to '" + default_selected_melody_name + "'.");
   melody_selector.entity.setState(default_selected_melody_name);
 
@@ -1055,159 +1957,163 @@ void setup() {
   setup_device();
   setup_mqtt();
 
-  // Setup a timer to prevent starting a new melody
-  timer_force_timed_out(doorbell_ring_delay_timer);
-  doorbell_ring_delay_timer.setTimeOutTime(5000);
+  // Setup the timers. Idle timers are expired: a ring is allowed and the MQTT connection starts on the first loop().
+  setup_timers();
 
-  // Setup a timer to prevent playing the identify melody as soon as it ends.
-  identify_delay_timer.setTimeOutTime(2500);
-  identify_delay_timer.reset();
+  // Prevent playing the identify melody as soon as the device boots.
+  device_timer_start(identify_delay_timer, IDENTIFY_DELAY);
 
-  // Setup a timer to compute how long do we force the bell sensor to be ON.
-  timer_force_timed_out(test_timer);
-  test_timer.setTimeOutTime(200);
+  // First sample of the diagnostic sensors, then every DIAGNOSTICS_PERIOD
+  on_diagnostics_timer();
 
-  // Setup a timer to compute how long do we force the ACTIVITY led to be ON.
-  timer_force_timed_out(activity_off_timer);
-  activity_off_timer.setTimeOutTime(1000);
+  // Setup the MQTT connection to connect on the first loop()
+  randomSeed(ESP.getChipId() ^ micros());
+  mqtt_connection.step = MQTT_STEP_DISCONNECTED;
+  mqtt_connection.force_discovery = false;
+  mqtt_connection.retry_delay = MQTT_RETRY_DELAY_MIN;
 
-  // Setup a timer to compute how long the ONLINE led should be ON.
-  online_on_timer.setTimeOutTime(100);
+  // Allow time for Home Assistant to process each publication
+  publish_scheduler.setRate(DELAY_BETWEEN_MQTT_TRANSACTIONS, MQTT_PUBLISH_BURST);
+  publish_scheduler.setMaxFailures(MAX_PUBLISH_RETRY);
+  publish_scheduler.setResultHandler(on_publish_result);
 
-  // Setup a timer to compute how long the ONLINE led should be OFF.
-  online_off_timer.setTimeOutTime(4900);
-
-  // Setup a timer to force publishing all entity states every 5 minutes.
-  force_publish_timer.setTimeOutTime(5*60*1000);
-  force_publish_timer.reset();
+  boot_time.timings.setup = millis();
 }
 
 void loop() {
+  diagnostics.counters.onLoop();
+
   // Should we debug the connection status?
   //connection_debugger.update((int)mqtt_client.connected());
 
-  // make sure mqtt is working
-  if (!mqtt_client.connected()) {
-    yield();
-    mqtt_reconnect();
-  }
-  mqtt_client.loop();
+  // Fire the expired timers: LED blinks, heartbeat, end of a TEST button press...
+  device_timers.update(millis());
 
-  // It is time to force publishing all entities again?
-  if (force_publish_timer.hasTimedOut()) {
-    mqtt_force_publish_entities_state();
-    force_publish_timer.reset(); //start counting now
-  }
+  // Advance the MQTT connection. Never blocks while the broker is unreachable.
+  mqtt_connection_update();
+#ifndef MQTT_ASYNC_CLIENT
+  mqtt_client.loop();
+#endif
 
-  // Process the ONLINE led blink update.
-  // Should the ONLINE led turn off?
-  if (led_online.is_on && online_on_timer.hasTimedOut()) {
-    led_turn_off(&led_online);
-    online_off_timer.reset();  //start counting now
-  }
-  // Should the ONLINE led turn on?
-  if (!led_online.is_on && online_off_timer.hasTimedOut()) {
-    led_turn_on(&led_online);
-    online_on_timer.reset();  //start counting now
+  // Did Home Assistant restart? It requires all discovery topics again.
+  if (ha_birth_detected) {
+    ha_birth_detected = false;
+    mqtt_connection.force_discovery = true;
+    if (mqtt_connection.step > MQTT_STEP_DISCOVERY)
+      mqtt_connection_set_step(MQTT_STEP_DISCOVERY);
   }
 
   // Did we waited long enough between each detection?
   // This prevents sending multiple signals to Home Assistant when one repeatedly press the doorbell.
-  bool allow_new_ring_detections = false;
-  if (doorbell_ring_delay_timer.hasTimedOut()) {
-    allow_new_ring_detections = true;
-  }
-
-  // Read DOORBELL magnetic field from pin
-  bool magnetic_ring_detected = false;
-  if (bell_sensor_reader.toggled()) {
-    if (bell_sensor_reader.read() == Button::PRESSED && allow_new_ring_detections) {
-      bell_sensor.state.detected = true;
-    } else {
-      bell_sensor.state.detected = false;
-    }
+  bool allow_new_ring_detections = !device_timers.isPending(doorbell_ring_delay_timer);
+
+  // Read DOORBELL magnetic field edges queued by the pin interrupt.
+  // Each transition is queued in bell_events, so that a quick press and release
+  // while the network is down still reaches Home Assistant.
+  sync_doorbell_pin();
+  PIN_EDGE edge;
+  if (bell_edges.pop(edge)) {
+    bool detected = (edge.pressed && allow_new_ring_detections);
+    if (detected)
+      ring_latency_start(edge.time);
 
     // Only update the MQTT state if the boolean state has actually transitioned.
-    if (bell_sensor.previous.detected != bell_sensor.state.detected) {
-      bell_sensor.entity.setState(bell_sensor.state.detected ? "ON" : "OFF");
+    if (bell_sensor.previous.detected != detected) {
+      set_bell_sensor_state(detected);
+      if (detected)
+        ring_latency_record(ring_latency.state.state_latency, ring_latency.state.state_pending);
     }
   }
 
   // Did we pressed the TEST button?
   if (test_button.previous.is_pressed == false && test_button.state.is_pressed && allow_new_ring_detections) {
     // Force the state of the bell sensor to ON
-    bell_sensor.state.detected = true;
-    bell_sensor.entity.setState(bell_sensor.state.detected ? "ON" : "OFF");
-
-    // Start a timer to stop overriding the bell sensor
-    test_timer.reset();
-  }
-  if (test_button.state.is_pressed && test_timer.hasTimedOut()) {
-    // Force the state of the bell sensor to OFF
-    bell_sensor.state.detected = false;
-
-    // Only update the MQTT state if the boolean state has actually transitioned.
-    if (bell_sensor.previous.detected != bell_sensor.state.detected) {
-      bell_sensor.entity.setState(bell_sensor.state.detected ? "ON" : "OFF");
-    }
+    ring_latency_start(micros());
+    set_bell_sensor_state(true);
+    ring_latency_record(ring_latency.state.state_latency, ring_latency.state.state_pending);
 
-    test_button.state.is_pressed = false;
+    // Start a timer to stop overriding the bell sensor, see on_test_timer()
+    device_timer_start(test_timer, TEST_BUTTON_DURATION);
   }
 
   // Did we detected new ACTIVITY during this pass?
-  if (bell_sensor.state.detected && bell_sensor.entity.getState().isDirty()) {
-    doorbell_ring_delay_timer.reset();  //start counting now to know when is the next time allowed to trigger a ring.
-
-    // Turn the ACTIVITY led on
+  // A ring is handled once, on the transition to ON: the bell state stays dirty until it is
+  // published, which may be long after the ring while the device is offline.
+  bool new_ring = bell_sensor.new_ring;
+  bell_sensor.new_ring = false;
+  if (new_ring) {
+    device_timer_start(doorbell_ring_delay_timer, DOORBELL_RING_DELAY);  //start counting now to know when is the next time allowed to trigger a ring.
+
+    // Turn the ACTIVITY led on, see on_activity_off_timer()
     led_turn_on(&led_activity);
-    activity_off_timer.reset(); //start counting now
-  }
-
-  // Should we turn off the ACTIVITY led status?
-  if (led_activity.is_on && activity_off_timer.hasTimedOut()) {
-    led_turn_off(&led_activity);
+    device_timer_start(activity_off_timer, ACTIVITY_LED_DURATION);
   }
 
   // Should we start a doorbell melody?
-  if (bell_sensor.state.detected && // do not trigger a melody when button is released 
-      bell_sensor.entity.getState().isDirty() &&
-      melody_selector.state.selected_melody < melodies_array_count &&
-      !anyrtttl::nonblocking::isPlaying())
+  if (new_ring &&
+      melody_selector.state.selected_melody < melody_catalog.getCount() &&
+      !melody_player.isPlaying())
   {
-    const char * selected_melody_buffer = melodies_array[melody_selector.state.selected_melody];
-    Serial.print("Playing: ");
-    Serial.println(melody_names[melody_selector.state.selected_melody]);
-    anyrtttl::nonblocking::begin_P(BUZZER_PIN, selected_melody_buffer);
+    const uint8_t * selected_melody_buffer = get_binary_melody(melody_selector.state.selected_melody);
+    char name[LOG_TEXT_SIZE];
+    size_t name_length = melody_catalog.getName(melody_selector.state.selected_melody, name, sizeof(name));
+    LOG_INFO("Playing: %t", log_text(name, name_length));
+    melody_player.begin(BUZZER_PIN, selected_melody_buffer, RTTTL_LIBRARY_NOTE_BITS);
+    melody_player.play(); // start the first note now
+    ring_latency_record(ring_latency.state.chime_latency, ring_latency.state.chime_pending);
 
     // Update our timer
-    doorbell_ring_delay_timer.reset();  //start counting now
+    device_timer_start(doorbell_ring_delay_timer, DOORBELL_RING_DELAY);  //start counting now
   }
 
   // Should we start the identify melody?
   if (identify.state.is_on &&
       identify_melody_index != INVALID_MELODY_INDEX &&
-      identify_delay_timer.hasTimedOut() &&
-      !anyrtttl::nonblocking::isPlaying())
+      !device_timers.isPending(identify_delay_timer) &&
+      !melody_player.isPlaying())
   {
-    const char * melody_buffer = melodies_array[identify_melody_index];
-    Serial.print("Playing: ");
-    Serial.println(melody_names[identify_melody_index]);
-    anyrtttl::nonblocking::begin_P(BUZZER_PIN, melody_buffer);
+    const uint8_t * melody_buffer = get_binary_melody(identify_melody_index);
+    char name[LOG_TEXT_SIZE];
+    size_t name_length = melody_catalog.getName(identify_melody_index, name, sizeof(name));
+    LOG_INFO("Playing: %t", log_text(name, name_length));
+    melody_player.begin(BUZZER_PIN, melody_buffer, RTTTL_LIBRARY_NOTE_BITS);
 
     // Update our timer
-    identify_delay_timer.reset();  //start counting now
+    device_timer_start(identify_delay_timer, IDENTIFY_DELAY);  //start counting now
   }
 
   // If we are playing something, keep playing! 
-  if ( anyrtttl::nonblocking::isPlaying() )
+  if ( melody_player.isPlaying() )
   {
-    anyrtttl::nonblocking::play();
+    melody_player.play();
+  }
+
+  // Publish dirty entities, most urgent first, at the rate allowed by the scheduler.
+  if (publish_adaptor.connected()) {
+    mqtt_schedule_bell_events();
+    mqtt_schedule_dirty_states();
+    publish_scheduler.process(millis());
   }
 
-  // Publish a maximum of 1 dirty entity per loop.
-  mqtt_publish_entities_dirty_state(1);
+  // Publish the latency details of the last ring
+  if (ring_latency.attributes_dirty && mqtt_connection.step == MQTT_STEP_READY)
+    ring_latency.attributes_dirty = !mqtt_publish_json_attributes(ring_latency.entity, serialize_ring_latency_attributes);
+
+  // Publish the boot timings once the device is online
+  if (boot_time.attributes_dirty && mqtt_connection.step == MQTT_STEP_READY)
+    boot_time.attributes_dirty = !mqtt_publish_json_attributes(boot_time.entity, serialize_boot_time_attributes);
+
+  // Dump the latency histograms when 'l' is received on the serial port
+  if (Serial.available() > 0 && Serial.read() == 'l') {
+    print_ring_latency_report(true);
+    print_mqtt_broker_report();
+    print_diagnostics_report();
+  }
 
   // Remember previous states
   test_button.previous = test_button.state; 
   bell_sensor.previous = bell_sensor.state;
+
+  // Nothing else to do until the next deadline?
+  loop_idle();
 }
@@ -0,0 +1,1036 @@
+// Generated by rtttl2bin. Do not edit.
+// Command: rtttl2bin -b 10 -o rtttl_library.h rtttl_doorbell.txt rtttl_melodies.txt rtttl_ringtones.txt
+// 215 melodies, 9322 notes, 12590 bytes of binary melodies (37711 bytes as RTTTL text).
+
+#ifndef RTTTL_LIBRARY_H
+#define RTTTL_LIBRARY_H
+
+#include "MelodyCatalog.hpp"
+
+#define RTTTL_LIBRARY_NOTE_BITS 10
+
+static constexpr char rtttl_library_names[] PROGMEM =
+  MELODY("None")
+  MELODY("Beethoven Fifth Symphony")
+  MELODY("Coca Cola")
+  MELODY("Duke Nukem (short)")
+  MELODY("Entertaine (short)")
+  MELODY("Flintstones (short)")
+  MELODY("Intel")
+  MELODY("Mission Impossible - Intro")
+  MELODY("Mission Impossible (short)")
+  MELODY("Mosaic-long")
+  MELODY("Nokia")
+  MELODY("Pacman")
+  MELODY("Popeye (short)")
+  MELODY("Star Wars - Cantina (short)")
+  MELODY("Star Wars - Imperial March (short)")
+  MELODY("Star Wars (short)")
+  MELODY("Super Mario Bros. 1 (short)")
+  MELODY("Super Mario Bros. 3 Level 1 (short)")
+  MELODY("Super Mario Bros. Death")
+  MELODY("Sweet Child")
+  MELODY("The Good the Bad and the Ugly (short)")
+  MELODY("The Itchy Scratchy Show")
+  MELODY("Tones")
+  MELODY("Trio")
+  MELODY("Wolf Whistle")
+  MELODY("X-Files (short)")
+  MELODY("20thCenFox")
+  MELODY("Addams1")
+  MELODY("Addams2")
+  MELODY("Agadoo")
+  MELODY("Amazing Grace")
+  MELODY("American")
+  MELODY("Anthem")
+  MELODY("Argentina")
+  MELODY("A-Team1")
+  MELODY("A-Team2")
+  MELODY("Auld L S")
+  MELODY("Away")
+  MELODY("AxelF")
+  MELODY("Baa Baa")
+  MELODY("Back to the Future")
+  MELODY("Banjos")
+  MELODY("Barbie")
+  MELODY("Batman")
+  MELODY("BennyHill")
+  MELODY("Birdie")
+  MELODY("BlackNight")
+  MELODY("Bogey")
+  MELODY("Bolero")
+  MELODY("Bond007")
+  MELODY("Bond1")
+  MELODY("Bond2")
+  MELODY("Buggles")
+  MELODY("Canon")
+  MELODY("Cantina")
+  MELODY("Chariots of Fire")
+  MELODY("Coca cola")
+  MELODY("Colonel Bogey")
+  MELODY("Come As You Are")
+  MELODY("Countdown")
+  MELODY("Crockett")
+  MELODY("Dallas")
+  MELODY("Don'tcare")
+  MELODY("Doom_map")
+  MELODY("Dr No")
+  MELODY("Duke")
+  MELODY("Eastenders")
+  MELODY("Entertainer")
+  MELODY("Equador")
+  MELODY("Fawlty")
+  MELODY("Fiddler")
+  MELODY("Flintstones1")
+  MELODY("Flintstones2")
+  MELODY("Fruit and Nut")
+  MELODY("Funeral")
+  MELODY("FunkyTown")
+  MELODY("Gadget")
+  MELODY("Game of Thrones")
+  MELODY("Get ready")
+  MELODY("Getting down")
+  MELODY("Ghost Busters")
+  MELODY("God Rest")
+  MELODY("Good King")
+  MELODY("GoodBad1")
+  MELODY("GoodBad2")
+  MELODY("Greensleeves")
+  MELODY("Halloween")
+  MELODY("HappyBirthday")
+  MELODY("Hark")
+  MELODY("Hawaii 5 0")
+  MELODY("Hawaii 50")
+  MELODY("ImperialMarch")
+  MELODY("Inagad")
+  MELODY("Indiana1")
+  MELODY("Indiana2")
+  MELODY("Ipanema")
+  MELODY("Ironman")
+  MELODY("ItchyScratchy")
+  MELODY("Jackson")
+  MELODY("Jeopardy")
+  MELODY("Jesus")
+  MELODY("Jingle Bells")
+  MELODY("Jingle")
+  MELODY("Knight Rider")
+  MELODY("KnightRider1")
+  MELODY("KnightRider2")
+  MELODY("Legend Of Zelda - Labyrinth (Dungeon)")
+  MELODY("Legend Of Zelda - Overworld")
+  MELODY("Legend Of Zelda - Title")
+  MELODY("LeisureSuit")
+  MELODY("Light My Fire")
+  MELODY("LightMyFire")
+  MELODY("Looney1")
+  MELODY("Looney2")
+  MELODY("LordDance")
+  MELODY("Lullaby")
+  MELODY("M O T D")
+  MELODY("MahnaMahna")
+  MELODY("MASH")
+  MELODY("Memory")
+  MELODY("Mission 1")
+  MELODY("Mission 2")
+  MELODY("Mission Impossible")
+  MELODY("MissionImp")
+  MELODY("Money")
+  MELODY("Mozart")
+  MELODY("Mull")
+  MELODY("Munsters")
+  MELODY("Muppets")
+  MELODY("New Year")
+  MELODY("O Come")
+  MELODY("O Little")
+  MELODY("On Ilkley")
+  MELODY("Partyline")
+  MELODY("PeterGunn")
+  MELODY("Phoenix")
+  MELODY("PinkPanther")
+  MELODY("Popcorn")
+  MELODY("Popeye")
+  MELODY("Rudolf")
+  MELODY("Rule B")
+  MELODY("Rule Britania")
+  MELODY("Scatman")
+  MELODY("Scooby Doo")
+  MELODY("Scotland")
+  MELODY("Sesame Street")
+  MELODY("Sesame")
+  MELODY("Silent")
+  MELODY("Simpsons")
+  MELODY("Smb")
+  MELODY("Smb2")
+  MELODY("Smb3lvl1")
+  MELODY("Smbdeath")
+  MELODY("SMBUndergr")
+  MELODY("SMBWater")
+  MELODY("Smoke")
+  MELODY("Smurfs")
+  MELODY("Soap")
+  MELODY("Sorcerers Apprentice")
+  MELODY("Spiderman")
+  MELODY("Stairway")
+  MELODY("Star Trek")
+  MELODY("StarWars")
+  MELODY("Super Man")
+  MELODY("Super Mario World - Title Music")
+  MELODY("Super Mario World - Unknown")
+  MELODY("Super Marios Bros - 1up")
+  MELODY("Super Marios Bros - Coin")
+  MELODY("Super Marios Bros - Death")
+  MELODY("Super Marios Bros - Fireball")
+  MELODY("Super Marios Bros - Flagpole")
+  MELODY("Super Marios Bros - Game Over")
+  MELODY("Super Marios Bros - Life")
+  MELODY("Super Marios Bros - Mushroom PowerUp")
+  MELODY("Super Marios Bros - Theme")
+  MELODY("TakeOnMe1")
+  MELODY("TakeOnMe2")
+  MELODY("Teenage Mutant Ninja Turtles")
+  MELODY("Tetris")
+  MELODY("The legend of Zelda Ocarina of Time - Kokiri Forest")
+  MELODY("The Legend of Zelda Ocarina of Time - Zeldas Lullaby")
+  MELODY("The legend of Zelda")
+  MELODY("The Simpsons")
+  MELODY("Thosewere")
+  MELODY("Thunderbirds")
+  MELODY("Tk3jin")
+  MELODY("To The Dump To The Dump To The Dump Dump Dump")
+  MELODY("Toccata")
+  MELODY("TopGun")
+  MELODY("Transformers")
+  MELODY("Tubular")
+  MELODY("Turkish")
+  MELODY("Under the Sea")
+  MELODY("Undersea")
+  MELODY("Uptown")
+  MELODY("USA National Anthem")
+  MELODY("Wannabe")
+  MELODY("We Wish")
+  MELODY("Whigfield")
+  MELODY("Whilst")
+  MELODY("Winter")
+  MELODY("Xfiles")
+  MELODY("XmasTree")
+  MELODY("YMCA")
+  MELODY("Fido1")
+  MELODY("Fido2")
+  MELODY("Hummingbird")
+  MELODY("Kick")
+  MELODY("Mosaic-short")
+  MELODY("Ring High")
+  MELODY("Ring Low")
+  MELODY("Robo N1X")
+  MELODY("Scale")
+  MELODY("Trim Phone")
+  MELODY("Urgent");
+
+static const uint16_t rtttl_library_offsets[] PROGMEM = {
+  0, 6, 17, 35, 52, 79, 105, 169, 193, 232, 283, 304, 373, 386, 422, 440,
+  469, 485, 513, 537, 560, 576, 617, 660, 708, 777, 798, 877, 946, 1014, 1051, 1083,
+  1117, 1141, 1194, 1242, 1271, 1313, 1350, 1426, 1452, 1545, 1611, 1644, 1682, 1745, 1812, 1863,
+  1931, 1995, 2044, 2095, 2147, 2198, 2270, 2339, 2375, 2394, 2466, 2509, 2570, 2657, 2704, 2728,
+  2810, 2853, 2934, 2987, 3039, 3078, 3137, 3193, 3292, 3340, 3492, 3510, 3546, 3585, 3973, 4012,
+  4050, 4073, 4114, 4151, 4199, 4245, 4296, 4350, 4417, 4440, 4549, 4607, 4641, 4698, 4771, 4844,
+  4886, 4913, 4954, 5122, 5210, 5233, 5274, 5310, 5352, 5436, 5478, 5606, 5715, 5841, 5895, 5939,
+  5983, 6021, 6058, 6110, 6183, 6265, 6323, 6427, 6459, 6493, 6574, 6655, 6753, 6795, 6914, 6950,
+  7001, 7082, 7125, 7159, 7206, 7235, 7278, 7312, 7375, 7412, 7558, 7606, 7645, 7677, 7709, 7837,
+  7880, 7961, 8010, 8059, 8081, 8114, 8242, 8308, 8384, 8408, 8489, 8581, 8622, 8690, 8738, 8817,
+  8874, 8908, 8922, 8975, 9042, 9133, 9206, 9218, 9226, 9268, 9276, 9348, 9386, 9405, 9444, 9471,
+  9630, 9712, 9758, 9815, 9889, 9953, 10230, 10263, 10324, 10405, 10476, 10542, 10573, 10625, 10793, 10872,
+  10991, 11052, 11113, 11171, 11210, 11254, 11296, 11344, 11385, 11433, 11492, 11558, 11611, 11639, 11663, 12221,
+  12319, 12346, 12380, 12414, 12510, 12533, 12559,
+};
+
+static const uint8_t rtttl_library_data[] PROGMEM = {
+  0x84, 0x03, 0x01, 0x00, 0x05, 0x00, 0x7d, 0x00, 0x05, 0x00, 0x03, 0x0c, 0x35, 0xd4, 0x50, 0x21,
+  0x01, 0x7d, 0x00, 0x0b, 0x00, 0x3b, 0xee, 0xb8, 0xe3, 0x8e, 0x42, 0xee, 0xa8, 0xe2, 0x8a, 0x53,
+  0xea, 0xa8, 0x21, 0x5a, 0x00, 0x0a, 0x00, 0x3c, 0x50, 0x41, 0x00, 0x19, 0x03, 0xf0, 0x40, 0x06,
+  0x01, 0x14, 0x0d, 0x00, 0x8c, 0x00, 0x12, 0x00, 0x1b, 0x8d, 0xb4, 0x92, 0x82, 0x2b, 0x29, 0xb8,
+  0x52, 0xa2, 0x0b, 0x6e, 0x38, 0xe2, 0x8a, 0x0b, 0x6e, 0xa8, 0xe2, 0x58, 0x1a, 0x26, 0x08, 0xc8,
+  0x00, 0x11, 0x00, 0x4a, 0x49, 0x34, 0x80, 0x84, 0x5b, 0x29, 0x25, 0xd1, 0x00, 0x4a, 0xed, 0x34,
+  0xd3, 0x4c, 0x3b, 0x2d, 0x25, 0x91, 0x48, 0x31, 0x01, 0x40, 0x01, 0x30, 0x00, 0x1c, 0x11, 0xc0,
+  0x11, 0x01, 0x1c, 0x11, 0x40, 0x14, 0x01, 0x44, 0x11, 0x40, 0x14, 0x01, 0x1c, 0x11, 0xc0, 0x11,
+  0x01, 0x1c, 0x11, 0x40, 0x15, 0x01, 0x54, 0x11, 0x40, 0x55, 0x00, 0x1c, 0x11, 0xc0, 0x11, 0x01,
+  0x1c, 0x11, 0x40, 0x14, 0x01, 0x44, 0x11, 0x40, 0x14, 0x01, 0x1c, 0x11, 0xc0, 0x11, 0x01, 0x1c,
+  0x11, 0x40, 0x15, 0x01, 0x54, 0x11, 0x40, 0x55, 0x00, 0x5f, 0x00, 0x10, 0x00, 0x1d, 0x96, 0xd8,
+  0x61, 0x89, 0x1d, 0x96, 0xd8, 0x61, 0x89, 0x1d, 0x76, 0x58, 0x62, 0x8b, 0x35, 0xf6, 0x58, 0x24,
+  0x91, 0x5f, 0x00, 0x1c, 0x00, 0x5c, 0x12, 0x99, 0x61, 0x01, 0x5c, 0x12, 0x19, 0x61, 0x01, 0x5c,
+  0x12, 0x99, 0x20, 0x57, 0x0b, 0x06, 0x50, 0x00, 0x57, 0x44, 0xe5, 0x58, 0x00, 0x57, 0x44, 0xc5,
+  0x58, 0x00, 0x57, 0x44, 0xa5, 0x48, 0xe2, 0x86, 0x90, 0x01, 0x25, 0x00, 0x0b, 0xae, 0x38, 0xe4,
+  0x8a, 0x0b, 0x0e, 0xb9, 0xe2, 0x90, 0x0b, 0x0e, 0xb9, 0xe0, 0x8a, 0x0b, 0x0e, 0xb9, 0xe2, 0x90,
+  0x2b, 0x2e, 0x38, 0xc0, 0x42, 0x2b, 0x0d, 0xb5, 0xd2, 0x42, 0x43, 0xad, 0x34, 0xd4, 0x42, 0x43,
+  0x2d, 0xb4, 0xd2, 0x42, 0x43, 0xad, 0x34, 0xd4, 0x4a, 0x0b, 0x01, 0xb4, 0x00, 0x0d, 0x00, 0x2b,
+  0x6d, 0xa4, 0x83, 0x12, 0x13, 0x8d, 0xa1, 0x81, 0x0a, 0x63, 0x4c, 0x21, 0x81, 0x0a, 0x51, 0x00,
+  0x70, 0x00, 0x34, 0x00, 0x65, 0x15, 0x50, 0x66, 0x01, 0x3d, 0x16, 0x50, 0x62, 0x01, 0x65, 0xf6,
+  0x48, 0x00, 0x89, 0x04, 0x34, 0x58, 0x40, 0xc3, 0x05, 0x14, 0x59, 0x40, 0x8b, 0x05, 0x34, 0x5c,
+  0x24, 0x01, 0x2c, 0x12, 0x50, 0x56, 0x01, 0x65, 0x16, 0xd0, 0x63, 0x01, 0x25, 0x16, 0x50, 0x66,
+  0x8f, 0x04, 0x90, 0x48, 0x40, 0x89, 0x2d, 0xd6, 0x58, 0x40, 0x8d, 0x3d, 0x16, 0x59, 0x40, 0x91,
+  0x4d, 0x56, 0x59, 0x40, 0xb9, 0xa0, 0x00, 0x07, 0x00, 0x53, 0x2d, 0xb8, 0xe0, 0x82, 0x5a, 0x4d,
+  0xa5, 0x20, 0xfa, 0x00, 0x19, 0x00, 0x53, 0x0d, 0xb0, 0xe1, 0x00, 0x53, 0x0d, 0xb0, 0xe1, 0x00,
+  0x53, 0x6d, 0x38, 0xc0, 0x54, 0x03, 0x2c, 0x25, 0xd5, 0x54, 0x4b, 0x4d, 0x25, 0xd4, 0x4e, 0x43,
+  0xed, 0x24, 0xdb, 0x66, 0x04, 0x00, 0x64, 0x00, 0x0b, 0x00, 0x2a, 0xa9, 0xa4, 0xd2, 0x42, 0x04,
+  0x10, 0xa5, 0xd2, 0x42, 0x04, 0x10, 0xa5, 0x12, 0x2d, 0x00, 0x14, 0x00, 0x05, 0xf4, 0xd4, 0x53,
+  0x4f, 0xe3, 0xed, 0xda, 0x62, 0x89, 0x15, 0x8e, 0xcb, 0x6b, 0x8b, 0x25, 0x56, 0x38, 0x2e, 0xaf,
+  0x2d, 0x96, 0xd8, 0xe2, 0xa4, 0x64, 0x00, 0x09, 0x00, 0x2c, 0xb2, 0x58, 0xc0, 0x8a, 0x0c, 0xae,
+  0x38, 0xe4, 0x00, 0x43, 0x01, 0x50, 0x00, 0x13, 0x00, 0x44, 0x35, 0x44, 0x1c, 0x55, 0x0d, 0x51,
+  0x47, 0x56, 0x43, 0x64, 0x51, 0xd7, 0x14, 0x75, 0x44, 0x35, 0x44, 0x1c, 0x55, 0x0d, 0x51, 0x25,
+  0x1e, 0x5a, 0x00, 0x10, 0x00, 0x0d, 0x36, 0xd8, 0xe0, 0x00, 0x64, 0xd1, 0x48, 0x00, 0x8d, 0xb4,
+  0xb2, 0xca, 0x21, 0x83, 0x04, 0xb0, 0x44, 0x00, 0x43, 0x8c, 0x00, 0x0f, 0x00, 0x1b, 0x6d, 0x38,
+  0xd5, 0x50, 0x43, 0x4e, 0xb5, 0xe3, 0x54, 0x1b, 0x6d, 0x38, 0xd5, 0x50, 0x43, 0x4e, 0xb5, 0x23,
+  0x38, 0x00, 0x09, 0x00, 0x05, 0x74, 0x55, 0x62, 0x57, 0x25, 0x6e, 0xc7, 0x1b, 0x73, 0x22, 0x01,
+  0xa0, 0x00, 0x1d, 0x00, 0x0b, 0x4e, 0x25, 0xc0, 0x82, 0x53, 0x0a, 0xb0, 0xe0, 0x54, 0x0b, 0x4e,
+  0xb5, 0xe0, 0x94, 0x02, 0x0c, 0xb0, 0xe0, 0x86, 0x2b, 0x0e, 0xb0, 0xe2, 0x8c, 0x43, 0x0a, 0xb0,
+  0xe1, 0x82, 0x1a, 0xce, 0xa8, 0xa5, 0x94, 0x09, 0x03, 0xf4, 0x01, 0x1f, 0x00, 0x63, 0x11, 0x30,
+  0x56, 0x00, 0x43, 0x11, 0x30, 0x54, 0x00, 0x1b, 0x12, 0xb0, 0x61, 0x00, 0x1b, 0x11, 0xb0, 0x19,
+  0x00, 0x63, 0x11, 0x30, 0x56, 0x00, 0x43, 0x11, 0x30, 0x54, 0x00, 0x1b, 0x12, 0xb0, 0x61, 0x00,
+  0x1b, 0x11, 0xb0, 0x19, 0x40, 0x01, 0x23, 0x00, 0x25, 0x76, 0x55, 0x62, 0x57, 0x25, 0x76, 0x55,
+  0x62, 0x57, 0x25, 0x76, 0x55, 0x62, 0x01, 0x45, 0x96, 0x58, 0x64, 0x89, 0x45, 0x96, 0x58, 0x64,
+  0x89, 0x45, 0x96, 0x58, 0x64, 0x01, 0x5d, 0x16, 0xd9, 0x65, 0x91, 0x5d, 0x16, 0xd9, 0x65, 0x91,
+  0x5d, 0x16, 0xd9, 0x25, 0x84, 0x03, 0x34, 0x00, 0x53, 0x70, 0x41, 0x06, 0x43, 0x14, 0x71, 0x44,
+  0x12, 0x4b, 0x34, 0xf1, 0x44, 0x14, 0x53, 0x54, 0x71, 0x45, 0x16, 0x83, 0x13, 0x72, 0x48, 0x22,
+  0x8b, 0x34, 0x0a, 0x20, 0x00, 0x15, 0x5c, 0x90, 0xc1, 0x10, 0x45, 0x1c, 0x91, 0xc4, 0x12, 0x4d,
+  0x3c, 0x11, 0xc5, 0x14, 0x55, 0x5c, 0x91, 0xc5, 0x15, 0x55, 0x4c, 0x11, 0xc5, 0x13, 0x4d, 0x2c,
+  0x91, 0xc4, 0x11, 0x45, 0x0c, 0x91, 0xc1, 0x05, 0x15, 0x7d, 0x00, 0x0d, 0x00, 0x2a, 0x89, 0x25,
+  0x95, 0x58, 0x1a, 0x86, 0x37, 0x80, 0x4a, 0x62, 0x49, 0x25, 0x96, 0x86, 0xe1, 0x01, 0x8c, 0x00,
+  0x3c, 0x00, 0x64, 0x0d, 0x40, 0x16, 0x59, 0x61, 0x11, 0xc0, 0x60, 0x01, 0x64, 0x15, 0xc0, 0x60,
+  0x01, 0x64, 0x15, 0xc0, 0x60, 0x01, 0x64, 0x0d, 0x40, 0x16, 0x59, 0x64, 0x15, 0x40, 0x56, 0x01,
+  0x64, 0x15, 0x40, 0x56, 0x01, 0x64, 0x15, 0x40, 0x56, 0x01, 0x64, 0x15, 0xc0, 0x54, 0x01, 0x54,
+  0x15, 0x40, 0xd6, 0x00, 0x64, 0x91, 0x15, 0x96, 0x00, 0x2b, 0x2d, 0x35, 0x16, 0x84, 0x3b, 0x4d,
+  0x35, 0x21, 0x8a, 0x53, 0x4d, 0xb8, 0x22, 0x8a, 0x63, 0x2d, 0x35, 0x55, 0x58, 0xa0, 0x00, 0x34,
+  0x00, 0x0b, 0x6d, 0xb4, 0xd2, 0x4c, 0x00, 0x6c, 0xb4, 0xd2, 0x4e, 0x43, 0x01, 0xb0, 0xd1, 0x4a,
+  0x3b, 0x0d, 0x25, 0xc0, 0x46, 0x2b, 0xed, 0x34, 0x94, 0x00, 0x0b, 0x6d, 0xb4, 0xd2, 0x4c, 0x00,
+  0x2c, 0x24, 0xd3, 0x54, 0x32, 0x2d, 0x24, 0x86, 0x70, 0x33, 0xa9, 0x34, 0x94, 0x4a, 0x0b, 0x49,
+  0x21, 0xdb, 0x42, 0x32, 0x4d, 0x25, 0xd3, 0x42, 0x62, 0x08, 0x37, 0x93, 0x4a, 0x0b, 0x69, 0xb4,
+  0x52, 0x4c, 0xb4, 0x00, 0x33, 0x00, 0x0b, 0xc9, 0x34, 0x95, 0x4c, 0x0b, 0x89, 0x21, 0xdc, 0x4c,
+  0x2a, 0x0d, 0xa5, 0xd2, 0x10, 0x52, 0xc8, 0xb6, 0x90, 0x4c, 0x53, 0xc9, 0xb4, 0x90, 0x18, 0xc2,
+  0xcd, 0xa4, 0xd2, 0x42, 0x1a, 0xad, 0x24, 0xdb, 0x42, 0x1b, 0xad, 0x34, 0x13, 0x00, 0x1b, 0xad,
+  0xb4, 0xd3, 0x50, 0x00, 0x6c, 0xb4, 0xd2, 0x4e, 0x43, 0x09, 0xb0, 0xd1, 0x4a, 0x3b, 0x0d, 0x25,
+  0xc0, 0x42, 0x1b, 0xad, 0x34, 0x13, 0x7d, 0x00, 0x1a, 0x00, 0x63, 0x2d, 0xa5, 0xd2, 0x4a, 0x2b,
+  0xa9, 0xb4, 0xd2, 0x4a, 0x2b, 0xad, 0x34, 0xd2, 0x4a, 0x3a, 0x4d, 0xb5, 0x93, 0x48, 0x23, 0x8d,
+  0x24, 0xd2, 0x48, 0x23, 0x8d, 0x34, 0xd2, 0x44, 0x23, 0xa9, 0x04, 0x50, 0x00, 0x16, 0x00, 0x0b,
+  0xcd, 0x14, 0xd3, 0x54, 0x43, 0xcd, 0x14, 0xd5, 0x54, 0x43, 0xc5, 0xa4, 0x51, 0x42, 0x0b, 0xcd,
+  0x14, 0xd3, 0x54, 0x43, 0xcd, 0x14, 0xd5, 0x50, 0x53, 0x25, 0x0a, 0x64, 0x00, 0x18, 0x00, 0xc3,
+  0xb1, 0xa4, 0x90, 0x4a, 0x42, 0x25, 0xb8, 0x2a, 0x87, 0x0a, 0xaa, 0xa4, 0x53, 0x50, 0x42, 0xa9,
+  0xba, 0xa1, 0x82, 0x61, 0x4d, 0x47, 0x96, 0x82, 0x0a, 0x0a, 0xa5, 0x92, 0x42, 0x8c, 0x00, 0x10,
+  0x00, 0x42, 0x0a, 0x29, 0xa5, 0xae, 0x43, 0x4a, 0x29, 0xa6, 0x98, 0x0a, 0x8b, 0x3b, 0xa5, 0x90,
+  0x52, 0x0a, 0xa9, 0xa3, 0x90, 0x46, 0x00, 0x27, 0x00, 0xab, 0xac, 0xb0, 0xc2, 0x2a, 0x33, 0x0c,
+  0x31, 0x85, 0x10, 0x03, 0x0c, 0x31, 0xc5, 0x14, 0x43, 0x28, 0x24, 0xc4, 0x0c, 0xaa, 0x0c, 0xb0,
+  0xc2, 0x0c, 0x43, 0x6c, 0xa0, 0xc1, 0x06, 0x2b, 0xcc, 0xa0, 0x00, 0x01, 0x0b, 0x6c, 0xb0, 0xc0,
+  0x0a, 0x42, 0x10, 0x30, 0xc4, 0x10, 0x53, 0x28, 0x44, 0x00, 0x7d, 0x00, 0x23, 0x00, 0xa3, 0x92,
+  0xb8, 0x55, 0x88, 0x4b, 0x69, 0x15, 0xd2, 0x56, 0x23, 0x6e, 0x35, 0x63, 0x88, 0x93, 0x32, 0xc8,
+  0xd5, 0x72, 0x59, 0x8d, 0x4a, 0xe2, 0x56, 0x21, 0x0e, 0xa5, 0xd4, 0x56, 0x21, 0x2d, 0x25, 0xd4,
+  0x48, 0x4a, 0x09, 0xa5, 0x94, 0x50, 0x23, 0xc9, 0x16, 0x12, 0x7d, 0x00, 0x14, 0x00, 0x22, 0x6e,
+  0x15, 0x22, 0x01, 0x4b, 0x69, 0x25, 0xda, 0x00, 0x44, 0x71, 0x35, 0xe2, 0x56, 0x33, 0x86, 0x48,
+  0xc0, 0xa4, 0x0c, 0x72, 0xb5, 0x5c, 0x56, 0x64, 0x00, 0x1e, 0x00, 0x42, 0x29, 0xba, 0xa0, 0x82,
+  0x2a, 0x6a, 0xba, 0xa0, 0x86, 0x2b, 0x6e, 0xa8, 0xe8, 0x82, 0x2a, 0x0a, 0x19, 0xad, 0x94, 0xc2,
+  0xae, 0xa8, 0xa2, 0x82, 0x9a, 0x2e, 0xa8, 0xe1, 0x8a, 0x1b, 0x2a, 0x3a, 0x95, 0x54, 0x42, 0x25,
+  0x0a, 0x8c, 0x00, 0x1a, 0x00, 0x0a, 0xc9, 0x24, 0xd3, 0x50, 0x53, 0xc9, 0x24, 0xd3, 0x54, 0x5b,
+  0x29, 0xa8, 0xa0, 0x86, 0x59, 0x0d, 0x35, 0x95, 0x56, 0x5a, 0x29, 0x28, 0x95, 0x54, 0x33, 0x4d,
+  0x25, 0x94, 0x46, 0x32, 0xa5, 0x04, 0x7d, 0x00, 0x39, 0x00, 0x42, 0x6d, 0x47, 0x14, 0x01, 0x44,
+  0x2d, 0x38, 0xd4, 0x4c, 0x42, 0x6d, 0x4a, 0x14, 0x01, 0x44, 0x8d, 0xb8, 0xe1, 0x56, 0x43, 0x6d,
+  0x38, 0x24, 0x51, 0x34, 0x11, 0x40, 0xd3, 0x46, 0x5b, 0x05, 0x25, 0x00, 0x8d, 0x1b, 0x2e, 0xb8,
+  0x95, 0x50, 0xdb, 0x11, 0x45, 0x00, 0x51, 0x0b, 0x0e, 0x35, 0x93, 0x50, 0x9b, 0x12, 0x45, 0x00,
+  0x51, 0x23, 0x6e, 0xb8, 0xd5, 0x50, 0x1b, 0x0e, 0x49, 0x14, 0x4d, 0x04, 0xd0, 0xb4, 0xd1, 0x56,
+  0x41, 0x01, 0x64, 0x00, 0x11, 0x00, 0x0a, 0x29, 0x24, 0x94, 0x50, 0x53, 0x8d, 0xb5, 0xe0, 0x54,
+  0x42, 0x09, 0x20, 0x93, 0x4c, 0x2a, 0xa9, 0xa4, 0x91, 0x46, 0x0a, 0x01, 0x64, 0x00, 0x47, 0x00,
+  0x12, 0x28, 0x33, 0x91, 0x38, 0x5c, 0x30, 0xb1, 0xcd, 0x32, 0x3b, 0x28, 0xc3, 0x04, 0x13, 0xc9,
+  0x48, 0xa4, 0xdc, 0x84, 0xe2, 0x71, 0xc5, 0xd4, 0x76, 0xcb, 0xed, 0x84, 0x94, 0x72, 0x92, 0x05,
+  0xd7, 0x5c, 0x77, 0x4b, 0xcd, 0x34, 0x91, 0x50, 0xcd, 0x75, 0xb7, 0xdc, 0x68, 0xcb, 0x8d, 0x2a,
+  0xaa, 0x86, 0x8d, 0x76, 0x1a, 0x2a, 0x49, 0x4c, 0x91, 0xc4, 0x14, 0x85, 0x5c, 0x91, 0xc8, 0xa4,
+  0xa4, 0xba, 0x25, 0x5a, 0x69, 0xa9, 0x13, 0x6e, 0xb5, 0x93, 0x82, 0x95, 0x96, 0x3a, 0xe9, 0x72,
+  0x93, 0x2e, 0xab, 0xac, 0x90, 0xb5, 0x16, 0x9b, 0x2c, 0xc8, 0x00, 0x31, 0x00, 0x13, 0x6d, 0xa4,
+  0x92, 0x44, 0x1a, 0x89, 0x21, 0x91, 0x14, 0x62, 0x08, 0x40, 0x21, 0x01, 0x1c, 0x12, 0xb0, 0xe2,
+  0x00, 0x13, 0x0e, 0xb0, 0xe1, 0x00, 0x63, 0x0d, 0x30, 0xe1, 0x00, 0x53, 0x0d, 0x20, 0x96, 0x00,
+  0x52, 0x48, 0x21, 0x86, 0x44, 0x52, 0x48, 0x24, 0x86, 0x00, 0x53, 0x0d, 0x30, 0xd5, 0x00, 0x63,
+  0x0d, 0x30, 0xe1, 0x00, 0x53, 0x0d, 0x30, 0xe1, 0x00, 0x63, 0x01, 0x7d, 0x00, 0x17, 0x00, 0x4b,
+  0xad, 0xb4, 0xd4, 0x84, 0x52, 0x09, 0xb0, 0xd3, 0x48, 0x3b, 0x8d, 0xa5, 0xd4, 0x4e, 0x2b, 0x09,
+  0xb0, 0xd2, 0x44, 0x3a, 0x49, 0x24, 0xc0, 0x4e, 0x2b, 0x29, 0xa5, 0x13, 0xb4, 0x00, 0x1b, 0x00,
+  0x1b, 0x6d, 0x34, 0xd1, 0x44, 0x0b, 0x2d, 0x34, 0xd1, 0x44, 0x1b, 0x6d, 0x34, 0xd1, 0x44, 0x0b,
+  0x2d, 0x34, 0xd1, 0x44, 0x1b, 0x8d, 0xb4, 0xd0, 0x44, 0x0b, 0x2d, 0x34, 0xd1, 0x44, 0x33, 0x0d,
+  0x20, 0x13, 0x7d, 0x00, 0x2f, 0x00, 0x9b, 0xb1, 0x34, 0xd4, 0x50, 0x2c, 0x71, 0x44, 0x05, 0x19,
+  0x1c, 0x91, 0xb1, 0x12, 0x47, 0x64, 0x50, 0x41, 0xc6, 0x14, 0x54, 0x70, 0x41, 0x06, 0x47, 0x2c,
+  0x71, 0x24, 0xd4, 0x00, 0x1c, 0xb1, 0xc4, 0xd1, 0x50, 0x43, 0xb1, 0xc4, 0x11, 0x15, 0x64, 0x70,
+  0x44, 0xc6, 0x4a, 0x1c, 0x91, 0x41, 0x05, 0x19, 0x1b, 0x71, 0xc4, 0x11, 0x4f, 0x54, 0xcd, 0xa4,
+  0x11, 0x64, 0x00, 0x32, 0x00, 0x44, 0x11, 0x45, 0x15, 0x55, 0x2c, 0xb1, 0x34, 0x14, 0x51, 0x44,
+  0x51, 0x45, 0x15, 0x4b, 0x2c, 0x0d, 0x45, 0x14, 0x51, 0x54, 0x51, 0xc5, 0x20, 0x83, 0x63, 0x8d,
+  0x35, 0xd5, 0x50, 0x33, 0xd1, 0x44, 0x13, 0x51, 0x44, 0x71, 0xc4, 0xd1, 0x4c, 0x34, 0xd1, 0x44,
+  0x14, 0x51, 0x1c, 0x71, 0x34, 0x13, 0x4d, 0x34, 0x11, 0x45, 0x14, 0x55, 0x64, 0x2d, 0x38, 0xd5,
+  0x50, 0x2b, 0x29, 0x04, 0xb4, 0x00, 0x25, 0x00, 0xb2, 0x29, 0x35, 0x93, 0x68, 0x0a, 0x8d, 0x24,
+  0x9b, 0x52, 0x33, 0x69, 0xb5, 0x94, 0x6c, 0x22, 0xcd, 0x04, 0xc0, 0x52, 0x4a, 0xcd, 0x04, 0x80,
+  0x6c, 0x4a, 0xcd, 0x24, 0x9a, 0x42, 0x23, 0xc9, 0xa6, 0xd4, 0x4c, 0x5a, 0x2d, 0x25, 0x9b, 0x48,
+  0x33, 0x01, 0xb0, 0x94, 0x52, 0x33, 0x01, 0x8c, 0x00, 0x33, 0x00, 0x43, 0xad, 0x24, 0xc0, 0x00,
+  0x2b, 0xcd, 0x34, 0x94, 0x8a, 0x2a, 0x26, 0x38, 0xd4, 0x4a, 0x02, 0x0c, 0xb0, 0xd2, 0x4c, 0x2b,
+  0x09, 0x25, 0x54, 0x4c, 0x33, 0x6d, 0x24, 0xc0, 0x00, 0x1b, 0xad, 0x34, 0xd3, 0x50, 0x2b, 0x09,
+  0x30, 0xc0, 0x4a, 0x3b, 0xad, 0xb4, 0xd1, 0x50, 0x03, 0xac, 0xb4, 0xd3, 0x46, 0x03, 0x4c, 0x35,
+  0x1c, 0x4f, 0x43, 0x4d, 0x35, 0xd4, 0x4c, 0x2b, 0x6d, 0xb4, 0x10, 0x50, 0x00, 0x30, 0x00, 0x0a,
+  0x2e, 0x48, 0x16, 0x83, 0x1c, 0x32, 0x48, 0x16, 0x55, 0x0b, 0x32, 0x48, 0x95, 0x82, 0x0b, 0x92,
+  0xc5, 0x20, 0x55, 0x44, 0xb1, 0x44, 0x53, 0x50, 0x44, 0xd1, 0xc4, 0x12, 0x47, 0x2c, 0xd1, 0x44,
+  0x14, 0x55, 0x42, 0x09, 0x45, 0x14, 0x55, 0x64, 0x51, 0x45, 0x14, 0x4d, 0x2c, 0x71, 0xc4, 0x12,
+  0x47, 0x0b, 0x2d, 0xc4, 0x10, 0x47, 0x2b, 0xcd, 0xa4, 0x51, 0x50, 0x40, 0x01, 0x24, 0x00, 0x0a,
+  0x6d, 0xb4, 0x91, 0x46, 0x19, 0x29, 0xa4, 0x90, 0x42, 0x0a, 0x8d, 0x34, 0x52, 0x48, 0x1a, 0x69,
+  0xa4, 0x91, 0x42, 0x1b, 0x6d, 0xa4, 0x51, 0x46, 0x0a, 0x29, 0xa4, 0x90, 0x42, 0x23, 0x8d, 0x24,
+  0x52, 0x48, 0x1a, 0x49, 0xa4, 0x90, 0x82, 0xe0, 0x09, 0x25, 0x13, 0x70, 0x40, 0x01, 0x25, 0x00,
+  0x0a, 0x6d, 0xb4, 0x91, 0x46, 0x19, 0x29, 0xa4, 0x90, 0x42, 0x0a, 0x8d, 0x34, 0x92, 0x48, 0x21,
+  0x69, 0xa4, 0x91, 0x46, 0x0a, 0x6d, 0xb4, 0x91, 0x46, 0x19, 0x29, 0xa4, 0x90, 0x42, 0x0a, 0x8d,
+  0x34, 0x92, 0x48, 0x21, 0x69, 0x24, 0x91, 0x42, 0x0a, 0x82, 0x27, 0x94, 0x4c, 0xc0, 0x01, 0x50,
+  0x00, 0x26, 0x00, 0x05, 0x50, 0x58, 0x62, 0x89, 0x24, 0x8e, 0x48, 0x21, 0x85, 0x14, 0x52, 0xd8,
+  0x62, 0x8b, 0x2c, 0xae, 0x48, 0x22, 0x89, 0x24, 0x52, 0x58, 0x62, 0x89, 0x24, 0x8e, 0x48, 0x21,
+  0x85, 0x14, 0x52, 0xd8, 0x62, 0x8b, 0x2c, 0xae, 0x48, 0x22, 0x87, 0x14, 0x52, 0xac, 0x38, 0x93,
+  0x3c, 0x2a, 0x0b, 0x8c, 0x00, 0x25, 0x00, 0x2b, 0x0d, 0x25, 0x94, 0x50, 0x43, 0x09, 0x35, 0x95,
+  0x4c, 0xb2, 0x0d, 0xb0, 0xd2, 0x50, 0x42, 0x09, 0x35, 0x94, 0x50, 0x53, 0xc9, 0x24, 0xdb, 0x00,
+  0x2b, 0xa9, 0xa4, 0x99, 0x46, 0x33, 0x29, 0xa4, 0xd8, 0x00, 0x0b, 0xa9, 0xa4, 0x92, 0x46, 0x1a,
+  0xcd, 0xa4, 0x90, 0x62, 0x03, 0x00, 0x50, 0x00, 0x36, 0x00, 0x1b, 0xed, 0x34, 0xd5, 0x86, 0x13,
+  0xad, 0x34, 0xd5, 0x84, 0x1b, 0xed, 0x34, 0xd6, 0x86, 0x53, 0x4d, 0xb4, 0xd3, 0x54, 0x63, 0x6d,
+  0x34, 0xd4, 0x58, 0x53, 0x6d, 0xb4, 0xd3, 0x54, 0x63, 0xed, 0x34, 0xd4, 0x58, 0x13, 0xad, 0x34,
+  0xd5, 0x84, 0x3a, 0xee, 0x34, 0x95, 0x8a, 0x2b, 0x4d, 0xa5, 0xe1, 0x4e, 0x53, 0x49, 0x38, 0xd1,
+  0x4a, 0x62, 0x6d, 0x34, 0x94, 0x54, 0x3b, 0x6d, 0x24, 0xd6, 0x46, 0x43, 0x49, 0x0a, 0xfa, 0x00,
+  0x34, 0x00, 0x53, 0x0d, 0xb0, 0xe1, 0x00, 0x53, 0x0d, 0xb0, 0xe1, 0x00, 0x53, 0x6d, 0x38, 0xc0,
+  0x54, 0x03, 0x2c, 0x25, 0xd5, 0x54, 0x4b, 0x4d, 0x25, 0xd4, 0x4e, 0x43, 0xed, 0x24, 0xdb, 0x66,
+  0x04, 0x08, 0x32, 0xd5, 0x00, 0x1b, 0x0e, 0x30, 0xd5, 0x00, 0x1b, 0x0e, 0x30, 0xd5, 0x86, 0x03,
+  0x4c, 0x35, 0xc0, 0x52, 0x53, 0x0d, 0x30, 0xd4, 0x00, 0xc2, 0xed, 0x34, 0xd4, 0x00, 0x0b, 0x6a,
+  0x25, 0x95, 0x50, 0x55, 0x00, 0x19, 0x00, 0x13, 0xf1, 0xc6, 0x1c, 0x77, 0x4a, 0xc9, 0x34, 0xc0,
+  0x44, 0xbc, 0x31, 0xc7, 0x5d, 0x52, 0x03, 0x4c, 0xc4, 0x1b, 0x73, 0xdc, 0x29, 0x25, 0xd3, 0x00,
+  0x33, 0xf1, 0x46, 0x1b, 0x65, 0x11, 0x01, 0x7d, 0x00, 0x0c, 0x00, 0x3b, 0xee, 0xb8, 0xe3, 0x8e,
+  0x42, 0xee, 0xa8, 0xe2, 0x8a, 0x53, 0xea, 0xa8, 0x61, 0x00, 0x8c, 0x00, 0x36, 0x00, 0x43, 0xad,
+  0x24, 0xc0, 0x00, 0x2b, 0xcd, 0x34, 0xd4, 0x8a, 0x03, 0xac, 0x38, 0x40, 0x82, 0x43, 0xad, 0x24,
+  0xc0, 0x00, 0x2b, 0xcd, 0xb4, 0xd2, 0x50, 0x03, 0x0c, 0x35, 0x40, 0x4c, 0x33, 0x6d, 0x24, 0xc0,
+  0x00, 0x1b, 0xad, 0x34, 0xd3, 0x50, 0x2b, 0x09, 0x30, 0xc0, 0x4a, 0x3b, 0xad, 0xb4, 0xd1, 0x50,
+  0x03, 0xac, 0xb4, 0xd3, 0x46, 0x03, 0x4c, 0x35, 0x1c, 0x4f, 0x43, 0x4d, 0x35, 0xd4, 0x4c, 0x2b,
+  0x6d, 0x04, 0xc8, 0x00, 0x1f, 0x00, 0x0a, 0x29, 0x24, 0x91, 0x46, 0x02, 0xc8, 0xa4, 0x91, 0x4c,
+  0x1a, 0x49, 0xa4, 0x90, 0x42, 0x42, 0x29, 0xa4, 0x90, 0x00, 0x42, 0x29, 0x24, 0x91, 0x46, 0x02,
+  0xc8, 0xa4, 0x91, 0x4c, 0x1a, 0x69, 0x24, 0x91, 0x42, 0x42, 0x29, 0xa4, 0x10, 0x7d, 0x00, 0x2d,
+  0x00, 0x02, 0x0c, 0x40, 0x16, 0x55, 0x62, 0xa9, 0x24, 0xc0, 0x00, 0x0c, 0x92, 0xb5, 0xe0, 0x58,
+  0x52, 0x09, 0x30, 0x00, 0x83, 0x64, 0x29, 0xa8, 0x92, 0x00, 0x03, 0x50, 0x45, 0xd4, 0x54, 0x43,
+  0xed, 0x34, 0x95, 0x70, 0x3c, 0x11, 0x25, 0x1d, 0x51, 0x54, 0x8d, 0x35, 0xd5, 0x50, 0x3b, 0xa9,
+  0xa4, 0x60, 0x78, 0x64, 0x31, 0x48, 0x16, 0x55, 0x60, 0x01, 0xa0, 0x00, 0x42, 0x00, 0x32, 0xcd,
+  0x46, 0xd4, 0x74, 0x44, 0xcd, 0xc6, 0x90, 0x46, 0x32, 0x25, 0x24, 0x93, 0x50, 0x52, 0x0d, 0x47,
+  0x93, 0x50, 0xc3, 0x51, 0x15, 0x94, 0x42, 0x8b, 0x31, 0x24, 0xd3, 0x62, 0x0c, 0x69, 0xb4, 0x19,
+  0x47, 0x41, 0xa9, 0xb4, 0x1a, 0x4b, 0x2a, 0xad, 0xc6, 0x91, 0x42, 0x9b, 0xb1, 0x14, 0x93, 0x54,
+  0x89, 0x6a, 0xba, 0xe1, 0x82, 0xd2, 0x2d, 0xc6, 0xd0, 0x62, 0x0c, 0xa9, 0x24, 0x54, 0x6c, 0x02,
+  0x48, 0x95, 0xa8, 0xa6, 0x1b, 0x2e, 0x28, 0xdd, 0x62, 0x0c, 0x2d, 0xc6, 0x90, 0x4a, 0x42, 0xc5,
+  0x06, 0x7d, 0x00, 0x22, 0x00, 0x2b, 0x49, 0xb7, 0x92, 0xaa, 0x53, 0x49, 0x38, 0xd6, 0x84, 0x52,
+  0xa9, 0x24, 0x95, 0x8e, 0x2a, 0x4e, 0xb8, 0x61, 0xaa, 0x03, 0xac, 0x24, 0x95, 0x8e, 0x2a, 0x4e,
+  0xb8, 0xa1, 0x8a, 0x63, 0x4d, 0x28, 0x95, 0x4a, 0x52, 0x4d, 0xb8, 0xa1, 0x78, 0x53, 0x45, 0x05,
+  0x7d, 0x00, 0x10, 0x00, 0x34, 0xb1, 0x44, 0x13, 0x4b, 0x34, 0xb1, 0xb4, 0x11, 0x4b, 0x1c, 0xb1,
+  0xc4, 0x11, 0x4b, 0x1c, 0x31, 0xc4, 0x91, 0x46, 0x50, 0x00, 0x3e, 0x00, 0x2c, 0x10, 0xc1, 0x02,
+  0x0b, 0x2c, 0xf0, 0xc0, 0x02, 0x0b, 0x2c, 0x70, 0xc1, 0x02, 0x15, 0x2c, 0x10, 0xc1, 0x02, 0x0b,
+  0x2c, 0x10, 0xc1, 0x02, 0x0b, 0x2c, 0xf0, 0xc0, 0x02, 0x0b, 0x2c, 0x70, 0xc1, 0x02, 0x15, 0x2c,
+  0x10, 0xc1, 0x02, 0x0f, 0x44, 0x70, 0x41, 0x04, 0x11, 0x44, 0x30, 0x44, 0x04, 0x11, 0x44, 0x50,
+  0x44, 0x04, 0x43, 0x44, 0x70, 0x41, 0x04, 0x11, 0x44, 0x70, 0x41, 0x04, 0x11, 0x44, 0x30, 0x44,
+  0x04, 0x11, 0x44, 0x50, 0x44, 0x04, 0x43, 0x44, 0x6c, 0x01, 0x70, 0x00, 0x1f, 0x00, 0x2b, 0x0d,
+  0x35, 0xc0, 0x88, 0x9a, 0x0e, 0xb5, 0x55, 0x78, 0x43, 0x51, 0x45, 0x94, 0x6e, 0x64, 0xac, 0x14,
+  0x99, 0x00, 0x2b, 0x0d, 0x35, 0xc0, 0x88, 0x9a, 0x0e, 0xb5, 0x55, 0x78, 0x43, 0x51, 0x45, 0x94,
+  0x6e, 0x64, 0x8c, 0x94, 0x1a, 0x5a, 0x00, 0x3d, 0x00, 0x3c, 0x50, 0x41, 0x00, 0x19, 0x03, 0xf0,
+  0x40, 0x06, 0x01, 0x14, 0x0d, 0xc0, 0x03, 0x45, 0x04, 0x70, 0x44, 0x00, 0x0f, 0x04, 0x4c, 0x44,
+  0x06, 0x15, 0x3c, 0xb0, 0x40, 0x03, 0x0f, 0x44, 0x90, 0x41, 0x05, 0x11, 0x3c, 0x50, 0x41, 0x00,
+  0x0f, 0x54, 0x10, 0x40, 0xc6, 0x00, 0x3c, 0x90, 0x41, 0x00, 0x45, 0x03, 0xf0, 0x40, 0x11, 0x01,
+  0x1c, 0x11, 0xc0, 0x03, 0x01, 0x13, 0x91, 0x41, 0x05, 0x0f, 0x2c, 0xd0, 0xc0, 0x03, 0x11, 0x64,
+  0x50, 0x41, 0x04, 0x0f, 0x54, 0x00, 0x64, 0x00, 0x27, 0x00, 0x63, 0x4d, 0x38, 0xe2, 0x8a, 0x3a,
+  0x2a, 0x99, 0xaa, 0x00, 0x2b, 0x8e, 0x38, 0xe1, 0x58, 0xe2, 0xed, 0xb4, 0xdb, 0x78, 0x3b, 0x8a,
+  0x25, 0xe1, 0x58, 0x13, 0x8e, 0xb8, 0xa2, 0x8e, 0x4a, 0xa6, 0x2a, 0xc0, 0x8a, 0x23, 0x4e, 0x38,
+  0x96, 0x78, 0x3b, 0x8d, 0xba, 0xea, 0x8e, 0x22, 0x4a, 0x18, 0x16, 0x8c, 0x00, 0x26, 0x00, 0x1b,
+  0x8d, 0xb4, 0x92, 0x82, 0x2b, 0x29, 0xb8, 0x52, 0xa2, 0x0b, 0x6e, 0x38, 0xe2, 0x8a, 0x0b, 0x6e,
+  0xa8, 0xe2, 0x58, 0x1a, 0x26, 0x28, 0xc0, 0x46, 0x23, 0xad, 0xa4, 0xe0, 0x4a, 0x0a, 0xae, 0x94,
+  0xe8, 0x00, 0x53, 0x0d, 0xb5, 0xd3, 0x54, 0x0b, 0xaa, 0xb8, 0xe1, 0x82, 0x53, 0x65, 0x08, 0x8c,
+  0x00, 0x1c, 0x00, 0xc3, 0x6d, 0xb6, 0xd5, 0x54, 0x0b, 0x4e, 0x35, 0xd3, 0x70, 0x9b, 0x6d, 0x35,
+  0xd5, 0x82, 0x53, 0xcd, 0xb4, 0xdd, 0x6c, 0x1b, 0x2e, 0xb8, 0xe1, 0x82, 0x53, 0x6d, 0x37, 0xdc,
+  0x56, 0x53, 0x6d, 0x35, 0xd5, 0x4c, 0x7d, 0x00, 0x2c, 0x00, 0x63, 0x2d, 0xb8, 0xe1, 0x84, 0x1b,
+  0x4e, 0xb8, 0xe1, 0x90, 0xaa, 0x6e, 0xb8, 0xe0, 0x58, 0x0b, 0x8e, 0xb5, 0xe0, 0x58, 0x0b, 0xee,
+  0xa8, 0xe9, 0x82, 0x63, 0x4d, 0x35, 0xd4, 0x4e, 0x43, 0xed, 0x34, 0xd4, 0x86, 0x0b, 0x8e, 0xb5,
+  0xe0, 0x58, 0x53, 0x0d, 0xb5, 0xd3, 0x50, 0x2b, 0xed, 0xa4, 0xd1, 0x82, 0x1b, 0x8e, 0xb5, 0xa0,
+  0x54, 0xa0, 0x00, 0x29, 0x00, 0x43, 0xcd, 0x34, 0xd4, 0x4c, 0x2a, 0x29, 0x24, 0xc0, 0x4a, 0x33,
+  0x0d, 0x35, 0xd3, 0x50, 0x33, 0xad, 0x34, 0xd3, 0x50, 0x53, 0x6d, 0x35, 0xd5, 0x56, 0x53, 0x09,
+  0x25, 0x80, 0x52, 0x42, 0xe9, 0x24, 0xd3, 0x48, 0x1b, 0x2d, 0xb4, 0x91, 0x48, 0x02, 0x8c, 0xb4,
+  0xd1, 0x42, 0x1b, 0x89, 0xa4, 0x90, 0x50, 0x02, 0x00, 0x28, 0x00, 0x4c, 0x00, 0x05, 0xd0, 0xc8,
+  0x15, 0x97, 0x45, 0xd2, 0xc8, 0x1d, 0x8d, 0x25, 0x76, 0xd8, 0x61, 0x89, 0x35, 0x72, 0xc5, 0xa0,
+  0x86, 0x34, 0x72, 0xc7, 0x65, 0x91, 0x34, 0x72, 0x57, 0x63, 0x8d, 0x25, 0x76, 0xd8, 0x61, 0x89,
+  0x35, 0x72, 0xc5, 0xa0, 0x56, 0x54, 0x72, 0xca, 0x65, 0x95, 0x55, 0x16, 0xd9, 0x63, 0x95, 0x43,
+  0x12, 0xc9, 0x68, 0x95, 0x55, 0x16, 0x59, 0x64, 0x8d, 0x2d, 0x16, 0x39, 0x23, 0x8d, 0xdc, 0x71,
+  0x59, 0x24, 0x8d, 0xdc, 0xd1, 0x58, 0x62, 0x87, 0x1d, 0x96, 0x58, 0x23, 0x57, 0x8c, 0x76, 0x58,
+  0x62, 0x8d, 0x5c, 0x31, 0xda, 0x61, 0x89, 0x35, 0x72, 0xc9, 0xf0, 0xb6, 0xc8, 0x00, 0x23, 0x00,
+  0x4a, 0x49, 0x34, 0x80, 0x84, 0x5b, 0x29, 0x25, 0xd1, 0x00, 0x4a, 0xed, 0x34, 0xd3, 0x4c, 0x3b,
+  0x2d, 0x25, 0x91, 0x48, 0x31, 0x05, 0xa0, 0x94, 0x44, 0x03, 0x48, 0xb8, 0x95, 0x52, 0x12, 0x0d,
+  0xa0, 0xd4, 0x4e, 0x33, 0xcd, 0xb4, 0xd3, 0x52, 0x12, 0x89, 0x14, 0x11, 0x46, 0x00, 0x76, 0x00,
+  0x1c, 0x51, 0xc4, 0x11, 0x45, 0x1c, 0x11, 0x40, 0x11, 0x01, 0x2c, 0x11, 0xd0, 0x51, 0x4f, 0x55,
+  0x75, 0xb8, 0x2b, 0x01, 0x44, 0xf2, 0x48, 0x24, 0x8f, 0x2c, 0x72, 0x48, 0x15, 0x4f, 0x9b, 0xf5,
+  0xd4, 0xe1, 0xa4, 0x04, 0x90, 0x45, 0x06, 0x19, 0x65, 0x54, 0x44, 0x06, 0x01, 0x54, 0x10, 0x40,
+  0x16, 0x19, 0x64, 0x94, 0x51, 0x11, 0x19, 0x04, 0x50, 0x41, 0x00, 0x87, 0x1c, 0x71, 0xc4, 0x11,
+  0x47, 0x14, 0xb1, 0xc4, 0x11, 0x47, 0x14, 0x91, 0x41, 0xc5, 0x90, 0x2d, 0x56, 0x58, 0x54, 0x4b,
+  0x1c, 0x51, 0xc4, 0x11, 0x45, 0x1c, 0x11, 0x40, 0x11, 0x01, 0x2c, 0x11, 0xd0, 0x51, 0x4f, 0x55,
+  0x75, 0xb8, 0x6b, 0x01, 0x44, 0xf2, 0x48, 0x24, 0x8f, 0x2c, 0x72, 0x48, 0x15, 0x4f, 0x9b, 0xf5,
+  0xd4, 0xe1, 0xa4, 0x04, 0x90, 0x45, 0x06, 0x19, 0x65, 0x54, 0x44, 0x06, 0x01, 0x54, 0x10, 0x40,
+  0x16, 0x19, 0x64, 0x94, 0x51, 0x11, 0x19, 0x04, 0x50, 0x41, 0x00, 0x59, 0x64, 0x8c, 0x31, 0x51,
+  0x01, 0x13, 0x6d, 0x06, 0x64, 0x00, 0x0b, 0x00, 0x8a, 0x29, 0xb4, 0x90, 0x62, 0x22, 0x6d, 0xa4,
+  0xd1, 0x42, 0x0a, 0x2d, 0x94, 0x18, 0x7d, 0x00, 0x19, 0x00, 0x0b, 0x2e, 0xb8, 0xd5, 0x82, 0x03,
+  0x0c, 0x35, 0xc0, 0x50, 0x0b, 0xce, 0xb8, 0xe2, 0x82, 0x01, 0x2c, 0xb8, 0xe0, 0x56, 0x0b, 0x0e,
+  0x30, 0xd4, 0x00, 0x43, 0x2d, 0x38, 0xe3, 0x8a, 0x0b, 0x02, 0x32, 0x00, 0x1c, 0x00, 0x25, 0xd5,
+  0xd4, 0x53, 0x53, 0x5c, 0xf1, 0x44, 0x15, 0x4d, 0x4c, 0xf1, 0x54, 0x52, 0x4d, 0x3d, 0x35, 0xc5,
+  0x15, 0x89, 0x1a, 0x96, 0x54, 0x53, 0x4f, 0x4d, 0x71, 0xc5, 0x13, 0x55, 0x34, 0x31, 0xc5, 0xd3,
+  0x48, 0x64, 0x00, 0x33, 0x01, 0x2b, 0x4e, 0xc5, 0x20, 0x87, 0x2b, 0x4e, 0xc5, 0x20, 0x87, 0x2b,
+  0x4e, 0xc5, 0x20, 0x87, 0x2b, 0x4e, 0xc5, 0x20, 0x87, 0x2b, 0x4e, 0x45, 0x21, 0x87, 0x2b, 0x4e,
+  0x45, 0x21, 0x87, 0x2b, 0x4e, 0x45, 0x21, 0x87, 0x2b, 0x4e, 0x45, 0x21, 0x87, 0xaa, 0x4a, 0xc7,
+  0x20, 0x87, 0x2a, 0x4a, 0xc5, 0x20, 0x87, 0x63, 0xad, 0x44, 0x14, 0x55, 0x63, 0xad, 0x44, 0x14,
+  0x55, 0x63, 0xad, 0x44, 0x14, 0x55, 0x63, 0xad, 0x44, 0x14, 0x55, 0x9a, 0x0a, 0xc7, 0x20, 0x59,
+  0x1a, 0x0a, 0xc5, 0x20, 0x59, 0x53, 0x6d, 0x44, 0x13, 0x51, 0x53, 0x6d, 0x44, 0x13, 0x51, 0x53,
+  0x6d, 0x44, 0x13, 0x51, 0x53, 0x6d, 0x44, 0x13, 0x51, 0xaa, 0x4a, 0xc7, 0x20, 0x87, 0x2a, 0x4a,
+  0xc5, 0x20, 0x87, 0x63, 0xad, 0x44, 0x14, 0x55, 0x63, 0xad, 0x44, 0x14, 0x55, 0x63, 0xad, 0x44,
+  0x14, 0x55, 0x63, 0xad, 0x44, 0x14, 0x55, 0x9a, 0x0a, 0xc7, 0x20, 0x59, 0x1a, 0x0a, 0xc5, 0x20,
+  0x59, 0x53, 0xad, 0x44, 0x13, 0x51, 0x53, 0xad, 0x44, 0x13, 0x51, 0x53, 0xad, 0x44, 0x13, 0x51,
+  0x53, 0xad, 0x44, 0x13, 0x51, 0xaa, 0x4a, 0xc7, 0x20, 0x87, 0x2a, 0x4a, 0xc5, 0x20, 0x87, 0x62,
+  0x11, 0x45, 0x95, 0x58, 0x44, 0x51, 0x25, 0x16, 0x51, 0x54, 0x89, 0x45, 0x14, 0x55, 0x9a, 0x0a,
+  0x37, 0xde, 0xa2, 0xe3, 0x0d, 0x37, 0xd5, 0x4a, 0x34, 0x11, 0x35, 0xd5, 0x4a, 0x34, 0x11, 0x35,
+  0xd5, 0x4a, 0x34, 0x11, 0x35, 0xd5, 0x4a, 0x34, 0x11, 0x35, 0xd5, 0x42, 0x34, 0x11, 0x35, 0xd5,
+  0x42, 0x34, 0x51, 0x35, 0xd4, 0x42, 0x2c, 0xd1, 0x34, 0xd4, 0x42, 0x2c, 0x11, 0x35, 0xd3, 0x14,
+  0x1c, 0xb1, 0x34, 0xd3, 0x14, 0x1c, 0xd1, 0xb4, 0xd2, 0x14, 0x0c, 0x71, 0xb4, 0xd2, 0x14, 0x0c,
+  0x71, 0xb4, 0xd0, 0x0a, 0x54, 0x90, 0xb1, 0xd0, 0x0a, 0x54, 0x90, 0xb1, 0xd0, 0x14, 0x0b, 0x6d,
+  0x34, 0xc6, 0x46, 0x53, 0x8c, 0xc0, 0x02, 0x0f, 0x53, 0x8c, 0xc0, 0x02, 0x0f, 0x53, 0x8c, 0xc0,
+  0x02, 0x0f, 0x53, 0x8c, 0xc0, 0x02, 0x0f, 0x53, 0x2d, 0x44, 0x13, 0x51, 0x53, 0x2d, 0x44, 0x13,
+  0x55, 0x43, 0x2d, 0xc4, 0x12, 0x4d, 0x43, 0x2d, 0xc4, 0x12, 0x51, 0x33, 0x4d, 0xc1, 0x11, 0x4b,
+  0x33, 0x4d, 0xc1, 0x11, 0x4d, 0x2b, 0x4d, 0xc1, 0x10, 0x47, 0x2b, 0x4d, 0xc1, 0x10, 0x47, 0x0b,
+  0xad, 0x40, 0x05, 0x19, 0x0b, 0xad, 0x40, 0x05, 0x19, 0x0b, 0x4d, 0xb1, 0xd0, 0x18, 0x3b, 0x8c,
+  0x31, 0xc5, 0x08, 0x2c, 0xf0, 0x30, 0xc5, 0x08, 0x2c, 0xf0, 0x30, 0xd5, 0x4a, 0x34, 0x11, 0x35,
+  0xd5, 0x4a, 0x34, 0x11, 0x35, 0xd5, 0x8a, 0x34, 0x12, 0x39, 0xe5, 0x8a, 0x34, 0x12, 0x39, 0xe5,
+  0x8a, 0x34, 0x12, 0x29, 0x2d, 0x7d, 0x00, 0x1c, 0x00, 0xc3, 0x0d, 0x37, 0xd4, 0x42, 0x0b, 0x6d,
+  0xb4, 0xd1, 0x70, 0xc3, 0x0d, 0xb5, 0xd5, 0x56, 0x0b, 0x2e, 0x38, 0xdc, 0x70, 0x43, 0x2d, 0xb4,
+  0xd0, 0x46, 0x1b, 0x0d, 0x37, 0xdc, 0x50, 0x5b, 0x6d, 0xb5, 0xe0, 0x86, 0x3f, 0x00, 0x1b, 0x00,
+  0x34, 0xd2, 0x48, 0x23, 0xc3, 0x4b, 0x12, 0xb9, 0x24, 0x8d, 0x34, 0x32, 0xbc, 0x24, 0x91, 0x4c,
+  0xd2, 0x48, 0x23, 0x8d, 0x0c, 0x2f, 0x49, 0xe4, 0x92, 0x34, 0xd2, 0x48, 0x24, 0x93, 0x44, 0x32,
+  0x49, 0x23, 0x91, 0x00, 0x0f, 0x00, 0x0c, 0x16, 0xc0, 0xe0, 0x8a, 0x0b, 0x6e, 0xb8, 0x55, 0x00,
+  0x0d, 0x16, 0xd0, 0x60, 0x01, 0x0b, 0x6e, 0xb5, 0x20, 0x64, 0x00, 0x1d, 0x00, 0x1b, 0x6d, 0x34,
+  0xd5, 0x54, 0x43, 0xcd, 0xb4, 0xd2, 0x46, 0x0b, 0x6d, 0xb4, 0xd2, 0x4c, 0x43, 0x49, 0x35, 0xc0,
+  0x46, 0x1b, 0x4d, 0x35, 0xd5, 0x50, 0x33, 0xad, 0xb4, 0xd1, 0x42, 0x1b, 0xad, 0x34, 0xd3, 0x50,
+  0x52, 0x01, 0x64, 0x00, 0x1a, 0x00, 0x33, 0xcd, 0x34, 0xd3, 0x50, 0x33, 0xcd, 0xa4, 0xd0, 0x46,
+  0x0b, 0x6d, 0xb4, 0x92, 0x4c, 0x32, 0xcd, 0x34, 0xd3, 0x4c, 0x43, 0xcd, 0x34, 0x93, 0x42, 0x1b,
+  0x2d, 0xb4, 0xd1, 0x4a, 0x32, 0xc9, 0x04, 0x7d, 0x00, 0x23, 0x00, 0x54, 0x71, 0x48, 0x15, 0x87,
+  0x51, 0xc9, 0x24, 0x54, 0x46, 0x02, 0x50, 0xc5, 0x21, 0x55, 0x1c, 0x46, 0x25, 0x93, 0x50, 0x09,
+  0x0a, 0x40, 0x15, 0x87, 0x54, 0x71, 0x18, 0x95, 0x4c, 0x2b, 0x6d, 0x94, 0x90, 0x00, 0x54, 0x71,
+  0x48, 0x15, 0x87, 0x51, 0x09, 0x95, 0x19, 0x38, 0x00, 0x21, 0x00, 0x05, 0x74, 0x55, 0x62, 0x57,
+  0x25, 0x6e, 0xc7, 0x1b, 0x73, 0x22, 0x75, 0x55, 0x62, 0x57, 0x25, 0x6e, 0xc7, 0x1b, 0x73, 0x12,
+  0x76, 0x55, 0x62, 0x57, 0x25, 0x6e, 0xc7, 0x5b, 0x6d, 0xa5, 0x49, 0xd4, 0x55, 0x89, 0x5d, 0x95,
+  0xb8, 0x1d, 0x73, 0x22, 0x01, 0x8c, 0x00, 0x25, 0x00, 0x42, 0x65, 0xa5, 0xa0, 0xa6, 0x23, 0x6a,
+  0x98, 0xa0, 0x54, 0xb2, 0x0d, 0x25, 0x55, 0x56, 0x42, 0x09, 0x37, 0x93, 0x50, 0x51, 0xc9, 0x94,
+  0x91, 0x50, 0x59, 0x29, 0xa8, 0xe9, 0x8a, 0x1a, 0x26, 0x28, 0x95, 0x6c, 0x43, 0x49, 0xa5, 0xdd,
+  0x54, 0x42, 0xe9, 0xb6, 0x92, 0x4e, 0x41, 0x01, 0xb4, 0x00, 0x28, 0x00, 0x1b, 0x0e, 0x35, 0xd4,
+  0x86, 0x43, 0x0d, 0xb5, 0xe1, 0x50, 0x23, 0x0e, 0xb5, 0xe1, 0x50, 0x43, 0x6d, 0x38, 0xd4, 0x50,
+  0x1b, 0x0e, 0x35, 0xe2, 0x50, 0x13, 0xee, 0xb4, 0xd3, 0x84, 0x3b, 0xed, 0x34, 0xe1, 0x4e, 0x1b,
+  0xee, 0x34, 0xe1, 0x4e, 0x3b, 0x4d, 0xb8, 0xd3, 0x4e, 0x13, 0xee, 0xb4, 0xe1, 0x4e, 0x7d, 0x00,
+  0x32, 0x00, 0xc3, 0x11, 0x25, 0x95, 0x50, 0x0a, 0x86, 0x35, 0x1c, 0x51, 0x52, 0x09, 0xa5, 0x61,
+  0x82, 0xc3, 0x11, 0x25, 0xa4, 0x8a, 0x0a, 0x8a, 0x25, 0xd5, 0xac, 0x34, 0xaa, 0xa8, 0xa0, 0x86,
+  0x09, 0x0e, 0x47, 0x94, 0x54, 0x42, 0x29, 0x18, 0xd6, 0x70, 0x44, 0x49, 0x25, 0x94, 0x86, 0x09,
+  0x0e, 0x47, 0x94, 0x90, 0x2a, 0x2a, 0x28, 0x96, 0x54, 0xb3, 0xd2, 0xa8, 0xa2, 0x82, 0x1a, 0x26,
+  0x08, 0x64, 0x00, 0x0f, 0x00, 0xd3, 0x51, 0x35, 0xd5, 0x50, 0x33, 0xad, 0x24, 0xd3, 0x46, 0x2c,
+  0xd1, 0x34, 0xd4, 0x42, 0x09, 0x65, 0x94, 0x10, 0xf0, 0x00, 0x54, 0x00, 0x4b, 0x11, 0xb0, 0x14,
+  0x01, 0x63, 0x11, 0x20, 0x22, 0x01, 0x91, 0x12, 0x90, 0x1c, 0x01, 0x4b, 0x11, 0xb0, 0x14, 0x01,
+  0x3b, 0x11, 0x20, 0x16, 0x01, 0x48, 0x09, 0xb2, 0x14, 0x01, 0x4b, 0x11, 0x30, 0x16, 0x01, 0x22,
+  0x12, 0x10, 0xe1, 0x00, 0xc9, 0x0e, 0xb0, 0x23, 0x01, 0x3b, 0x12, 0x30, 0x22, 0x01, 0x62, 0x11,
+  0x80, 0xac, 0x00, 0x61, 0x12, 0x30, 0xe5, 0x92, 0x3b, 0xae, 0x38, 0xe2, 0x84, 0x23, 0x8e, 0x15,
+  0xa1, 0x00, 0x13, 0x12, 0x30, 0xe6, 0x94, 0x43, 0xee, 0x38, 0xe2, 0x84, 0x63, 0x4d, 0x28, 0xe2,
+  0x84, 0x04, 0x88, 0x45, 0x80, 0xa4, 0x04, 0x24, 0x29, 0xc0, 0x8e, 0x04, 0xec, 0x48, 0xc0, 0x88,
+  0x04, 0x88, 0x45, 0x00, 0x84, 0xfa, 0x00, 0x2b, 0x00, 0x4b, 0x11, 0xb0, 0x14, 0x01, 0x63, 0x11,
+  0x20, 0x22, 0x01, 0x11, 0x12, 0x90, 0x1c, 0x01, 0x4b, 0x11, 0xb0, 0x14, 0x01, 0x3b, 0x11, 0x20,
+  0x16, 0x01, 0x48, 0x09, 0xb0, 0x14, 0x01, 0x4b, 0x11, 0x30, 0x16, 0x01, 0x22, 0x12, 0x10, 0x21,
+  0x01, 0xc9, 0x0e, 0xb0, 0x23, 0x01, 0x3b, 0x12, 0x30, 0x22, 0x01, 0x62, 0x11, 0x80, 0x2c, 0x64,
+  0x00, 0x18, 0x00, 0x2a, 0xa9, 0xa4, 0xd2, 0x42, 0x04, 0x10, 0xa5, 0xd2, 0x42, 0x04, 0x10, 0xa5,
+  0x92, 0x00, 0x62, 0x89, 0x25, 0xd6, 0x82, 0x04, 0x10, 0x25, 0xd2, 0x42, 0x04, 0x10, 0xa5, 0xd2,
+  0x00, 0x1c, 0x00, 0x2a, 0x00, 0x24, 0x91, 0xd4, 0x53, 0x4d, 0x15, 0x91, 0xc4, 0x15, 0x55, 0x4c,
+  0xf5, 0x44, 0x12, 0x49, 0x3d, 0xd5, 0x54, 0x11, 0x49, 0x5c, 0x51, 0xc5, 0x54, 0x4f, 0x24, 0x91,
+  0xd4, 0x53, 0x4d, 0x15, 0x91, 0xc4, 0x15, 0x55, 0x4c, 0xf5, 0x44, 0x12, 0x49, 0x3d, 0xd5, 0x54,
+  0x11, 0x49, 0x5c, 0x51, 0xc5, 0x54, 0x4f, 0x24, 0x91, 0x04, 0xfa, 0x00, 0x37, 0x00, 0x2a, 0x0d,
+  0x30, 0xd3, 0x50, 0x03, 0x20, 0x38, 0x88, 0x46, 0x03, 0xac, 0x04, 0x93, 0x20, 0x42, 0x0d, 0x30,
+  0xd5, 0x58, 0x03, 0xc0, 0x28, 0x80, 0x54, 0x03, 0x8c, 0x95, 0x60, 0x86, 0x29, 0xaa, 0x34, 0xc0,
+  0x4c, 0x43, 0x0d, 0x80, 0xa0, 0x00, 0x1a, 0x0e, 0xb0, 0x22, 0xac, 0x42, 0x0d, 0x30, 0x94, 0xaa,
+  0x03, 0x68, 0x38, 0xc0, 0x50, 0xaa, 0x0e, 0xa0, 0xe1, 0x00, 0x43, 0xc9, 0x3a, 0x80, 0x8a, 0x03,
+  0x6c, 0x98, 0x20, 0xfa, 0x00, 0x37, 0x00, 0x2a, 0x0d, 0x30, 0xd3, 0x50, 0x03, 0x24, 0x3a, 0x88,
+  0x46, 0x03, 0xac, 0x04, 0x93, 0x20, 0x42, 0x0d, 0x30, 0xd5, 0x58, 0x03, 0xc4, 0x2a, 0x80, 0x54,
+  0x03, 0x8c, 0x95, 0x60, 0x86, 0x29, 0xaa, 0x34, 0xc0, 0x4c, 0x43, 0x0d, 0x80, 0xa0, 0x00, 0x1a,
+  0x0e, 0xb0, 0x22, 0x8c, 0x42, 0x0d, 0x30, 0x94, 0xaa, 0x03, 0x68, 0x38, 0xc0, 0x50, 0xaa, 0x0e,
+  0xa0, 0xe1, 0x00, 0x43, 0xc9, 0x3a, 0x80, 0x8a, 0x03, 0x6c, 0x88, 0x20, 0xa0, 0x00, 0x1e, 0x00,
+  0xc2, 0xad, 0xb4, 0x92, 0x46, 0xc2, 0xad, 0xa4, 0xd2, 0x4a, 0x1b, 0x09, 0xa7, 0x92, 0x4a, 0x1b,
+  0x09, 0x35, 0xd4, 0x4a, 0x2a, 0xad, 0xb4, 0x91, 0x4c, 0x1a, 0x69, 0xb4, 0xd1, 0x42, 0x2a, 0x29,
+  0xa4, 0xd0, 0x42, 0x5a, 0x24, 0x04, 0xb4, 0x00, 0x12, 0x00, 0x0a, 0x09, 0x20, 0x92, 0x00, 0x22,
+  0xc9, 0x24, 0x93, 0x00, 0x4b, 0x0d, 0xb5, 0xd4, 0x50, 0x4b, 0x0d, 0x25, 0x92, 0x48, 0x32, 0xc9,
+  0x04, 0xa0, 0x00, 0x1d, 0x00, 0x0b, 0x4e, 0x25, 0xc0, 0x82, 0x53, 0x0a, 0xb0, 0xe0, 0x54, 0x0b,
+  0x4e, 0xb5, 0xe0, 0x94, 0x02, 0x0c, 0xb0, 0xe0, 0x86, 0x2b, 0x0e, 0xb0, 0xe2, 0x8c, 0x43, 0x0a,
+  0xb0, 0xe1, 0x82, 0x1a, 0xce, 0xa8, 0xa5, 0x94, 0x09, 0x03, 0x78, 0x00, 0x83, 0x00, 0x63, 0xad,
+  0xb8, 0xe4, 0x94, 0x4b, 0xae, 0x38, 0xd6, 0x54, 0x4b, 0x4d, 0x25, 0x9e, 0x00, 0x64, 0x91, 0xb5,
+  0xe2, 0x92, 0x53, 0x2e, 0xb9, 0xe2, 0x58, 0x53, 0x2d, 0x35, 0x95, 0x78, 0x03, 0x90, 0x45, 0xd6,
+  0x84, 0x14, 0xae, 0xc8, 0xe2, 0xae, 0x2c, 0xae, 0x38, 0x00, 0x8b, 0x2c, 0x4e, 0x38, 0xe1, 0x8a,
+  0x2b, 0xee, 0xb8, 0xe2, 0x8e, 0xca, 0x02, 0x20, 0x96, 0x58, 0x63, 0xf1, 0xc8, 0x23, 0x8f, 0xbb,
+  0x2e, 0xb9, 0xe3, 0x8a, 0x2b, 0xae, 0x38, 0xe1, 0x8a, 0x2b, 0x4e, 0xb8, 0xa3, 0x8a, 0xaa, 0x02,
+  0x30, 0xd6, 0x8a, 0x4b, 0x4e, 0xb9, 0xe4, 0x8a, 0x63, 0x4d, 0xb5, 0xd4, 0x54, 0xe2, 0x09, 0x40,
+  0x16, 0x59, 0x2b, 0x2e, 0x39, 0xe5, 0x92, 0x2b, 0x8e, 0x35, 0xd5, 0x52, 0x53, 0x89, 0x37, 0x00,
+  0x59, 0x64, 0x4d, 0x48, 0xe1, 0x8a, 0x2c, 0xee, 0xca, 0xe2, 0x8a, 0x03, 0xb0, 0xc8, 0xe2, 0x84,
+  0x13, 0xae, 0xb8, 0xe2, 0x8e, 0x2b, 0xee, 0xa8, 0x2c, 0x00, 0x62, 0x89, 0x35, 0x16, 0x8f, 0x3c,
+  0xf2, 0xb8, 0xeb, 0x92, 0x3b, 0xae, 0xb8, 0xe2, 0x8a, 0x13, 0xae, 0xb8, 0xe2, 0x84, 0x3b, 0xaa,
+  0xa8, 0x2a, 0x7d, 0x00, 0x43, 0x00, 0x0a, 0xca, 0xa8, 0xa0, 0x4c, 0x0a, 0xca, 0x98, 0xa0, 0x82,
+  0x32, 0x2a, 0x28, 0xa3, 0xb4, 0x43, 0xce, 0xb8, 0xe2, 0x86, 0x13, 0x2a, 0x28, 0xa3, 0x82, 0x32,
+  0x29, 0x28, 0x63, 0x82, 0xb2, 0x6e, 0xa8, 0xa0, 0x56, 0x52, 0x09, 0x25, 0x93, 0x00, 0x22, 0x2a,
+  0x29, 0xa2, 0x52, 0x22, 0x2a, 0x19, 0xa2, 0x88, 0x4a, 0x8a, 0xa8, 0xa4, 0xe2, 0x5b, 0x2e, 0x39,
+  0xe4, 0x8c, 0x2b, 0x8a, 0xa8, 0xa4, 0x88, 0x4a, 0x89, 0xa8, 0x64, 0x88, 0xca, 0xce, 0x28, 0xa2,
+  0x84, 0x0a, 0x0a, 0xa0, 0x95, 0x00, 0xca, 0x89, 0xa8, 0x24, 0x64, 0x00, 0x0f, 0x00, 0x32, 0x6d,
+  0x94, 0x85, 0x50, 0x23, 0x65, 0xa1, 0xd4, 0x4c, 0x4b, 0x09, 0x35, 0xd3, 0x48, 0x32, 0x6d, 0x94,
+  0x05, 0xaa, 0x00, 0x1d, 0x00, 0x62, 0x89, 0x25, 0x96, 0x00, 0x62, 0x89, 0x25, 0x96, 0x00, 0x62,
+  0x69, 0x28, 0xdc, 0x54, 0xe1, 0x0d, 0xa0, 0xa0, 0x82, 0x8a, 0x2e, 0xa8, 0xa0, 0x58, 0x62, 0x8d,
+  0x35, 0x96, 0x58, 0x52, 0x49, 0x25, 0x56, 0x54, 0x19, 0x02, 0x70, 0x00, 0x19, 0x00, 0x53, 0x4d,
+  0x25, 0xd5, 0x54, 0x53, 0x49, 0x35, 0xd5, 0x82, 0xb3, 0x11, 0x15, 0xd5, 0x56, 0x5b, 0x6d, 0xc7,
+  0xd5, 0x56, 0x53, 0x4d, 0x47, 0xd5, 0x54, 0x43, 0x0d, 0x35, 0x95, 0x50, 0x0a, 0x02, 0x3f, 0x00,
+  0x1e, 0x00, 0x2c, 0xd5, 0xd4, 0xd2, 0x58, 0x2c, 0xd6, 0xd8, 0xe2, 0x58, 0x2c, 0xd5, 0xd4, 0x12,
+  0x59, 0x2c, 0x6a, 0x38, 0x80, 0x00, 0x2c, 0xd5, 0xd4, 0xd2, 0x58, 0x2c, 0xd6, 0xd8, 0xe2, 0x58,
+  0x2c, 0xd5, 0xd4, 0x12, 0x59, 0x2c, 0xca, 0x08, 0x7d, 0x00, 0x40, 0x00, 0x2c, 0x11, 0x40, 0x13,
+  0x4b, 0x2c, 0x11, 0xc0, 0x12, 0x4b, 0x34, 0xb1, 0xc4, 0x12, 0x4b, 0x24, 0xb1, 0xc4, 0x12, 0x4b,
+  0x2c, 0x11, 0x40, 0x13, 0x4b, 0x2c, 0x11, 0x40, 0x13, 0x4b, 0x34, 0xb1, 0xc4, 0x12, 0x4b, 0x24,
+  0xb1, 0xc4, 0x12, 0x4b, 0x1c, 0x11, 0xc0, 0x12, 0x47, 0x1c, 0x11, 0xc0, 0x12, 0x47, 0x2c, 0x71,
+  0xc4, 0x11, 0x47, 0x0c, 0x71, 0xc4, 0x11, 0x47, 0x1c, 0x11, 0xc0, 0x12, 0x47, 0x1c, 0x11, 0xc0,
+  0x12, 0x47, 0x2c, 0x71, 0xc4, 0x11, 0x47, 0x0c, 0x71, 0xc4, 0x11, 0x47, 0x3f, 0x00, 0x1e, 0x00,
+  0x2c, 0xd5, 0xd4, 0xd2, 0x58, 0x2c, 0xd6, 0xd8, 0xe2, 0x58, 0x2c, 0xd5, 0xd4, 0x12, 0x59, 0x2c,
+  0x6a, 0x38, 0x00, 0x4b, 0x35, 0xb5, 0x34, 0x16, 0x8b, 0x35, 0xb6, 0x38, 0x16, 0x4b, 0x35, 0xb5,
+  0x44, 0x16, 0x8b, 0x32, 0x0a, 0x00, 0x50, 0x00, 0x63, 0x00, 0x44, 0x71, 0xc5, 0x21, 0x89, 0x44,
+  0x71, 0xc5, 0x21, 0x89, 0x44, 0x71, 0xc5, 0x21, 0x89, 0x44, 0x71, 0xc5, 0x21, 0x89, 0x3c, 0x51,
+  0xc5, 0x21, 0x89, 0x3c, 0x51, 0xc5, 0x21, 0x89, 0x3c, 0x51, 0xc5, 0x21, 0x89, 0x3c, 0x51, 0xc5,
+  0x21, 0x89, 0x34, 0x31, 0xc5, 0x21, 0x89, 0x34, 0x31, 0xc5, 0x21, 0x89, 0x34, 0x31, 0xc5, 0x21,
+  0x89, 0x34, 0x31, 0xc5, 0x21, 0x89, 0x2c, 0x11, 0xc5, 0x21, 0x89, 0x2c, 0x11, 0xc5, 0x21, 0x89,
+  0x2c, 0x11, 0xc5, 0x21, 0x89, 0x2c, 0x11, 0xc5, 0x21, 0x89, 0x24, 0x11, 0xc5, 0x20, 0x87, 0x24,
+  0x11, 0xc5, 0x20, 0x87, 0x24, 0x11, 0xc5, 0x20, 0x87, 0x24, 0x11, 0xc5, 0x20, 0x87, 0x1c, 0x11,
+  0xc5, 0x20, 0x87, 0x1c, 0x11, 0xc5, 0x20, 0x87, 0x1c, 0x11, 0xc5, 0x20, 0x87, 0x1c, 0x11, 0xc5,
+  0x20, 0x87, 0x0c, 0xf1, 0x44, 0x15, 0x8c, 0x00, 0x54, 0x00, 0x8b, 0x11, 0x21, 0xcc, 0x42, 0x0c,
+  0x71, 0x44, 0x12, 0x4d, 0xc2, 0x51, 0xc5, 0xd5, 0x74, 0xc3, 0xcd, 0x34, 0x1c, 0x43, 0x08, 0x0e,
+  0x30, 0xd4, 0x88, 0x1b, 0x8e, 0x38, 0xe3, 0x90, 0x0c, 0x12, 0xa9, 0xf8, 0x90, 0x33, 0x8e, 0x38,
+  0x23, 0x57, 0x34, 0x6a, 0x3b, 0xe3, 0x88, 0x1b, 0x8e, 0x4a, 0x94, 0x70, 0x44, 0xd1, 0x34, 0xd2,
+  0x4c, 0x40, 0x2d, 0x4a, 0x94, 0x70, 0x0b, 0x32, 0xc8, 0x21, 0x89, 0x34, 0x0a, 0xcb, 0x24, 0x97,
+  0x4b, 0x0a, 0x39, 0xe3, 0xa8, 0x0c, 0x0a, 0x3b, 0xe2, 0xc2, 0x43, 0x8a, 0xbe, 0xf1, 0xc2, 0x1b,
+  0x8f, 0x3c, 0xf3, 0xd0, 0x34, 0x13, 0xad, 0xbc, 0xd6, 0x4b, 0x0b, 0xbd, 0xf1, 0xc8, 0x33, 0x8f,
+  0xbc, 0x71, 0xe2, 0x7d, 0x00, 0x61, 0x00, 0x5a, 0xc9, 0xb6, 0x15, 0x57, 0x0c, 0x72, 0x48, 0x62,
+  0x8c, 0x03, 0xcc, 0x48, 0x2b, 0x8f, 0xcc, 0x66, 0xcb, 0x2d, 0x93, 0xbc, 0x2e, 0xcb, 0x6b, 0x8c,
+  0x32, 0x8e, 0x48, 0x22, 0x8d, 0x39, 0xce, 0x38, 0xe2, 0x84, 0x14, 0x92, 0x18, 0xe3, 0x88, 0x13,
+  0x2e, 0xc8, 0x20, 0x87, 0x29, 0x0a, 0x39, 0x23, 0x4d, 0x34, 0xcd, 0x44, 0x13, 0x4d, 0x33, 0xd1,
+  0x44, 0xd3, 0x4c, 0x33, 0x69, 0x25, 0xdb, 0x56, 0x5c, 0x31, 0xc8, 0x21, 0x89, 0x31, 0x0e, 0x30,
+  0x23, 0xad, 0x3c, 0x32, 0x9b, 0xad, 0xc4, 0x0a, 0x47, 0x29, 0x63, 0xae, 0x5a, 0x4a, 0x19, 0xa3,
+  0x8c, 0xb9, 0x6a, 0x29, 0x65, 0x8c, 0x1a, 0x86, 0xaa, 0xa3, 0x8c, 0x11, 0x6a, 0xa5, 0x20, 0x87,
+  0x29, 0x0a, 0x39, 0x23, 0x4d, 0x34, 0xcd, 0x44, 0x13, 0x4d, 0x33, 0xd1, 0x44, 0xd3, 0x4c, 0x33,
+  0x01, 0x38, 0x00, 0x28, 0x00, 0xb4, 0xf1, 0x46, 0x1c, 0x53, 0x5d, 0xd1, 0xc4, 0x1c, 0x77, 0x35,
+  0x31, 0xd5, 0x15, 0x53, 0x93, 0x72, 0x55, 0x21, 0x55, 0xdc, 0x51, 0x5a, 0x15, 0x57, 0x15, 0x92,
+  0xb8, 0x22, 0xa5, 0xb4, 0xd2, 0x4a, 0x2b, 0xad, 0x34, 0xb6, 0x48, 0xe2, 0x86, 0xdc, 0xb1, 0x58,
+  0x23, 0x8b, 0x35, 0x52, 0x48, 0x2a, 0x85, 0x8c, 0x00, 0x20, 0x00, 0x63, 0x11, 0x45, 0xd5, 0x58,
+  0x1b, 0x2e, 0x38, 0xd6, 0x54, 0x43, 0x4d, 0x45, 0x13, 0x55, 0x0b, 0xce, 0xc8, 0x21, 0x83, 0x5c,
+  0x11, 0xb5, 0xd4, 0x50, 0x4b, 0x11, 0x45, 0xd5, 0x58, 0x13, 0x92, 0x45, 0x15, 0x51, 0x34, 0xad,
+  0x34, 0x93, 0x54, 0x8c, 0x00, 0x20, 0x00, 0x63, 0x11, 0x45, 0xd5, 0x58, 0x1b, 0x2e, 0x38, 0xd6,
+  0x54, 0x43, 0x4d, 0x45, 0x13, 0x55, 0x0b, 0xce, 0xc8, 0x21, 0x83, 0x5c, 0x11, 0xb5, 0xd4, 0x50,
+  0x4b, 0x11, 0x45, 0xd5, 0x58, 0x13, 0x92, 0x45, 0x15, 0x51, 0x34, 0xad, 0x34, 0x13, 0x54, 0x8c,
+  0x00, 0x1b, 0x00, 0x05, 0x28, 0x38, 0xe3, 0x8a, 0x1b, 0x2e, 0x28, 0xdd, 0x82, 0x33, 0xae, 0xb8,
+  0xe1, 0x88, 0xaa, 0xae, 0xb8, 0xe2, 0x82, 0x1b, 0x2e, 0xb8, 0xe2, 0x82, 0x1b, 0x4e, 0xb5, 0xe0,
+  0x50, 0x5b, 0x4d, 0x35, 0x13, 0x8c, 0x00, 0x1a, 0x00, 0x0a, 0xce, 0xb8, 0xe2, 0x86, 0x0b, 0x4a,
+  0xb7, 0xe0, 0x8c, 0x2b, 0x6e, 0x38, 0xa2, 0xaa, 0x2b, 0xae, 0xb8, 0xe0, 0x86, 0x0b, 0xae, 0xb8,
+  0xe0, 0x86, 0x53, 0x2d, 0x38, 0xd4, 0x56, 0x53, 0xcd, 0x04, 0xe1, 0x00, 0x26, 0x00, 0x03, 0x44,
+  0xa9, 0xeb, 0x8a, 0x3b, 0x0e, 0xb9, 0xe3, 0x8a, 0x19, 0xea, 0xb8, 0xe3, 0x90, 0x52, 0x0e, 0xb9,
+  0xa3, 0x8a, 0x52, 0x49, 0x35, 0xc0, 0x54, 0x1a, 0x6a, 0xa8, 0xe9, 0x8a, 0x3b, 0xae, 0xb8, 0xe3,
+  0x90, 0x52, 0x0e, 0xb9, 0xa3, 0x8a, 0x2a, 0xae, 0x38, 0xe4, 0x8e, 0x2b, 0x66, 0x08, 0x7d, 0x00,
+  0x37, 0x00, 0x2b, 0xad, 0x24, 0xdc, 0x4a, 0x2a, 0x09, 0x25, 0xc0, 0x4a, 0x43, 0x29, 0x28, 0xde,
+  0x54, 0x52, 0x09, 0xb5, 0xd1, 0x4a, 0x32, 0x69, 0xb4, 0xd1, 0x4a, 0x32, 0x09, 0xb0, 0xd1, 0x4c,
+  0x63, 0x4d, 0x25, 0x94, 0x58, 0x09, 0x2e, 0xb4, 0x50, 0x82, 0x53, 0xcd, 0x14, 0xd4, 0x4a, 0x0b,
+  0xc9, 0x24, 0x94, 0x54, 0x41, 0x2d, 0xb4, 0x50, 0x82, 0x53, 0xcd, 0x14, 0xd4, 0x4a, 0x0b, 0xcd,
+  0x44, 0x14, 0x4d, 0x2a, 0x69, 0x94, 0x10, 0x64, 0x00, 0x3e, 0x00, 0x0b, 0xcd, 0x34, 0xd5, 0xa2,
+  0x54, 0x4d, 0x35, 0xd5, 0x54, 0x52, 0x6d, 0xb5, 0x28, 0x55, 0x43, 0x4d, 0xb5, 0xd5, 0x42, 0x2b,
+  0x0d, 0xb5, 0x1d, 0x51, 0x43, 0x0d, 0x35, 0x94, 0x50, 0x53, 0x6d, 0x47, 0xd4, 0x4c, 0x43, 0x4d,
+  0xb5, 0xd0, 0x4c, 0x53, 0x2d, 0x4a, 0xd5, 0x54, 0x53, 0x4d, 0x25, 0xd5, 0x56, 0x8b, 0x52, 0xb5,
+  0xd5, 0x82, 0x1a, 0x6e, 0xb8, 0xe2, 0x8c, 0x34, 0xae, 0xc8, 0xe2, 0x86, 0x33, 0x2e, 0xb8, 0xe0,
+  0x86, 0x0b, 0x72, 0x35, 0x15, 0x55, 0x43, 0xc9, 0x04, 0x7d, 0x00, 0x2b, 0x00, 0x14, 0x32, 0x4a,
+  0xd6, 0x76, 0xb3, 0x2a, 0xc9, 0x25, 0xb1, 0x22, 0x0e, 0x40, 0x21, 0xa3, 0x64, 0x6d, 0x37, 0x2b,
+  0xb3, 0xdb, 0x0a, 0x39, 0x00, 0x85, 0x8c, 0x92, 0xb5, 0xdd, 0xac, 0x4a, 0xd2, 0x48, 0xec, 0xa8,
+  0x34, 0x12, 0x3b, 0x2a, 0x8d, 0x43, 0x8e, 0x4a, 0xe3, 0x90, 0x24, 0x2e, 0xc8, 0xd5, 0xa8, 0xa3,
+  0x8a, 0x38, 0x2a, 0x8c, 0x00, 0x50, 0x00, 0x52, 0x09, 0xb5, 0xd3, 0x50, 0x03, 0xec, 0x34, 0xc0,
+  0x50, 0x03, 0xec, 0x34, 0x40, 0x6a, 0x03, 0xec, 0xb4, 0x92, 0x4e, 0x2b, 0xed, 0x34, 0xc0, 0x4a,
+  0x03, 0x68, 0x36, 0xc0, 0x4e, 0x2a, 0x6d, 0xb4, 0xd2, 0x00, 0x1b, 0x0d, 0xb0, 0xd2, 0x00, 0x1b,
+  0x0d, 0x10, 0xd9, 0x00, 0x1b, 0x4d, 0xa4, 0xd1, 0x44, 0x1b, 0x0d, 0xb0, 0xd2, 0x00, 0x3a, 0x0d,
+  0x30, 0xd5, 0x00, 0x62, 0x4d, 0x35, 0xd6, 0x00, 0x53, 0x0d, 0x30, 0xd6, 0x00, 0xd1, 0x09, 0x30,
+  0xd5, 0x58, 0x53, 0x89, 0x35, 0xd5, 0x58, 0x03, 0x44, 0x37, 0x95, 0x4e, 0x53, 0x8d, 0x35, 0xc0,
+  0x86, 0x03, 0xa8, 0xba, 0xe1, 0x58, 0x03, 0x4c, 0x35, 0x40, 0x58, 0x64, 0x00, 0x16, 0x00, 0x9a,
+  0x6a, 0x38, 0xe1, 0x86, 0x2b, 0x6e, 0x38, 0x96, 0xa6, 0x1a, 0x4e, 0xb8, 0xe1, 0x8a, 0x1b, 0x4e,
+  0x25, 0x9e, 0x58, 0x43, 0x4d, 0x35, 0xd6, 0x54, 0x43, 0xe1, 0x04, 0xb4, 0x00, 0x18, 0x00, 0x23,
+  0x2e, 0x08, 0xd4, 0x88, 0x0b, 0xe2, 0x34, 0xe2, 0x82, 0x30, 0x8d, 0x34, 0x13, 0x00, 0x4b, 0x0d,
+  0x85, 0xe3, 0x52, 0x43, 0xc1, 0xb8, 0xd4, 0x50, 0x28, 0x8e, 0xb8, 0x61, 0x00, 0x64, 0x00, 0x3d,
+  0x00, 0x1d, 0x96, 0xd8, 0x61, 0x89, 0x1d, 0x96, 0xd8, 0x61, 0x89, 0x1d, 0x76, 0x58, 0x62, 0x8b,
+  0x35, 0xf6, 0x58, 0x24, 0x91, 0x03, 0x10, 0x39, 0x00, 0x97, 0x04, 0x90, 0x49, 0x00, 0x91, 0x03,
+  0x10, 0x39, 0x00, 0x8d, 0x04, 0xf0, 0x48, 0x00, 0x91, 0x03, 0x10, 0x39, 0x00, 0x97, 0x04, 0x90,
+  0x49, 0x00, 0x91, 0x03, 0x10, 0x39, 0x00, 0x8d, 0x04, 0xf0, 0x48, 0x00, 0x97, 0x44, 0x66, 0x58,
+  0x00, 0x97, 0x44, 0x46, 0x58, 0x00, 0x97, 0x44, 0x26, 0x48, 0x00, 0x57, 0x0c, 0x02, 0x64, 0x00,
+  0x3d, 0x00, 0x1d, 0x95, 0xd4, 0x51, 0x49, 0x1d, 0x95, 0xd4, 0x51, 0x49, 0x1d, 0x75, 0x54, 0x52,
+  0x4b, 0x35, 0xf5, 0x54, 0x14, 0x51, 0x03, 0x10, 0x35, 0x00, 0x57, 0x04, 0x30, 0x48, 0x00, 0x51,
+  0x03, 0x10, 0x35, 0x00, 0x4d, 0x04, 0xf0, 0x44, 0x00, 0x51, 0x03, 0x10, 0x35, 0x00, 0x57, 0x04,
+  0x30, 0x48, 0x00, 0x51, 0x03, 0x10, 0x35, 0x00, 0x4d, 0x04, 0xf0, 0x44, 0x00, 0x57, 0x44, 0x65,
+  0x54, 0x00, 0x57, 0x44, 0x45, 0x54, 0x00, 0x57, 0x44, 0x25, 0x44, 0x00, 0x17, 0x0c, 0x01, 0x5f,
+  0x00, 0x4b, 0x00, 0x1d, 0x96, 0xd8, 0x61, 0x89, 0x1d, 0x96, 0xd8, 0x61, 0x89, 0x1d, 0x76, 0x58,
+  0x62, 0x8b, 0x35, 0xf6, 0x58, 0x24, 0x91, 0x03, 0x10, 0x39, 0x00, 0x97, 0x04, 0x30, 0x4c, 0x00,
+  0x91, 0x03, 0x10, 0x39, 0x00, 0x8d, 0x04, 0xf0, 0x48, 0x00, 0x91, 0x03, 0x10, 0x39, 0x00, 0x97,
+  0x04, 0x30, 0x4c, 0x00, 0x91, 0x03, 0x10, 0x39, 0x00, 0x8d, 0x04, 0xf0, 0x48, 0x00, 0x97, 0x44,
+  0x66, 0x58, 0x00, 0x97, 0x44, 0x46, 0x58, 0x00, 0x97, 0x44, 0x26, 0xc8, 0xd5, 0x82, 0x01, 0x14,
+  0xc0, 0x15, 0x51, 0x39, 0x16, 0xc0, 0x15, 0x51, 0x31, 0x16, 0xc0, 0x15, 0x51, 0x29, 0x92, 0xb8,
+  0x21, 0x70, 0x00, 0x1e, 0x00, 0x2b, 0xae, 0xb8, 0xe2, 0x8a, 0x2b, 0xae, 0xc8, 0x12, 0x55, 0x0c,
+  0xb2, 0x38, 0xe2, 0x88, 0x23, 0x8e, 0x38, 0xe2, 0x88, 0x34, 0x51, 0xc5, 0x20, 0x89, 0x1a, 0x2e,
+  0x38, 0xd5, 0x82, 0x0a, 0x46, 0x55, 0x55, 0x83, 0x2d, 0x4e, 0x09, 0x7d, 0x00, 0x5c, 0x00, 0x24,
+  0x51, 0xc4, 0x10, 0x45, 0x2b, 0x0d, 0xc0, 0x13, 0x4b, 0x24, 0xb1, 0xb4, 0xd4, 0x00, 0x54, 0x31,
+  0x45, 0x14, 0x53, 0x24, 0x52, 0xc8, 0x20, 0x85, 0x24, 0x52, 0xc8, 0x20, 0x85, 0x2a, 0x4e, 0xb8,
+  0x62, 0x59, 0x15, 0x92, 0x38, 0xe1, 0x58, 0x13, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e, 0x35, 0x61,
+  0x59, 0x15, 0x92, 0x38, 0xe1, 0x58, 0x5b, 0x29, 0x45, 0x52, 0x45, 0x0c, 0x51, 0xb4, 0xd2, 0x00,
+  0x3c, 0xb1, 0x44, 0x12, 0x4b, 0x4b, 0x0d, 0x40, 0x15, 0x53, 0x44, 0x31, 0x45, 0x22, 0x85, 0x0c,
+  0x52, 0x48, 0x22, 0x85, 0x0c, 0x52, 0xa8, 0xe2, 0x84, 0x2b, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e,
+  0x35, 0x61, 0x59, 0x15, 0x92, 0x38, 0xe1, 0x58, 0x13, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e, 0xb5,
+  0x95, 0x52, 0x8c, 0x00, 0x19, 0x00, 0x9a, 0xad, 0x24, 0x54, 0x58, 0x62, 0x89, 0x25, 0x95, 0x50,
+  0x52, 0x09, 0xb7, 0x92, 0x66, 0x2b, 0x09, 0x15, 0x96, 0x78, 0x52, 0x09, 0x25, 0x95, 0x70, 0x2b,
+  0x69, 0xb6, 0x92, 0x50, 0x41, 0x01, 0xa0, 0x00, 0x25, 0x00, 0x1a, 0xcd, 0xb4, 0xd1, 0x52, 0x53,
+  0x69, 0xb8, 0xd5, 0x54, 0x41, 0xcd, 0x34, 0x94, 0x54, 0x13, 0x4d, 0x31, 0xc5, 0x18, 0x12, 0x6d,
+  0x14, 0x80, 0x46, 0x33, 0x6d, 0xb4, 0xd4, 0x54, 0x1a, 0x6e, 0x35, 0x55, 0x50, 0x33, 0x0d, 0x25,
+  0xd5, 0x44, 0x53, 0x4c, 0x31, 0x86, 0x44, 0x1b, 0x01, 0xfa, 0x00, 0x3d, 0x00, 0x0a, 0x2a, 0x28,
+  0x95, 0x58, 0x53, 0x89, 0x25, 0x94, 0x00, 0x0a, 0x2a, 0x28, 0xd5, 0x58, 0x53, 0x0d, 0x20, 0x9c,
+  0x00, 0x2a, 0xa9, 0x24, 0x94, 0x4c, 0x2b, 0xc9, 0xb4, 0xe0, 0x42, 0x1b, 0xa9, 0xb4, 0xd2, 0x4a,
+  0x03, 0xac, 0x24, 0x54, 0x00, 0x0a, 0x2a, 0x28, 0x95, 0x58, 0x53, 0x89, 0x25, 0x94, 0x00, 0x0a,
+  0x2a, 0x28, 0xd5, 0x58, 0x52, 0x09, 0x27, 0x80, 0x4a, 0x2a, 0x09, 0x25, 0xd3, 0x4a, 0x32, 0x2d,
+  0xb8, 0xd0, 0x46, 0x2a, 0xad, 0xa4, 0xd1, 0x46, 0x0a, 0x01, 0x7d, 0x00, 0x1f, 0x00, 0x53, 0x68,
+  0xb6, 0x91, 0x46, 0x3a, 0xa9, 0xb6, 0x91, 0x4a, 0x3b, 0xad, 0xa4, 0xd9, 0x46, 0x3a, 0x49, 0x15,
+  0x9e, 0x58, 0xd2, 0xed, 0xa4, 0x93, 0x46, 0xaa, 0x6d, 0xa4, 0xd2, 0x4e, 0x2b, 0x69, 0x36, 0x86,
+  0x18, 0x52, 0x64, 0x44, 0x00, 0xa0, 0x00, 0x18, 0x00, 0x42, 0x05, 0xa5, 0x91, 0x50, 0x51, 0x65,
+  0x24, 0x96, 0x54, 0x62, 0x29, 0x18, 0x96, 0x54, 0x42, 0x05, 0xa5, 0x93, 0x4a, 0x3a, 0x09, 0x25,
+  0x95, 0x58, 0x39, 0xa9, 0xb6, 0x51, 0x66, 0xa0, 0x00, 0x22, 0x00, 0x0a, 0xc9, 0x24, 0x93, 0x4c,
+  0x42, 0x4d, 0x35, 0xd4, 0x54, 0x5b, 0x29, 0x28, 0x95, 0x56, 0x53, 0xcd, 0x24, 0x94, 0x50, 0xb1,
+  0x29, 0x24, 0x93, 0x4c, 0x32, 0x09, 0x35, 0xd5, 0x50, 0x53, 0x6d, 0xa5, 0xa0, 0x54, 0x5a, 0x4d,
+  0x35, 0x93, 0x50, 0x42, 0xc5, 0x06, 0x64, 0x00, 0x14, 0x00, 0x1b, 0x0d, 0x47, 0xd4, 0x50, 0x1b,
+  0x09, 0x35, 0xc0, 0x54, 0xe3, 0x91, 0x35, 0xd6, 0x54, 0x62, 0x0d, 0x30, 0x96, 0x54, 0x42, 0x09,
+  0xa5, 0x53, 0x50, 0x7d, 0x00, 0x1f, 0x00, 0x44, 0x0d, 0x45, 0xd4, 0x50, 0x33, 0x69, 0x34, 0xc0,
+  0x46, 0x44, 0x0d, 0x45, 0xd4, 0x50, 0x33, 0x6d, 0x25, 0xd4, 0x00, 0x44, 0x0d, 0x45, 0xd4, 0x50,
+  0x5b, 0x2d, 0xb8, 0xd5, 0x50, 0x33, 0x11, 0x35, 0x14, 0x51, 0x43, 0x6d, 0x25, 0x14, 0x70, 0x00,
+  0x18, 0x00, 0x2b, 0xad, 0xb4, 0xd3, 0x4a, 0x43, 0xad, 0x34, 0xd5, 0x50, 0x2b, 0xad, 0xb4, 0xd3,
+  0x4a, 0x43, 0xad, 0x34, 0xd5, 0x50, 0x28, 0x49, 0x14, 0x80, 0x00, 0x28, 0x4d, 0x38, 0x54, 0x00,
+  0xa0, 0x00, 0x2f, 0x00, 0x33, 0x12, 0xc0, 0xe4, 0xc2, 0x04, 0xd0, 0x2c, 0xb2, 0xc2, 0x4a, 0x2a,
+  0x2c, 0xf9, 0x00, 0x5b, 0x12, 0xc0, 0xe4, 0x8e, 0x04, 0x30, 0xb9, 0x2d, 0x01, 0x3a, 0x86, 0x18,
+  0xc0, 0x8c, 0x04, 0x30, 0xb9, 0x30, 0x01, 0x34, 0x8b, 0xac, 0xb0, 0x92, 0x0a, 0x4b, 0x3e, 0xc0,
+  0x96, 0x04, 0x30, 0xb9, 0x23, 0x01, 0x4c, 0x6e, 0x4b, 0x80, 0xc2, 0x12, 0x0b, 0x10, 0x21, 0xa0,
+  0x00, 0x1a, 0x00, 0x23, 0xad, 0x14, 0xc0, 0x4e, 0x43, 0x05, 0x30, 0xd2, 0x4a, 0x04, 0xec, 0x34,
+  0x14, 0x01, 0x0b, 0x8e, 0x45, 0xc0, 0x48, 0x2b, 0x11, 0x30, 0x56, 0x56, 0x01, 0x50, 0x45, 0x14,
+  0x4b, 0x1c, 0xa5, 0x04, 0xa0, 0x00, 0x71, 0x00, 0x54, 0x11, 0x40, 0x14, 0x01, 0x54, 0x11, 0xc0,
+  0x12, 0x01, 0x0c, 0x11, 0xc0, 0x12, 0x01, 0x53, 0x0c, 0x40, 0x15, 0x01, 0x44, 0x11, 0x40, 0x15,
+  0x01, 0x2c, 0x11, 0xc0, 0x10, 0x01, 0x2c, 0x11, 0x30, 0xc5, 0x00, 0x54, 0x11, 0x40, 0x16, 0x01,
+  0x0c, 0x12, 0x40, 0x16, 0x01, 0x0c, 0x12, 0x40, 0x15, 0x01, 0x64, 0x11, 0x40, 0x15, 0x01, 0x64,
+  0x11, 0x40, 0x14, 0x01, 0x54, 0x11, 0x40, 0x14, 0x01, 0x54, 0x11, 0x40, 0xd3, 0x54, 0x03, 0x50,
+  0x45, 0x00, 0x51, 0x04, 0x50, 0x45, 0x00, 0x4b, 0x04, 0x30, 0x44, 0x00, 0x4b, 0x04, 0x4c, 0x31,
+  0x00, 0x55, 0x04, 0x10, 0x45, 0x00, 0x55, 0x04, 0xb0, 0x44, 0x00, 0x43, 0x04, 0xb0, 0x44, 0xc0,
+  0x14, 0x03, 0x50, 0x45, 0x00, 0x59, 0x04, 0x30, 0x48, 0x00, 0x59, 0x04, 0x30, 0x48, 0x00, 0x55,
+  0x04, 0x90, 0x45, 0x00, 0x55, 0x04, 0x90, 0x45, 0x00, 0x51, 0x04, 0x50, 0x45, 0x00, 0x51, 0x04,
+  0x50, 0x45, 0x00, 0x59, 0x0a, 0x02, 0xa0, 0x00, 0x23, 0x00, 0x53, 0x2d, 0xb8, 0xe0, 0x82, 0x5a,
+  0x4d, 0xa5, 0x60, 0x00, 0x0b, 0x6e, 0xb8, 0xd5, 0x86, 0x32, 0x6e, 0x98, 0xe0, 0x00, 0x0b, 0x6e,
+  0xb8, 0xd5, 0x86, 0x33, 0xae, 0xb8, 0xe1, 0x82, 0x1b, 0x2e, 0x38, 0xd5, 0x4c, 0x53, 0x2d, 0xb8,
+  0xe1, 0x82, 0x5a, 0x0d, 0x15, 0x13, 0xa0, 0x00, 0x1c, 0x00, 0x43, 0x49, 0x35, 0x94, 0x4a, 0x0a,
+  0x4a, 0x15, 0xdc, 0x70, 0x54, 0x0d, 0x47, 0x95, 0x50, 0x0a, 0x82, 0x35, 0x93, 0x50, 0x33, 0x69,
+  0x24, 0x96, 0x54, 0xc1, 0x0d, 0x47, 0xd5, 0x70, 0x54, 0x09, 0xa5, 0x61, 0xa2, 0x64, 0x00, 0x16,
+  0x00, 0xaa, 0xad, 0x34, 0x93, 0x4c, 0x2b, 0xcd, 0xc6, 0xd2, 0x66, 0x0c, 0x85, 0x21, 0x94, 0x4c,
+  0x2c, 0x31, 0x44, 0x13, 0x47, 0x43, 0xcd, 0xa4, 0xd2, 0x66, 0x0c, 0x29, 0x04, 0x64, 0x00, 0x16,
+  0x00, 0xab, 0xad, 0x34, 0x93, 0x4c, 0x2b, 0xcd, 0xc6, 0xd2, 0x66, 0x0c, 0x85, 0x21, 0x94, 0x4c,
+  0x2c, 0x31, 0x44, 0x13, 0x47, 0x43, 0xcd, 0xa4, 0xd2, 0x66, 0x0c, 0x29, 0x04, 0xc8, 0x00, 0x63,
+  0x00, 0x63, 0x91, 0x55, 0xc0, 0x58, 0x64, 0x15, 0x30, 0x56, 0x86, 0x04, 0x50, 0x4a, 0xc8, 0x86,
+  0x04, 0x50, 0x38, 0x16, 0x01, 0x3b, 0x05, 0x42, 0xe1, 0x00, 0x9c, 0x12, 0x42, 0x21, 0x59, 0x03,
+  0xec, 0x14, 0x40, 0x01, 0x19, 0x12, 0x40, 0xe1, 0x00, 0x9c, 0x12, 0x42, 0x21, 0x75, 0x84, 0xac,
+  0x14, 0x08, 0x85, 0x03, 0x70, 0x4a, 0x08, 0x85, 0x64, 0x0d, 0x30, 0x16, 0x59, 0x05, 0x8c, 0x45,
+  0x56, 0x01, 0x63, 0x65, 0x48, 0x00, 0xa5, 0x84, 0x6c, 0x48, 0x00, 0x85, 0x63, 0x11, 0xb0, 0x53,
+  0x20, 0x14, 0x0e, 0xc0, 0x29, 0x21, 0x14, 0x92, 0x35, 0xc0, 0x4e, 0x01, 0x14, 0x90, 0x21, 0x01,
+  0x14, 0x0e, 0xc0, 0x29, 0x21, 0x14, 0x52, 0x47, 0xc8, 0x4a, 0x81, 0x50, 0x38, 0x00, 0xa7, 0x84,
+  0x50, 0x48, 0xd5, 0x00, 0x2b, 0x05, 0x50, 0x00, 0xaf, 0x84, 0x90, 0x47, 0x08, 0xa0, 0x00, 0x1f,
+  0x00, 0x2b, 0xae, 0xb8, 0xe1, 0x86, 0x09, 0x6e, 0xa8, 0x62, 0x54, 0x53, 0x89, 0x25, 0x94, 0x8a,
+  0x1b, 0x2a, 0xb8, 0x61, 0x8a, 0x02, 0xac, 0xb8, 0xe2, 0x86, 0x1b, 0x26, 0xb8, 0xa1, 0x8c, 0x51,
+  0x4d, 0x25, 0x96, 0x50, 0x2a, 0x6e, 0x98, 0x20, 0xfa, 0x00, 0x3d, 0x00, 0x0a, 0x15, 0x10, 0x93,
+  0x6c, 0x43, 0x49, 0x25, 0x93, 0x54, 0x0a, 0xc6, 0x28, 0xeb, 0x8c, 0x32, 0x2a, 0x28, 0x95, 0x4c,
+  0x59, 0x69, 0xba, 0x95, 0x54, 0x0a, 0x4a, 0x25, 0x53, 0x50, 0x8a, 0x6e, 0xb8, 0x28, 0x01, 0x0b,
+  0x6e, 0xb8, 0xe0, 0x58, 0x53, 0x0d, 0x15, 0x93, 0x6c, 0x43, 0x49, 0x25, 0x93, 0x54, 0x0a, 0xc6,
+  0x28, 0xeb, 0x8c, 0x32, 0x2a, 0x28, 0x95, 0x4c, 0x59, 0x69, 0xba, 0x95, 0x54, 0x0a, 0x4a, 0x25,
+  0x53, 0x50, 0xb2, 0x15, 0x30, 0x54, 0x01, 0x31, 0x01, 0xa0, 0x00, 0x24, 0x00, 0x09, 0x4a, 0x15,
+  0xd3, 0x4c, 0x43, 0x49, 0x25, 0x40, 0x82, 0x52, 0xc1, 0x24, 0x40, 0x82, 0x52, 0xc5, 0x34, 0xd3,
+  0x50, 0x52, 0x85, 0xa5, 0x60, 0x86, 0x02, 0x2c, 0xb8, 0xa1, 0x88, 0x1a, 0x2a, 0x28, 0x95, 0x50,
+  0x43, 0x4d, 0xa5, 0x95, 0x54, 0x43, 0x2d, 0xb4, 0x10, 0x42, 0xb4, 0x00, 0x24, 0x00, 0x09, 0x4a,
+  0x15, 0xd3, 0x4c, 0x43, 0x49, 0x25, 0x40, 0x82, 0x52, 0xc1, 0x24, 0x40, 0x82, 0x52, 0xc5, 0x34,
+  0x93, 0x50, 0x52, 0x85, 0xa5, 0x60, 0x86, 0x02, 0x2c, 0xb8, 0xa1, 0x88, 0x1a, 0x2a, 0x38, 0x95,
+  0x50, 0x42, 0x4d, 0xa5, 0x95, 0x54, 0x43, 0x2d, 0xb4, 0x50, 0x42, 0xa0, 0x00, 0x0e, 0x00, 0xc2,
+  0x4d, 0x25, 0x54, 0x6a, 0xc2, 0x4d, 0x25, 0x54, 0x6a, 0x19, 0x6a, 0x18, 0x5e, 0x82, 0x0a, 0x06,
+  0x07, 0xa0, 0x00, 0x17, 0x00, 0x8a, 0xaa, 0xa8, 0xe3, 0x94, 0xc2, 0xaa, 0xa8, 0xe0, 0x54, 0x3b,
+  0xed, 0xb4, 0x53, 0x50, 0x03, 0x0c, 0xb0, 0xd3, 0x4e, 0x3b, 0x0d, 0xa5, 0xdd, 0x82, 0x0b, 0x2e,
+  0xa8, 0x20, 0x64, 0x00, 0x63, 0x00, 0x2c, 0xb2, 0x58, 0xc0, 0x8a, 0x0c, 0xae, 0x38, 0xe4, 0x00,
+  0x43, 0x0d, 0xb0, 0x20, 0x01, 0x43, 0x11, 0xb0, 0x12, 0x01, 0x53, 0x8d, 0xc5, 0xd5, 0x54, 0xc4,
+  0xb1, 0x48, 0xe4, 0x94, 0x34, 0x0e, 0xb9, 0x22, 0x83, 0x1c, 0x8e, 0x45, 0xc0, 0x82, 0x04, 0x0c,
+  0x45, 0xc0, 0x4a, 0x04, 0x4c, 0x35, 0x16, 0x57, 0x53, 0x11, 0xc7, 0x22, 0x91, 0x53, 0xd2, 0x38,
+  0xe4, 0x8a, 0x0c, 0x72, 0x38, 0xd6, 0x00, 0x44, 0xf2, 0x48, 0x23, 0x89, 0x04, 0xb0, 0x48, 0x00,
+  0x53, 0x54, 0x31, 0x48, 0x00, 0x55, 0x0c, 0x72, 0x38, 0x00, 0x91, 0x3c, 0xd2, 0x48, 0x22, 0x01,
+  0x2c, 0x12, 0xc0, 0x30, 0x01, 0x0c, 0x33, 0x2c, 0x00, 0x91, 0x3c, 0xd2, 0x48, 0x22, 0x01, 0x2c,
+  0x12, 0xc0, 0x14, 0x55, 0x0c, 0x12, 0x40, 0x15, 0x83, 0x1c, 0x0e, 0x40, 0xe2, 0x00, 0x1c, 0x0e,
+  0xc0, 0x20, 0x7d, 0x00, 0x31, 0x00, 0x43, 0x31, 0xb4, 0xd2, 0x70, 0x0c, 0xad, 0x44, 0x14, 0x43,
+  0x2c, 0x11, 0x35, 0x96, 0x54, 0x03, 0x30, 0x34, 0x14, 0x43, 0x2b, 0x0d, 0xc7, 0xd0, 0x4a, 0x44,
+  0x51, 0xc4, 0x12, 0x51, 0x63, 0x49, 0x35, 0x00, 0x59, 0x0b, 0x92, 0xb5, 0xe0, 0x74, 0x0c, 0x8e,
+  0x45, 0xd5, 0x50, 0x3c, 0x0d, 0xb5, 0x1a, 0x43, 0x1b, 0xb1, 0x34, 0x13, 0x4b, 0x33, 0x8d, 0xc3,
+  0xd2, 0x66, 0x0a, 0x01, 0x50, 0x00, 0x39, 0x00, 0x44, 0x35, 0x44, 0x1c, 0x55, 0x0d, 0x51, 0x47,
+  0x56, 0x43, 0x64, 0x51, 0xd7, 0x14, 0x75, 0x44, 0x35, 0x44, 0x1c, 0x55, 0x0d, 0x51, 0x25, 0x5e,
+  0x01, 0x0c, 0xd6, 0xc4, 0x28, 0x87, 0x35, 0x71, 0xca, 0x62, 0x4d, 0x2c, 0x72, 0x5a, 0x21, 0xa7,
+  0x0c, 0xd6, 0xc4, 0x28, 0x87, 0x35, 0x71, 0xa8, 0x6a, 0x01, 0x44, 0x35, 0x44, 0x1c, 0x55, 0x0d,
+  0x51, 0x47, 0x56, 0x43, 0x64, 0x51, 0xd7, 0x14, 0x75, 0x0c, 0x2e, 0x5a, 0x00, 0x83, 0x8a, 0x02,
+  0x5a, 0x00, 0x10, 0x00, 0x0d, 0x36, 0xd8, 0xe0, 0x00, 0x64, 0xd1, 0x48, 0x00, 0x8d, 0xb4, 0xb2,
+  0xca, 0x21, 0x83, 0x04, 0xb0, 0x44, 0x00, 0x43, 0x64, 0x00, 0x3d, 0x00, 0x0c, 0x32, 0x44, 0x15,
+  0x95, 0x5c, 0x71, 0x19, 0xc0, 0x00, 0x0c, 0x32, 0x44, 0x15, 0x95, 0x5c, 0x71, 0x19, 0xc0, 0x00,
+  0x34, 0xd1, 0xc8, 0x11, 0x87, 0x24, 0x91, 0x18, 0xc0, 0x00, 0x34, 0xd1, 0xc8, 0x11, 0x87, 0x24,
+  0x91, 0x18, 0x40, 0x89, 0x1c, 0x56, 0xc8, 0x20, 0x01, 0x24, 0x12, 0xc0, 0x21, 0x01, 0x4c, 0x11,
+  0x40, 0x14, 0x01, 0x14, 0x12, 0xd0, 0x20, 0x8f, 0x35, 0xb6, 0xc8, 0x65, 0x95, 0x4c, 0x16, 0x40,
+  0x22, 0x59, 0x05, 0x70, 0x55, 0x00, 0x55, 0x4c, 0x01, 0xfa, 0x00, 0x46, 0x00, 0x1a, 0xa9, 0xa4,
+  0x93, 0x50, 0x52, 0x69, 0x35, 0xd6, 0x58, 0x63, 0x0d, 0x30, 0xd6, 0x00, 0x61, 0x0d, 0x30, 0x54,
+  0xaa, 0xa1, 0xa6, 0x3a, 0xc0, 0x50, 0x53, 0x8d, 0xb5, 0xe0, 0x86, 0xa9, 0x86, 0x28, 0x63, 0xaa,
+  0x01, 0x0c, 0x30, 0x54, 0xa6, 0x91, 0x66, 0x3a, 0xc0, 0x50, 0x53, 0x8d, 0xb5, 0xe0, 0x84, 0x99,
+  0x06, 0x25, 0x63, 0xaa, 0x01, 0x0c, 0x30, 0x54, 0xb0, 0xc1, 0x06, 0x2b, 0xa4, 0x94, 0x03, 0x0c,
+  0x19, 0x6b, 0xac, 0xb1, 0xca, 0x28, 0xe4, 0x00, 0x33, 0xa6, 0x2a, 0x95, 0x58, 0x32, 0xae, 0xb8,
+  0xa2, 0xaa, 0x63, 0x25, 0x0a, 0x70, 0x00, 0x1d, 0x00, 0x0a, 0x89, 0x24, 0x9b, 0x42, 0x22, 0xed,
+  0x24, 0x93, 0x00, 0x0a, 0x89, 0x24, 0x9b, 0x48, 0x0a, 0x05, 0x30, 0x80, 0x42, 0x22, 0xc9, 0xa6,
+  0x90, 0x48, 0x3b, 0xc9, 0x24, 0x80, 0x42, 0x22, 0xc9, 0x26, 0x92, 0x42, 0x02, 0x00, 0xc8, 0x00,
+  0x33, 0x00, 0x12, 0x12, 0xa0, 0x63, 0x01, 0x14, 0x16, 0x30, 0x62, 0x01, 0x63, 0x15, 0xa0, 0x14,
+  0x01, 0x12, 0x16, 0xc0, 0x55, 0x01, 0x3b, 0x15, 0xb0, 0x55, 0x01, 0x4a, 0x09, 0xd0, 0x54, 0x01,
+  0x5d, 0x15, 0x50, 0x56, 0x01, 0x0d, 0x16, 0x20, 0x21, 0x01, 0x3a, 0x16, 0x40, 0x61, 0x01, 0x23,
+  0x16, 0x30, 0x56, 0x01, 0x4a, 0x11, 0x20, 0x61, 0x01, 0x5c, 0x15, 0x30, 0x56, 0x01, 0x33, 0x15,
+  0xa0, 0x13, 0x7d, 0x00, 0x23, 0x00, 0x42, 0x4d, 0xb5, 0xe0, 0x00, 0x53, 0x29, 0x28, 0xc0, 0x54,
+  0x43, 0xad, 0xb4, 0x90, 0x00, 0x42, 0x4d, 0xb5, 0xa0, 0x00, 0x62, 0x09, 0x30, 0xd5, 0x50, 0x2b,
+  0x4d, 0x14, 0x80, 0x00, 0x53, 0x2d, 0x18, 0x80, 0x00, 0x53, 0x0d, 0x15, 0xc0, 0x54, 0x43, 0xad,
+  0xa4, 0x10, 0x7d, 0x00, 0x3c, 0x00, 0x0a, 0x0a, 0x29, 0x9c, 0x74, 0xe2, 0x29, 0x2a, 0x80, 0xa8,
+  0x8a, 0x0a, 0x20, 0xaa, 0xa6, 0x8a, 0x8a, 0xa7, 0xa8, 0x00, 0xa2, 0x2a, 0x2a, 0x80, 0xa8, 0x9a,
+  0x2a, 0x2a, 0x9e, 0xa2, 0x02, 0x88, 0xaa, 0xa8, 0xa8, 0x9a, 0x2a, 0xaa, 0xa9, 0xa8, 0x9a, 0xca,
+  0x2a, 0xaa, 0xa6, 0x02, 0xe8, 0xaa, 0xa8, 0x00, 0xa2, 0x6a, 0x2a, 0xab, 0xa8, 0x9a, 0x0a, 0xa0,
+  0xab, 0xa2, 0x02, 0x88, 0xaa, 0xa9, 0xa8, 0xb2, 0x0a, 0x2b, 0xac, 0xb0, 0xc2, 0x0a, 0x2b, 0x6c,
+  0xb0, 0xc8, 0x00, 0x2a, 0x00, 0x0a, 0x8e, 0x28, 0xac, 0x00, 0x3a, 0x8e, 0xa8, 0xa8, 0x00, 0x0a,
+  0x8e, 0x28, 0xe4, 0x92, 0x42, 0xea, 0x38, 0xa2, 0xa2, 0x02, 0xc8, 0xb8, 0xa4, 0xe2, 0x02, 0x68,
+  0xb9, 0xa4, 0xac, 0x02, 0x28, 0x38, 0xa2, 0xb0, 0x02, 0xe8, 0x38, 0xa2, 0x82, 0x02, 0x2c, 0x19,
+  0xa4, 0x00, 0x3b, 0xea, 0x38, 0xa2, 0x8c, 0x23, 0x26, 0x08, 0xb4, 0x00, 0x18, 0x00, 0x52, 0x29,
+  0xa4, 0x92, 0x54, 0x62, 0x29, 0xa4, 0x92, 0x58, 0x0a, 0x2a, 0xa4, 0x92, 0x82, 0x52, 0x49, 0x25,
+  0x94, 0x4a, 0x32, 0xc9, 0x24, 0xd3, 0x58, 0x0b, 0x8e, 0x35, 0x54, 0x54, 0x3f, 0x00, 0x08, 0x00,
+  0xb3, 0x71, 0x25, 0xea, 0x86, 0xdc, 0x11, 0xc7, 0xa8, 0x8c, 0xb4, 0x00, 0x27, 0x00, 0x33, 0xcd,
+  0x34, 0x53, 0x76, 0xb1, 0x8e, 0xb8, 0xe1, 0x82, 0xd9, 0xca, 0x3a, 0xe2, 0x86, 0x0b, 0x66, 0x2b,
+  0xeb, 0x88, 0x1b, 0x8e, 0x98, 0xa0, 0x00, 0x33, 0xcd, 0x34, 0x53, 0x76, 0xb1, 0x8e, 0xb8, 0xe1,
+  0x82, 0xd9, 0xca, 0x3a, 0xe2, 0x86, 0x0b, 0x66, 0x2b, 0xeb, 0x88, 0x1b, 0x8e, 0x98, 0x20, 0xb4,
+  0x00, 0x32, 0x00, 0x43, 0x0d, 0x35, 0x94, 0x82, 0x0b, 0x06, 0x39, 0xc0, 0x90, 0xd3, 0x12, 0x39,
+  0x23, 0x90, 0x03, 0x0c, 0x35, 0xd4, 0x50, 0x0a, 0x2e, 0x18, 0xe4, 0x00, 0x43, 0x4e, 0x4b, 0xe4,
+  0x8c, 0x53, 0x06, 0x2b, 0xc0, 0x82, 0x0b, 0x2e, 0x18, 0xae, 0xb0, 0x0b, 0x2e, 0xb8, 0x60, 0xb8,
+  0xc2, 0x2e, 0xb8, 0xe0, 0x82, 0x63, 0x4e, 0x39, 0x66, 0xc2, 0x0b, 0x2e, 0xb8, 0xe0, 0x82, 0x0b,
+  0x26, 0x0a, 0x7d, 0x00, 0x45, 0x00, 0x1b, 0x6d, 0xb4, 0xd1, 0x06, 0x1b, 0x6d, 0xb4, 0xd1, 0x06,
+  0x21, 0x6d, 0x24, 0x40, 0x01, 0x1b, 0x8c, 0x31, 0xc6, 0x18, 0x1b, 0x8c, 0x31, 0xc6, 0x18, 0x1b,
+  0x8c, 0x31, 0xc6, 0x18, 0x64, 0x30, 0x24, 0xc6, 0x14, 0x1b, 0x4c, 0x31, 0xc5, 0x14, 0x1b, 0x4c,
+  0x31, 0xc5, 0x14, 0x1b, 0x4c, 0x31, 0xc5, 0x14, 0x54, 0x90, 0x21, 0xc5, 0x10, 0x1b, 0x8c, 0x31,
+  0xc6, 0x18, 0x1b, 0x8c, 0x31, 0xc6, 0x18, 0x1b, 0x8c, 0x31, 0xc6, 0x18, 0x54, 0x90, 0xa1, 0x90,
+  0x4a, 0x1b, 0x6d, 0xb4, 0xd1, 0x06, 0x0b, 0x2d, 0xb4, 0xd0, 0x0e, 0x41, 0x00, 0x7d, 0x00, 0x37,
+  0x00, 0x52, 0xcc, 0xc2, 0x00, 0x07, 0x34, 0x10, 0x20, 0x03, 0x07, 0x0c, 0x10, 0x40, 0x03, 0x01,
+  0x34, 0x10, 0xb0, 0xd0, 0x34, 0x42, 0x30, 0x20, 0xc5, 0x2c, 0x0c, 0x70, 0x40, 0x03, 0x01, 0x32,
+  0x70, 0xc0, 0x00, 0x01, 0x34, 0x10, 0xc0, 0x05, 0x15, 0x44, 0xc4, 0x40, 0xc0, 0x34, 0xb3, 0x2c,
+  0x30, 0x8d, 0x0c, 0x4c, 0xd0, 0xc0, 0x00, 0x01, 0xcb, 0x04, 0x31, 0xcd, 0x2c, 0x0b, 0x4c, 0x23,
+  0x03, 0x13, 0x34, 0x2c, 0x90, 0x10, 0xb4, 0x00, 0x06, 0x00, 0xac, 0x12, 0xcb, 0x3a, 0xe3, 0x9c,
+  0x13, 0x0f, 0x70, 0x00, 0x03, 0x00, 0x05, 0x94, 0xb7, 0x22, 0xc2, 0x02, 0x1e, 0x00, 0x8c, 0x15,
+  0x40, 0x59, 0x01, 0x9b, 0x15, 0x02, 0x00, 0x20, 0xe2, 0x10, 0x22, 0x1b, 0x21, 0x01, 0xc8, 0x46,
+  0x48, 0x4c, 0x03, 0xa4, 0x34, 0x40, 0x46, 0x03, 0x28, 0x46, 0x88, 0x2a, 0x84, 0x04, 0xa0, 0x0a,
+  0x21, 0x8a, 0x10, 0x02, 0xc8, 0x00, 0x03, 0x00, 0x45, 0x14, 0x55, 0x24, 0xc2, 0x01, 0x36, 0x00,
+  0xbb, 0x14, 0xb2, 0x58, 0x21, 0xab, 0x15, 0x32, 0x5c, 0x21, 0x8b, 0x16, 0xb2, 0x6a, 0x21, 0x41,
+  0x0e, 0x92, 0xe2, 0x20, 0xcb, 0x14, 0xb2, 0x58, 0x21, 0xa3, 0x15, 0xb2, 0x5c, 0x21, 0x8b, 0x16,
+  0x32, 0x6a, 0x21, 0x49, 0x0e, 0x12, 0xe2, 0x20, 0xdb, 0x14, 0xb2, 0x59, 0x21, 0xb3, 0x15, 0xb2,
+  0x5d, 0x21, 0x9b, 0x16, 0x32, 0x6b, 0x21, 0x59, 0x0e, 0x32, 0x6e, 0x21, 0xe3, 0x16, 0x32, 0x6e,
+  0x21, 0x08, 0x0b, 0x00, 0x63, 0x01, 0x1b, 0x00, 0x8b, 0x15, 0x22, 0x80, 0x00, 0xc3, 0x14, 0x12,
+  0x80, 0x2a, 0x03, 0x48, 0x41, 0x80, 0x18, 0x04, 0x48, 0x41, 0x80, 0x12, 0x04, 0x68, 0x41, 0x80,
+  0x12, 0x04, 0x0c, 0x53, 0xc8, 0x2c, 0x85, 0x08, 0x33, 0x00, 0xc2, 0x01, 0x0c, 0x00, 0xab, 0x15,
+  0x32, 0x5c, 0x21, 0xab, 0x16, 0xb2, 0x68, 0x21, 0x9b, 0x16, 0x32, 0x6c, 0x21, 0xc8, 0x00, 0x1c,
+  0x00, 0x0d, 0x15, 0xd1, 0x50, 0x4b, 0x45, 0x35, 0x58, 0x54, 0x13, 0x0d, 0x95, 0xd4, 0x54, 0x49,
+  0x4d, 0x35, 0x58, 0x62, 0x93, 0x25, 0x76, 0x54, 0x53, 0x57, 0x35, 0x75, 0xd5, 0x61, 0x8d, 0x1d,
+  0xd6, 0xd8, 0x65, 0x8d, 0x63, 0x01, 0x12, 0x00, 0xab, 0x15, 0xb2, 0x5a, 0x21, 0x02, 0xac, 0x56,
+  0x88, 0x00, 0x8b, 0x15, 0xb2, 0x5a, 0x21, 0x02, 0x0c, 0x57, 0x48, 0x00, 0xc3, 0x14, 0x02, 0xa0,
+  0x00, 0x7c, 0x00, 0x3b, 0xed, 0xb4, 0xd3, 0x46, 0x03, 0x8c, 0x31, 0xc0, 0x4a, 0x03, 0xac, 0x34,
+  0xc0, 0x4a, 0x4b, 0x2d, 0x35, 0xd5, 0x58, 0x53, 0x4d, 0x35, 0xd5, 0x4a, 0x03, 0x6c, 0x34, 0xc0,
+  0x4e, 0x03, 0xec, 0x34, 0xc0, 0x4e, 0x2b, 0xad, 0xb4, 0xd3, 0x4a, 0x3b, 0xed, 0xb4, 0xd3, 0x46,
+  0x03, 0x8c, 0x31, 0xc0, 0x4a, 0x03, 0xac, 0x34, 0xc0, 0x4a, 0x4b, 0x2d, 0x35, 0xd5, 0x58, 0x53,
+  0x4d, 0x35, 0xd5, 0x4a, 0x03, 0x6c, 0x34, 0xc0, 0x4e, 0x03, 0xec, 0x34, 0xc0, 0x4e, 0x2b, 0xad,
+  0xb4, 0xd3, 0x4e, 0x3b, 0x6d, 0x34, 0xc0, 0x18, 0x03, 0xac, 0x34, 0xc0, 0x4a, 0x03, 0xac, 0xb4,
+  0xd4, 0x52, 0x53, 0x8d, 0x35, 0xd5, 0x54, 0x53, 0xad, 0x34, 0xc0, 0x46, 0x03, 0xec, 0x34, 0xc0,
+  0x4e, 0x03, 0xec, 0xb4, 0xd2, 0x4a, 0x3b, 0xad, 0xb4, 0xd3, 0x4e, 0x3b, 0x6d, 0x34, 0xc0, 0x18,
+  0x03, 0xac, 0x34, 0xc0, 0x4a, 0x03, 0xac, 0xb4, 0xd4, 0x52, 0x53, 0x8d, 0x35, 0xd5, 0x54, 0x53,
+  0xad, 0x34, 0xc0, 0x46, 0x03, 0xec, 0x34, 0xc0, 0x4e, 0x03, 0xec, 0xb4, 0xd2, 0x4a, 0xa0, 0x00,
+  0x3e, 0x00, 0x3b, 0xed, 0xb4, 0xd3, 0x46, 0x03, 0x8c, 0x31, 0xc0, 0x4a, 0x03, 0xac, 0x34, 0xc0,
+  0x4a, 0x4b, 0x2d, 0x35, 0xd5, 0x58, 0x53, 0x4d, 0x35, 0xd5, 0x4a, 0x03, 0x6c, 0x34, 0xc0, 0x4e,
+  0x03, 0xec, 0x34, 0xc0, 0x4e, 0x2b, 0xad, 0xb4, 0xd3, 0x4a, 0x3b, 0xed, 0xb4, 0xd3, 0x46, 0x03,
+  0x8c, 0x31, 0xc0, 0x4a, 0x03, 0xac, 0x34, 0xc0, 0x4a, 0x4b, 0x2d, 0x35, 0xd5, 0x58, 0x53, 0x4d,
+  0x35, 0xd5, 0x4a, 0x03, 0x6c, 0x34, 0xc0, 0x4e, 0x03, 0xec, 0x34, 0xc0, 0x4e, 0x2b, 0xad, 0x04,
+  0x64, 0x00, 0x21, 0x00, 0x43, 0x4d, 0x35, 0xd4, 0x54, 0x43, 0x51, 0x35, 0xdc, 0x54, 0x5b, 0x2d,
+  0xb8, 0xd5, 0x82, 0x5b, 0x31, 0xb8, 0xdd, 0x82, 0x23, 0xce, 0x38, 0xe2, 0x8c, 0x23, 0xd2, 0x38,
+  0xea, 0x8c, 0x0c, 0x32, 0xc8, 0x20, 0x83, 0x5b, 0x29, 0xc8, 0x30, 0xc3, 0x0c, 0x03, 0xa0, 0x00,
+  0x2a, 0x00, 0x2a, 0x8e, 0xb5, 0xe0, 0x86, 0x2c, 0x72, 0xb8, 0xe0, 0x58, 0x52, 0x4d, 0xb5, 0xa0,
+  0x8a, 0x1b, 0x2e, 0x28, 0xd6, 0x58, 0x0b, 0x6a, 0xa8, 0xa2, 0x82, 0x52, 0x45, 0x35, 0x80, 0x86,
+  0x33, 0x4a, 0x39, 0xe4, 0x8c, 0x2a, 0xae, 0xb8, 0xa0, 0x8a, 0x1b, 0x2e, 0x28, 0xd6, 0x58, 0x0b,
+  0x6a, 0xa8, 0xa2, 0x82, 0x52, 0x49, 0x05, 0x78, 0x00, 0x38, 0x00, 0x33, 0x4c, 0x21, 0xc6, 0x0c,
+  0x53, 0x88, 0x31, 0xc3, 0x14, 0x63, 0xac, 0xa4, 0xd1, 0x18, 0x0b, 0x8d, 0x31, 0x44, 0x0a, 0x03,
+  0x6c, 0xb0, 0xc2, 0x10, 0x29, 0x0c, 0xb0, 0xc1, 0x0a, 0x32, 0x0c, 0x31, 0x85, 0x18, 0x0b, 0x8d,
+  0xa1, 0xc2, 0x00, 0x1b, 0xac, 0x20, 0xc3, 0x10, 0x53, 0x88, 0xc1, 0x10, 0x19, 0x0c, 0xa9, 0x34,
+  0xc0, 0x06, 0x0b, 0xcc, 0xb0, 0xc2, 0x10, 0x33, 0x4c, 0x31, 0x04, 0x15, 0x64, 0x50, 0x41, 0x44,
+  0x14, 0x6c, 0x00, 0x30, 0x00, 0x29, 0x09, 0x95, 0xd1, 0x42, 0x1b, 0xa5, 0x24, 0x54, 0x66, 0x29,
+  0x09, 0x95, 0xa1, 0x82, 0x41, 0xcd, 0xb4, 0x52, 0x66, 0x29, 0x09, 0x95, 0xd1, 0x42, 0x1b, 0xa5,
+  0x24, 0x54, 0x66, 0x29, 0x09, 0x95, 0xa1, 0x82, 0x41, 0xcd, 0xb4, 0xd2, 0x4c, 0x2b, 0x25, 0x14,
+  0xd3, 0x4a, 0x1b, 0xad, 0xb4, 0x51, 0x14, 0x41, 0xcd, 0xb4, 0xd2, 0x4c, 0x2b, 0x29, 0x24, 0x53,
+  0xa2, 0x58, 0x00, 0xda, 0x00, 0x59, 0xcc, 0x30, 0xc3, 0x16, 0x4c, 0xf0, 0x80, 0x44, 0x16, 0x3b,
+  0xec, 0xb0, 0x05, 0x15, 0x44, 0x40, 0xa1, 0x85, 0x2c, 0x5b, 0x70, 0xc1, 0x10, 0x47, 0x24, 0xc5,
+  0x34, 0xd3, 0x4c, 0x34, 0xf1, 0xc4, 0x54, 0x56, 0x5b, 0x71, 0xc5, 0x14, 0x4f, 0xcb, 0xf1, 0x14,
+  0x93, 0x4c, 0xa3, 0xd1, 0x94, 0xd3, 0x4c, 0x23, 0x4d, 0x46, 0x52, 0x4c, 0x23, 0x4d, 0xb4, 0x18,
+  0x47, 0x29, 0x09, 0x35, 0x13, 0x0d, 0x34, 0xcc, 0x40, 0x03, 0x0d, 0x33, 0xd0, 0x40, 0xc3, 0x0c,
+  0x33, 0x68, 0x21, 0xcb, 0x16, 0x5c, 0x30, 0xc4, 0x11, 0x49, 0x31, 0xcd, 0x34, 0x13, 0x4d, 0x3c,
+  0x31, 0x95, 0x9d, 0x84, 0x0a, 0x46, 0x25, 0x53, 0x6e, 0x5a, 0x49, 0x15, 0x93, 0x4c, 0xb9, 0x69,
+  0x25, 0x55, 0x4c, 0x1a, 0x85, 0xa6, 0x93, 0x4c, 0x11, 0x69, 0xb1, 0x18, 0x47, 0x29, 0x09, 0x35,
+  0x13, 0x0d, 0x34, 0xcc, 0x40, 0x03, 0x0d, 0x33, 0xd0, 0x40, 0xc3, 0x0c, 0x33, 0x64, 0x31, 0xc3,
+  0x0c, 0x5b, 0x30, 0xc1, 0x03, 0x12, 0x59, 0xec, 0xb0, 0xc3, 0x16, 0x54, 0x10, 0x01, 0x85, 0x16,
+  0xb2, 0x6c, 0xc1, 0x05, 0x43, 0x1c, 0x91, 0x14, 0xd3, 0x4c, 0x33, 0xd1, 0xc4, 0x13, 0x53, 0x59,
+  0x6d, 0xc5, 0x15, 0x53, 0x3c, 0x2d, 0xc7, 0x53, 0x4c, 0x32, 0x8d, 0x46, 0x53, 0x4e, 0x33, 0x8d,
+  0x34, 0x19, 0x49, 0x31, 0x8d, 0x34, 0xd1, 0x62, 0x1c, 0xa5, 0x24, 0xd4, 0x4c, 0x34, 0xd0, 0x30,
+  0x03, 0x0d, 0x34, 0xcc, 0x40, 0x03, 0x0d, 0x33, 0xcc, 0xa0, 0x85, 0x2c, 0x5b, 0x70, 0xc1, 0x10,
+  0x47, 0x24, 0xc5, 0x34, 0xd3, 0x4c, 0x34, 0xf1, 0xc4, 0x54, 0x76, 0x12, 0x2a, 0x18, 0x95, 0x4c,
+  0xb9, 0x69, 0x25, 0x55, 0x4c, 0x32, 0xe5, 0xa6, 0x95, 0x54, 0x31, 0x69, 0x14, 0x9a, 0x4e, 0x32,
+  0x45, 0xa4, 0xc5, 0x62, 0x1c, 0xa5, 0x24, 0xd4, 0x4c, 0x34, 0xd0, 0x30, 0x03, 0x0d, 0x34, 0xcc,
+  0x40, 0x03, 0x0d, 0x33, 0xcc, 0x00, 0xa0, 0x00, 0x17, 0x00, 0x8a, 0xaa, 0xa8, 0xe3, 0x94, 0xc2,
+  0xaa, 0xa8, 0xe0, 0x54, 0x3b, 0xed, 0xb4, 0x53, 0x50, 0x03, 0x0c, 0xb0, 0xd3, 0x4e, 0x3b, 0x0d,
+  0xa5, 0xdd, 0x82, 0x0b, 0x2e, 0xa8, 0x20, 0xc8, 0x00, 0x2d, 0x00, 0x09, 0x26, 0x18, 0x56, 0x58,
+  0x52, 0x45, 0x25, 0x95, 0x54, 0x42, 0x05, 0x25, 0x53, 0x4c, 0x1a, 0xa9, 0x24, 0x53, 0x70, 0x52,
+  0x89, 0x37, 0xd5, 0x50, 0xb2, 0xa1, 0x24, 0x80, 0x42, 0x1a, 0xa9, 0x14, 0x94, 0x4c, 0x31, 0xc9,
+  0x24, 0x94, 0x54, 0x19, 0x2a, 0x98, 0xa0, 0x54, 0x62, 0x29, 0x98, 0xaa, 0x86, 0x0a, 0x8a, 0x25,
+  0x95, 0x52, 0x50, 0x01, 0x7d, 0x00, 0x3d, 0x00, 0x4b, 0xd1, 0xc4, 0x94, 0x56, 0x03, 0x90, 0x44,
+  0xd3, 0x52, 0x5b, 0x8d, 0x48, 0x23, 0x83, 0x23, 0xce, 0x98, 0xd5, 0x52, 0x34, 0x31, 0xa5, 0xd5,
+  0x00, 0x24, 0xd1, 0xb4, 0xd4, 0x56, 0x23, 0xd2, 0xc8, 0xe0, 0x88, 0x33, 0x06, 0x39, 0x24, 0x95,
+  0x2c, 0x0a, 0x39, 0x00, 0x8b, 0x1c, 0x2e, 0x38, 0xd6, 0x74, 0x64, 0x2d, 0xb8, 0x62, 0x86, 0x23,
+  0xd2, 0xc8, 0xa0, 0x88, 0x03, 0x30, 0xc8, 0xd5, 0x52, 0x43, 0xcd, 0x46, 0xd4, 0x52, 0x5b, 0x2d,
+  0xb8, 0xd5, 0x50, 0x23, 0x01, 0x7d, 0x00, 0x35, 0x00, 0x3c, 0xb0, 0xb0, 0xc3, 0x14, 0x3c, 0xb0,
+  0xb0, 0xc3, 0x14, 0x3c, 0xb0, 0xc0, 0x03, 0x01, 0x3c, 0xb0, 0xb0, 0xc3, 0x14, 0x3c, 0xb0, 0xc0,
+  0x03, 0x0b, 0x0c, 0xb1, 0x40, 0x06, 0x0b, 0x54, 0xf0, 0xc0, 0x03, 0x0b, 0x3b, 0x4c, 0xc1, 0x03,
+  0x0b, 0x3b, 0x4c, 0xc1, 0x03, 0x0b, 0x3c, 0x10, 0xc0, 0x03, 0x0b, 0x3b, 0x4c, 0xc1, 0x03, 0x0b,
+  0x3c, 0xb0, 0xc0, 0x10, 0x0b, 0x64, 0xb0, 0x40, 0x05, 0x0f, 0x04, 0x00, 0x0e, 0x01, 0x31, 0x00,
+  0x0b, 0x2d, 0xa4, 0xd0, 0x42, 0x0b, 0x29, 0xb4, 0xd0, 0x42, 0x33, 0x0d, 0x30, 0xd4, 0x00, 0x52,
+  0x2d, 0xb4, 0x90, 0x42, 0x0b, 0x2d, 0xa4, 0xd0, 0x54, 0x53, 0x0d, 0x35, 0xc0, 0x4a, 0x03, 0x28,
+  0xb4, 0xd0, 0x42, 0x0a, 0x2d, 0xb4, 0x90, 0x42, 0x0b, 0x2d, 0x34, 0xd3, 0x00, 0x43, 0x0d, 0x20,
+  0xd5, 0x4c, 0x53, 0x21, 0x38, 0xd5, 0x50, 0x33, 0x0d, 0x30, 0xdd, 0x00, 0x33, 0x01, 0xa0, 0x00,
+  0x15, 0x00, 0x54, 0x11, 0x05, 0x15, 0x01, 0x44, 0xd1, 0xc4, 0x11, 0x4b, 0x11, 0x11, 0xa0, 0xd9,
+  0x00, 0x02, 0x04, 0x40, 0x15, 0x51, 0x50, 0xad, 0x36, 0xdb, 0x64, 0x19, 0x01, 0x1f, 0x00, 0x26,
+  0x00, 0x05, 0x50, 0xc0, 0x04, 0x13, 0x3d, 0xd4, 0xd0, 0x43, 0x0d, 0x24, 0x90, 0x50, 0x41, 0x09,
+  0x34, 0x94, 0x50, 0x03, 0x0f, 0x35, 0x54, 0x40, 0x83, 0x08, 0x14, 0x30, 0xc1, 0x44, 0x0f, 0x35,
+  0xf4, 0x50, 0x03, 0x09, 0x24, 0x54, 0x50, 0x02, 0x0d, 0x25, 0xd4, 0xc0, 0x43, 0x0d, 0x15, 0x28,
+  0x01, 0x1d, 0x01, 0x83, 0x00, 0x2c, 0xd3, 0xcc, 0x32, 0xc9, 0x1a, 0x0b, 0xc0, 0x21, 0x87, 0x1c,
+  0x72, 0xc8, 0x21, 0x87, 0x1c, 0x72, 0xc8, 0x22, 0x8b, 0x2c, 0xb2, 0x48, 0x23, 0x8d, 0x34, 0xd2,
+  0x48, 0x23, 0x8d, 0x34, 0xd2, 0x38, 0xf5, 0xd6, 0x53, 0x0f, 0xa0, 0x71, 0x00, 0x1c, 0x72, 0xcc,
+  0x21, 0xc7, 0x1c, 0x72, 0xcc, 0x21, 0xc7, 0x2c, 0xb2, 0xcc, 0x22, 0xcb, 0x34, 0xd2, 0x4c, 0x23,
+  0xcd, 0x34, 0xd2, 0x4c, 0x23, 0xcd, 0x54, 0x51, 0x45, 0x15, 0x55, 0x5c, 0x71, 0xc9, 0x15, 0x97,
+  0x5c, 0x71, 0xc9, 0x15, 0x97, 0x5c, 0x71, 0xc9, 0x15, 0x97, 0x02, 0x6c, 0x38, 0x80, 0x8a, 0x32,
+  0x0a, 0x20, 0xa3, 0x00, 0x41, 0x4a, 0xa9, 0xa5, 0x00, 0x44, 0x12, 0x4d, 0x24, 0xd1, 0x44, 0x12,
+  0x4d, 0x24, 0xd1, 0x2a, 0x0a, 0x29, 0xa5, 0x00, 0x34, 0xd2, 0x4c, 0x23, 0xcd, 0x34, 0xd2, 0x4c,
+  0x23, 0xcd, 0x2a, 0xca, 0x28, 0xa4, 0x00, 0x2c, 0xb2, 0xcc, 0x22, 0xcb, 0x2c, 0xb2, 0xcc, 0x22,
+  0xcb, 0x2c, 0xb2, 0xcc, 0x22, 0xcb, 0x02, 0x68, 0x28, 0xe1, 0x8a, 0x03, 0x68, 0x98, 0x21, 0x87,
+  0x1c, 0x73, 0xc8, 0x31, 0x87, 0x1c, 0x73, 0xc8, 0x31, 0xb4, 0x00, 0x3c, 0x00, 0x2b, 0x4d, 0xb5,
+  0xd2, 0x58, 0x2b, 0x0d, 0x35, 0xd5, 0x4a, 0x0b, 0xae, 0xb4, 0xe1, 0x4a, 0x63, 0x2d, 0xb8, 0xd2,
+  0x58, 0x2b, 0x4d, 0xb5, 0xd2, 0x58, 0x2b, 0x0d, 0x35, 0xd5, 0x4a, 0x0b, 0xae, 0xb4, 0xe1, 0x4a,
+  0x63, 0x2d, 0xb8, 0xd2, 0x54, 0x2b, 0x8d, 0xb5, 0xd2, 0x50, 0x53, 0xad, 0xb4, 0xe0, 0x4a, 0x1b,
+  0xae, 0x34, 0xd6, 0x82, 0x2b, 0x8d, 0xb5, 0xd2, 0x54, 0x2b, 0x8d, 0xb5, 0xd2, 0x50, 0x53, 0xad,
+  0xb4, 0xe0, 0x4a, 0x1b, 0xae, 0x34, 0xd6, 0x82, 0x7d, 0x00, 0x5c, 0x00, 0x24, 0x51, 0xc4, 0x10,
+  0x45, 0x2b, 0x0d, 0xc0, 0x13, 0x4b, 0x24, 0xb1, 0xb4, 0xd4, 0x00, 0x54, 0x31, 0x45, 0x14, 0x53,
+  0x24, 0x52, 0xc8, 0x20, 0x85, 0x24, 0x52, 0xc8, 0x20, 0x85, 0x2a, 0x4e, 0xb8, 0x62, 0x59, 0x15,
+  0x92, 0x38, 0xe1, 0x58, 0x13, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e, 0x35, 0x61, 0x59, 0x15, 0x92,
+  0x38, 0xe1, 0x58, 0x5b, 0x29, 0x45, 0x52, 0x45, 0x0c, 0x51, 0xb4, 0xd2, 0x00, 0x3c, 0xb1, 0x44,
+  0x12, 0x4b, 0x4b, 0x0d, 0x40, 0x15, 0x53, 0x44, 0x31, 0x45, 0x22, 0x85, 0x0c, 0x52, 0x48, 0x22,
+  0x85, 0x0c, 0x52, 0xa8, 0xe2, 0x84, 0x2b, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e, 0x35, 0x61, 0x59,
+  0x15, 0x92, 0x38, 0xe1, 0x58, 0x13, 0x96, 0x55, 0x21, 0x89, 0x13, 0x8e, 0xb5, 0x95, 0x52, 0xc8,
+  0x00, 0x2d, 0x00, 0x1b, 0xce, 0xb8, 0xa5, 0xc6, 0x1a, 0x6f, 0xa9, 0xb0, 0xc8, 0x1a, 0x6b, 0xb9,
+  0xd5, 0x86, 0x33, 0x6a, 0xa9, 0xe5, 0x82, 0x52, 0x2a, 0xac, 0xa5, 0x00, 0x1b, 0xce, 0xb8, 0xa5,
+  0xc6, 0x1a, 0x6f, 0xa9, 0xb0, 0xc8, 0x1a, 0x6b, 0xb9, 0xd5, 0x86, 0x33, 0x6a, 0xa9, 0xe5, 0x82,
+  0x52, 0x2a, 0xcc, 0x25, 0x87, 0x5c, 0x72, 0xc8, 0x25, 0x87, 0x5c, 0x02, 0xc8, 0x00, 0x2d, 0x00,
+  0x1b, 0xcd, 0xb4, 0x95, 0x86, 0x1a, 0x6e, 0xa5, 0xa0, 0x88, 0x1a, 0x6a, 0xb5, 0xc5, 0x46, 0x33,
+  0x69, 0xa5, 0xd5, 0x42, 0x52, 0x29, 0xa8, 0x95, 0x00, 0x1b, 0xcd, 0xb4, 0x95, 0x86, 0x1a, 0x6e,
+  0xa5, 0xa0, 0x88, 0x1a, 0x6a, 0xb5, 0xc5, 0x46, 0x33, 0x69, 0xa5, 0xd5, 0x42, 0x52, 0x29, 0xc8,
+  0x15, 0x47, 0x5c, 0x71, 0xc4, 0x15, 0x47, 0x5c, 0x01, 0x8c, 0x00, 0x2b, 0x00, 0x2a, 0xaa, 0x98,
+  0xe2, 0x00, 0x23, 0xae, 0xb8, 0xe3, 0x8a, 0x23, 0x4e, 0x28, 0xe1, 0x58, 0x4b, 0x85, 0x35, 0xc0,
+  0x54, 0x4b, 0x4d, 0x35, 0xd6, 0x54, 0x4b, 0xed, 0xa4, 0x92, 0x8a, 0x29, 0x0e, 0xb0, 0xe2, 0x88,
+  0x2b, 0xee, 0xb8, 0xe2, 0x88, 0x13, 0x4e, 0x38, 0xd6, 0x58, 0x4b, 0x85, 0x35, 0xc0, 0x54, 0x4b,
+  0x4d, 0x25, 0x16, 0x78, 0x00, 0x1c, 0x00, 0xab, 0x6d, 0xa4, 0x90, 0x4a, 0x42, 0x29, 0x3a, 0xc0,
+  0xaa, 0x1b, 0x2a, 0xa8, 0x92, 0x4e, 0xc2, 0x0d, 0x20, 0x94, 0xaa, 0x1b, 0x2a, 0x18, 0xd6, 0x54,
+  0x62, 0x2d, 0x4a, 0x80, 0x82, 0x42, 0xa9, 0x54, 0x80, 0x42, 0x7d, 0x00, 0x20, 0x00, 0x44, 0x11,
+  0x45, 0x14, 0x51, 0x43, 0x4d, 0x35, 0xd4, 0x4a, 0x03, 0x30, 0xc4, 0x11, 0x43, 0x1b, 0x6d, 0xb4,
+  0x90, 0x4a, 0x02, 0x0c, 0x35, 0xd4, 0x50, 0x53, 0x0d, 0xb5, 0xd2, 0x00, 0x0a, 0x2e, 0x38, 0xd6,
+  0x50, 0x53, 0x91, 0x45, 0x95, 0x50, 0x8c, 0x00, 0x1e, 0x00, 0x1a, 0x09, 0x35, 0xd4, 0x54, 0x43,
+  0xed, 0xa4, 0x92, 0x42, 0x2a, 0x49, 0x35, 0xd5, 0x58, 0x53, 0x0d, 0xa5, 0x93, 0x46, 0x3a, 0x89,
+  0x35, 0xd6, 0x82, 0x63, 0x4d, 0x25, 0x94, 0x4a, 0x1b, 0x6d, 0xa4, 0x92, 0x54, 0x3a, 0x05, 0x07,
+  0x7d, 0x00, 0x23, 0x00, 0x63, 0x8d, 0x35, 0x96, 0x88, 0x3a, 0xee, 0xb8, 0xe4, 0x92, 0x4b, 0x8e,
+  0x98, 0xa3, 0x00, 0x2b, 0x8e, 0x28, 0xa2, 0xa4, 0x02, 0x8c, 0x35, 0xd6, 0x58, 0x22, 0xee, 0xb8,
+  0xe3, 0x8e, 0x4b, 0x2e, 0xb9, 0xe4, 0x88, 0x39, 0x0a, 0xb0, 0xe2, 0x88, 0x22, 0x46, 0x3a, 0x00,
+  0xa0, 0x00, 0x1d, 0x00, 0x32, 0x49, 0x35, 0xc0, 0x54, 0x42, 0xc9, 0xa4, 0x95, 0x56, 0x52, 0x09,
+  0x25, 0x95, 0x82, 0x0a, 0x8a, 0x95, 0xa8, 0x54, 0x9a, 0x2e, 0xa8, 0x95, 0x54, 0x42, 0xc9, 0xa4,
+  0x92, 0x54, 0x42, 0xc9, 0x24, 0x93, 0x4a, 0xb1, 0x01, 0x7d, 0x00, 0x23, 0x00, 0x8b, 0x32, 0x98,
+  0xe8, 0xa2, 0x0c, 0x4a, 0x95, 0xe0, 0xa2, 0x0c, 0x26, 0xba, 0x28, 0x83, 0x5a, 0x25, 0x38, 0xc0,
+  0x82, 0x2b, 0xae, 0xb8, 0x62, 0x86, 0x1b, 0x2e, 0xb8, 0xe0, 0x82, 0x59, 0x11, 0x30, 0x1d, 0x55,
+  0xd3, 0x51, 0x35, 0x1c, 0x51, 0xc3, 0x11, 0x15, 0x1b, 0x7d, 0x00, 0x2c, 0x00, 0x2a, 0x89, 0x25,
+  0x95, 0x58, 0x1a, 0x86, 0x07, 0x80, 0x4a, 0x62, 0x49, 0x25, 0x96, 0x8a, 0xe1, 0x01, 0x20, 0xa4,
+  0x8e, 0x2a, 0x6a, 0xa8, 0x62, 0x78, 0x00, 0x08, 0xa9, 0xa3, 0x8a, 0x1a, 0xea, 0x18, 0x1e, 0x00,
+  0x2a, 0x89, 0x25, 0x95, 0x58, 0x1a, 0x86, 0x07, 0x80, 0x4a, 0x62, 0x49, 0x25, 0x96, 0x8a, 0xe1,
+  0x01, 0xa0, 0x62, 0x78, 0x64, 0x00, 0x31, 0x00, 0x0a, 0xcd, 0x46, 0x93, 0x6c, 0x43, 0x4d, 0x47,
+  0x95, 0x74, 0x53, 0x0d, 0x35, 0x95, 0x56, 0x2a, 0x09, 0x25, 0xd3, 0x00, 0x0b, 0x2e, 0x38, 0x95,
+  0xa6, 0x0b, 0x2e, 0xb8, 0x95, 0x76, 0x5b, 0x6d, 0x35, 0x94, 0xa2, 0x5b, 0x6d, 0x35, 0x95, 0x54,
+  0x03, 0x2c, 0x34, 0xdb, 0x4c, 0x32, 0x0d, 0x35, 0x1d, 0x55, 0xd2, 0x4d, 0x35, 0xd4, 0x54, 0x5a,
+  0xa9, 0x24, 0x94, 0x4c, 0x02, 0x00, 0xa0, 0x00, 0x27, 0x00, 0x13, 0x6e, 0x15, 0xc0, 0x56, 0x4b,
+  0xed, 0xb4, 0xd4, 0x56, 0x12, 0x6e, 0x25, 0xe1, 0x88, 0x5b, 0x05, 0xb0, 0xd5, 0x52, 0x3b, 0x2d,
+  0xb5, 0x95, 0x84, 0x5b, 0x49, 0x38, 0xe2, 0x58, 0x01, 0x8c, 0xb5, 0xd5, 0x52, 0x5b, 0x8d, 0x25,
+  0xe2, 0x8e, 0x22, 0xca, 0x2a, 0xaa, 0xa4, 0xe2, 0x69, 0xa5, 0x14, 0x20, 0x03, 0x13, 0x00, 0x34,
+  0x0a, 0x40, 0xa3, 0x00, 0x34, 0x0a, 0x40, 0xa3, 0x00, 0x0c, 0x0a, 0xc0, 0xa0, 0x00, 0x0c, 0x0a,
+  0xc0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x10, 0x00, 0x33, 0xcf, 0x38, 0xf3, 0x8c,
+  0x33, 0xcf, 0xb8, 0xf0, 0x82, 0x0b, 0x2f, 0xb8, 0xf0, 0x82, 0x0b, 0x2f, 0xb8, 0x70, 0x00, 0xc0,
+  0x03, 0xbb, 0x01, 0xa4, 0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0, 0xa0, 0x00, 0x24, 0x0a, 0x42,
+  0x2a, 0x01, 0x0c, 0x16, 0x40, 0x2a, 0x01, 0x0c, 0x0a, 0x40, 0x2a, 0x01, 0x0c, 0x16, 0x40, 0x2a,
+  0x01, 0x0c, 0x0a, 0xc0, 0x90, 0x20, 0xa4, 0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0, 0xa0, 0x00,
+  0x24, 0x0a, 0x42, 0x2a, 0x01, 0x0c, 0x16, 0x40, 0x2a, 0x01, 0x0c, 0x0a, 0x40, 0x2a, 0x01, 0x0c,
+  0x16, 0x40, 0x2a, 0x01, 0x0c, 0x0a, 0xc0, 0x90, 0x20, 0x9c, 0x12, 0xc0, 0x60, 0x01, 0x9c, 0x12,
+  0xc0, 0xa0, 0x00, 0x1c, 0x0a, 0xc2, 0x29, 0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01, 0x0c, 0x0a, 0xc0,
+  0x29, 0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01, 0x0c, 0x0a, 0xc0, 0x90, 0x20, 0x9c, 0x12, 0xc0, 0x60,
+  0x01, 0x9c, 0x12, 0xc0, 0xa0, 0x00, 0x1c, 0x0a, 0xc2, 0x29, 0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01,
+  0x0c, 0x0a, 0xc0, 0x29, 0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01, 0x0c, 0x0a, 0xc0, 0x90, 0x20, 0xdc,
+  0x11, 0x40, 0x54, 0x01, 0xdc, 0x11, 0x40, 0x94, 0x00, 0x5c, 0x09, 0xc2, 0x1d, 0x01, 0x44, 0x15,
+  0xc0, 0x1d, 0x01, 0x44, 0x09, 0xc0, 0x1d, 0x01, 0x44, 0x15, 0xc0, 0x1d, 0x01, 0x44, 0x09, 0x40,
+  0x84, 0x20, 0xdc, 0x11, 0x40, 0x54, 0x01, 0xdc, 0x11, 0x40, 0x94, 0x00, 0x5c, 0x09, 0xc2, 0x1d,
+  0x01, 0x44, 0x15, 0xc0, 0x1d, 0x01, 0x44, 0x09, 0xc0, 0x1d, 0x01, 0x44, 0x15, 0xc0, 0x1d, 0x01,
+  0x44, 0x09, 0x40, 0x84, 0x20, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc, 0x11, 0x40, 0x93, 0x00, 0x4c,
+  0x09, 0xc2, 0x1c, 0x01, 0x34, 0x15, 0xc0, 0x1c, 0x01, 0x34, 0x09, 0xc0, 0x1c, 0x01, 0x34, 0x15,
+  0xc0, 0x1c, 0x01, 0x34, 0x09, 0x40, 0x83, 0x20, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc, 0x11, 0x40,
+  0x93, 0x00, 0x4c, 0x09, 0xc2, 0x1c, 0x01, 0x34, 0x15, 0xc0, 0x1c, 0x01, 0x34, 0x09, 0xc0, 0x1c,
+  0x01, 0x34, 0x15, 0xc0, 0x1c, 0x01, 0x34, 0x01, 0x42, 0x2a, 0x01, 0x0c, 0x16, 0x40, 0x2a, 0x01,
+  0x0c, 0x0a, 0x40, 0xa2, 0x20, 0xa4, 0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0, 0xa0, 0x00, 0xa4,
+  0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0, 0xa0, 0x00, 0x0c, 0x09, 0x42, 0x2a, 0x01, 0x0c, 0x16,
+  0x40, 0x2a, 0x01, 0x0c, 0x0a, 0x40, 0xa2, 0x20, 0xa4, 0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0,
+  0xa0, 0x00, 0xa4, 0x12, 0xc0, 0x60, 0x01, 0xa4, 0x12, 0xc0, 0xa0, 0x00, 0x0c, 0x09, 0xc2, 0x29,
+  0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01, 0x0c, 0x0a, 0xc0, 0xa1, 0x20, 0x9c, 0x12, 0xc0, 0x60, 0x01,
+  0x9c, 0x12, 0xc0, 0xa0, 0x00, 0x9c, 0x12, 0xc0, 0x60, 0x01, 0x9c, 0x12, 0xc0, 0xa0, 0x00, 0x0c,
+  0x09, 0xc2, 0x29, 0x01, 0x0c, 0x16, 0xc0, 0x29, 0x01, 0x0c, 0x0a, 0xc0, 0xa1, 0x20, 0x9c, 0x12,
+  0xc0, 0x60, 0x01, 0x9c, 0x12, 0xc0, 0xa0, 0x00, 0x9c, 0x12, 0xc0, 0x60, 0x01, 0x9c, 0x12, 0xc0,
+  0xa0, 0x00, 0x0c, 0x09, 0xc2, 0x1d, 0x01, 0x44, 0x15, 0xc0, 0x1d, 0x01, 0x44, 0x09, 0xc0, 0x95,
+  0x20, 0xdc, 0x11, 0x40, 0x54, 0x01, 0xdc, 0x11, 0x40, 0x94, 0x00, 0xdc, 0x11, 0x40, 0x54, 0x01,
+  0xdc, 0x11, 0x40, 0x94, 0x00, 0x44, 0x08, 0xc2, 0x1d, 0x01, 0x44, 0x15, 0xc0, 0x1d, 0x01, 0x44,
+  0x09, 0xc0, 0x95, 0x20, 0xdc, 0x11, 0x40, 0x54, 0x01, 0xdc, 0x11, 0x40, 0x94, 0x00, 0xdc, 0x11,
+  0x40, 0x54, 0x01, 0xdc, 0x11, 0x40, 0x94, 0x00, 0x44, 0x08, 0xc2, 0x1c, 0x01, 0x34, 0x15, 0xc0,
+  0x1c, 0x01, 0x34, 0x09, 0xc0, 0x94, 0x20, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc, 0x11, 0x40, 0x93,
+  0x00, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc, 0x11, 0x40, 0x93, 0x00, 0x34, 0x08, 0xc2, 0x1c, 0x01,
+  0x34, 0x15, 0xc0, 0x1c, 0x01, 0x34, 0x09, 0xc0, 0x94, 0x20, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc,
+  0x11, 0x40, 0x93, 0x00, 0xcc, 0x11, 0x40, 0x53, 0x01, 0xcc, 0x11, 0x40, 0x13, 0xc1, 0x00, 0x4b,
+  0x00, 0x5b, 0x14, 0xd0, 0x25, 0x01, 0x5d, 0x12, 0xb0, 0x44, 0x01, 0x5d, 0x0e, 0xb0, 0x43, 0x01,
+  0x5d, 0x12, 0xd0, 0x25, 0x01, 0x33, 0x0c, 0xd2, 0x25, 0x01, 0x5d, 0x12, 0xb0, 0x45, 0x01, 0x4b,
+  0x14, 0xd0, 0xe5, 0x00, 0x3b, 0x14, 0xd0, 0x25, 0x01, 0x5d, 0x12, 0x20, 0x43, 0x00, 0x80, 0x0c,
+  0xb2, 0x45, 0x01, 0x5d, 0x12, 0xd0, 0x25, 0x01, 0x4b, 0x14, 0xd0, 0xe5, 0x00, 0x3b, 0x14, 0xd0,
+  0x25, 0x01, 0x5d, 0x12, 0x30, 0xc3, 0x20, 0x5d, 0x12, 0xd0, 0x25, 0x01, 0x5b, 0x14, 0xb0, 0x44,
+  0x01, 0x5d, 0x0e, 0xb0, 0x43, 0x01, 0x5d, 0x12, 0xd0, 0x25, 0x01, 0x32, 0x04, 0x00, 0x08, 0x90,
+  0x01, 0x12, 0x00, 0x0b, 0xae, 0x38, 0xe4, 0x8a, 0x0b, 0x0e, 0xb9, 0xe2, 0x90, 0x0b, 0x0e, 0xb9,
+  0xe0, 0x8a, 0x0b, 0x0e, 0xb9, 0xe2, 0x90, 0x2b, 0x2e, 0x08, 0x5e, 0x01, 0x18, 0x00, 0x64, 0x71,
+  0x48, 0x16, 0x87, 0x64, 0x71, 0x48, 0x16, 0x87, 0x1c, 0xd2, 0xc8, 0x21, 0x8d, 0x1c, 0xd2, 0xc8,
+  0x21, 0x8d, 0x34, 0x52, 0x49, 0x23, 0x95, 0x34, 0x52, 0x49, 0x23, 0xb5, 0x63, 0x01, 0x18, 0x00,
+  0x64, 0x70, 0x44, 0x06, 0x47, 0x64, 0x70, 0x44, 0x06, 0x47, 0x1c, 0xd1, 0xc4, 0x11, 0x4d, 0x1c,
+  0xd1, 0xc4, 0x11, 0x4d, 0x34, 0x51, 0x45, 0x13, 0x55, 0x34, 0x51, 0x45, 0x13, 0x55, 0x07, 0x01,
+  0x49, 0x00, 0x65, 0x94, 0x58, 0x46, 0x89, 0x65, 0x94, 0x58, 0x46, 0x89, 0x03, 0x2c, 0xb8, 0xc1,
+  0x88, 0x53, 0x08, 0x30, 0xc5, 0x88, 0x1b, 0x28, 0x58, 0x46, 0x89, 0x65, 0x94, 0x58, 0x46, 0x89,
+  0x65, 0x94, 0x58, 0x46, 0x89, 0x65, 0x94, 0x58, 0x46, 0x89, 0x65, 0x94, 0x08, 0x08, 0x20, 0x82,
+  0x94, 0x51, 0x62, 0x19, 0x25, 0x96, 0x51, 0x62, 0x19, 0x25, 0x0e, 0xb0, 0xe0, 0x06, 0x23, 0x4e,
+  0x21, 0xc0, 0x14, 0x23, 0x6e, 0xa0, 0x60, 0x19, 0x25, 0x96, 0x51, 0x62, 0x19, 0x25, 0x96, 0x51,
+  0x62, 0x19, 0x25, 0x96, 0x51, 0x62, 0x19, 0x25, 0x96, 0x51, 0x22, 0x20, 0x80, 0x00, 0xa0, 0x00,
+  0x0f, 0x00, 0x0d, 0x75, 0xd4, 0x52, 0x4d, 0x45, 0x55, 0x55, 0x56, 0x83, 0x65, 0x55, 0x55, 0x54,
+  0x4d, 0x2d, 0x75, 0xd4, 0x10, 0x5e, 0x01, 0x11, 0x00, 0x54, 0x91, 0x45, 0x15, 0x59, 0x54, 0x91,
+  0x45, 0x95, 0x00, 0x54, 0x91, 0x45, 0x15, 0x59, 0x54, 0x91, 0x45, 0x15, 0x59, 0xd4, 0x01, 0xf4,
+  0x01, 0x15, 0x00, 0x0b, 0xae, 0xb8, 0xf1, 0x82, 0x2b, 0x6e, 0xb9, 0xe0, 0x8a, 0x53, 0x2e, 0xb8,
+  0xe2, 0x90, 0x0b, 0xae, 0x38, 0xe5, 0x82, 0x2b, 0x6e, 0xb9, 0xe0, 0x8a, 0x1b, 0x03,
+};
+
+#endif // RTTTL_LIBRARY_H
@@ -0,0 +1,391 @@
+// Compiles RTTTL text melodies to the packed binary format played by BinaryMelodyPlayer.
+// The output is a header which defines:
+//  - rtttl_library_names:   the melody names, as a MelodyCatalog data array.
+//  - rtttl_library_offsets: the offset of each melody in rtttl_library_data.
+//  - rtttl_library_data:    the compiled melodies.
+//
+// Usage: rtttl2bin [-b 10|16] [-o output.h] input.txt [input.txt ...]
+// Each input line is a RTTTL melody. Empty lines and lines starting with '#' are ignored.
+// When multiple melodies have the same name, the first one is kept.
+//
+// See BinaryMelodyPlayer.hpp for a description of the binary format.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include <string>
+#include <vector>
+#include <set>
+
+struct COMPILED_MELODY {
+  std::string name;
+  std::vector<uint16_t> notes;
+  uint16_t bpm;
+};
+typedef std::vector<COMPILED_MELODY> CompiledMelodyVector;
+
+static const int MIN_OCTAVE = 4;
+static const int MAX_OCTAVE = 7;
+static const size_t MAX_DATA_SIZE = 0xFFFF;
+
+static size_t warning_count = 0;
+
+void print_warning(const std::string & location, const char * message, const std::string & value) {
+  fprintf(stderr, "%s: warning: %s '%s'.\n", location.c_str(), message, value.c_str());
+  warning_count++;
+}
+
+std::string trim(const std::string & value) {
+  size_t first = 0;
+  size_t last = value.size();
+  while(first < last && isspace((unsigned char)value[first]))
+    first++;
+  while(last > first && isspace((unsigned char)value[last-1]))
+    last--;
+  return value.substr(first, last - first);
+}
+
+std::vector<std::string> split(const std::string & value, char separator) {
+  std::vector<std::string> elements;
+  size_t start = 0;
+  while(true) {
+    size_t end = value.find(separator, start);
+    elements.push_back(trim(value.substr(start, end - start)));
+    if (end == std::string::npos)
+      return elements;
+    start = end + 1;
+  }
+}
+
+// Returns the duration index of a RTTTL duration: 1, 2, 4, 8, 16 or 32.
+int get_duration_index(int duration, const std::string & location, const std::string & token) {
+  for(int index=0; index<=5; index++) {
+    if (duration == (1 << index))
+      return index;
+  }
+  if (duration > 32) {
+    print_warning(location, "duration shortened to 32 in note", token);
+    return 5;
+  }
+  print_warning(location, "invalid duration replaced by 4 in note", token);
+  return 2;
+}
+
+int clamp_octave(int octave, const std::string & location, const std::string & token) {
+  if (octave < MIN_OCTAVE) {
+    print_warning(location, "octave raised to 4 in note", token);
+    return MIN_OCTAVE;
+  }
+  if (octave > MAX_OCTAVE) {
+    print_warning(location, "octave lowered to 7 in note", token);
+    return MAX_OCTAVE;
+  }
+  return octave;
+}
+
+// Returns the pitch index of a note: 0 for a pause, 1 to 12 for C to B. Returns -1 if invalid.
+int get_pitch_index(char letter) {
+  switch(tolower(letter)) {
+    case 'p': return 0;
+    case 'c': return 1;
+    case 'd': return 3;
+    case 'e': return 5;
+    case 'f': return 6;
+    case 'g': return 8;
+    case 'a': return 10;
+    case 'b':
+    case 'h': return 12;
+  };
+  return -1;
+}
+
+uint16_t encode_note(int duration_index, int pitch_index, bool dotted, int octave) {
+  return (uint16_t)(duration_index | (pitch_index << 3) | ((dotted ? 1 : 0) << 7) | ((octave - MIN_OCTAVE) << 8));
+}
+
+// Notes are compiled the way a lenient RTTTL player reads them: spaces are ignored and
+// characters that follow a valid note are dropped with a warning.
+bool compile_note(const std::string & token, int default_duration_index, int default_octave, const std::string & location, uint16_t & note) {
+  std::string compact;
+  for(size_t i=0; i<token.size(); i++) {
+    if (!isspace((unsigned char)token[i]))
+      compact += token[i];
+  }
+  const char * c = compact.c_str();
+
+  // duration
+  int duration_index = default_duration_index;
+  if (isdigit((unsigned char)*c))
+    duration_index = get_duration_index((int)strtol(c, (char**)&c, 10), location, token);
+
+  // pitch
+  int pitch_index = get_pitch_index(*c);
+  if (pitch_index < 0)
+    return false;
+  c++;
+  if (*c == '#' || *c == '_') {
+    pitch_index++;
+    c++;
+  }
+
+  // RTTTL allows the dot before or after the octave
+  bool dotted = false;
+  while(*c == '.') {
+    dotted = true;
+    c++;
+  }
+  int octave = default_octave;
+  if (isdigit((unsigned char)*c)) {
+    octave = clamp_octave(*c - '0', location, token);
+    c++;
+  }
+  while(*c == '.') {
+    dotted = true;
+    c++;
+  }
+  if (*c != '\0')
+    print_warning(location, "ignored trailing characters in note", token);
+
+  // e# and b# are f and c of the next octave
+  if (pitch_index == 13) {
+    pitch_index = 1;
+    if (octave < MAX_OCTAVE)
+      octave++;
+  }
+  if (pitch_index == 0)
+    octave = MIN_OCTAVE;
+
+  note = encode_note(duration_index, pitch_index, dotted, octave);
+  return true;
+}
+
+bool compile_melody(const std::string & text, const std::string & location, COMPILED_MELODY & melody) {
+  size_t name_end = text.find(':');
+  size_t defaults_end = (name_end == std::string::npos ? std::string::npos : text.find(':', name_end + 1));
+  if (name_end == std::string::npos || defaults_end == std::string::npos || name_end == 0) {
+    fprintf(stderr, "%s: error: not a RTTTL melody.\n", location.c_str());
+    return false;
+  }
+  melody.name = trim(text.substr(0, name_end));
+  melody.notes.clear();
+
+  // RTTTL default values
+  int default_duration_index = 2;
+  int default_octave = 6;
+  int bpm = 63;
+  std::vector<std::string> defaults = split(text.substr(name_end + 1, defaults_end - name_end - 1), ',');
+  for(size_t i=0; i<defaults.size(); i++) {
+    const std::string & value = defaults[i];
+    if (value.size() < 3 || value[1] != '=')
+      continue;
+    int number = atoi(value.c_str() + 2);
+    switch(tolower(value[0])) {
+      case 'd': default_duration_index = get_duration_index(number, location, value); break;
+      case 'o': default_octave = clamp_octave(number, location, value); break;
+      case 'b': bpm = number; break;
+    };
+  }
+  if (bpm <= 0 || bpm > 0xFFFF) {
+    fprintf(stderr, "%s: error: invalid bpm %d.\n", location.c_str(), bpm);
+    return false;
+  }
+  melody.bpm = (uint16_t)bpm;
+
+  std::vector<std::string> tokens = split(text.substr(defaults_end + 1), ',');
+  for(size_t i=0; i<tokens.size(); i++) {
+    if (tokens[i].empty())
+      continue;
+    uint16_t note = 0;
+    if (!compile_note(tokens[i], default_duration_index, default_octave, location, note)) {
+      print_warning(location, "skipped invalid note", tokens[i]);
+      continue;
+    }
+    melody.notes.push_back(note);
+  }
+  if (melody.notes.empty() || melody.notes.size() > 0xFFFF) {
+    fprintf(stderr, "%s: error: invalid number of notes.\n", location.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool read_melodies(const char * path, CompiledMelodyVector & melodies, std::set<std::string> & names, size_t & text_size) {
+  FILE * f = fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "%s: error: unable to open file.\n", path);
+    return false;
+  }
+
+  bool success = true;
+  char line[4096];
+  size_t line_number = 0;
+  while(fgets(line, sizeof(line), f)) {
+    line_number++;
+    std::string text = trim(line);
+    if (text.empty() || text[0] == '#')
+      continue;
+
+    std::string location = std::string(path) + ":" + std::to_string(line_number);
+    COMPILED_MELODY melody;
+    if (!compile_melody(text, location, melody)) {
+      success = false;
+      continue;
+    }
+    if (names.count(melody.name)) {
+      print_warning(location, "skipped duplicated melody", melody.name);
+      continue;
+    }
+    names.insert(melody.name);
+    melodies.push_back(melody);
+    text_size += text.size() + 1;
+  }
+  fclose(f);
+  return success;
+}
+
+// Appends a melody to the library data. 10 bit notes are packed as a LSB first bit stream.
+void append_melody(const COMPILED_MELODY & melody, int note_bits, std::vector<uint8_t> & data) {
+  data.push_back((uint8_t)(melody.bpm & 0xFF));
+  data.push_back((uint8_t)(melody.bpm >> 8));
+  data.push_back((uint8_t)(melody.notes.size() & 0xFF));
+  data.push_back((uint8_t)(melody.notes.size() >> 8));
+
+  if (note_bits == 16) {
+    for(size_t i=0; i<melody.notes.size(); i++) {
+      data.push_back((uint8_t)(melody.notes[i] & 0xFF));
+      data.push_back((uint8_t)(melody.notes[i] >> 8));
+    }
+    return;
+  }
+
+  uint32_t bits = 0;
+  int bit_count = 0;
+  for(size_t i=0; i<melody.notes.size(); i++) {
+    bits |= (uint32_t)melody.notes[i] << bit_count;
+    bit_count += note_bits;
+    while(bit_count >= 8) {
+      data.push_back((uint8_t)(bits & 0xFF));
+      bits >>= 8;
+      bit_count -= 8;
+    }
+  }
+  if (bit_count > 0)
+    data.push_back((uint8_t)(bits & 0xFF));
+}
+
+std::string escape_cstr(const std::string & value) {
+  std::string escaped;
+  for(size_t i=0; i<value.size(); i++) {
+    if (value[i] == '"' || value[i] == '\\')
+      escaped += '\\';
+    escaped += value[i];
+  }
+  return escaped;
+}
+
+void write_header(FILE * f, const CompiledMelodyVector & melodies, int note_bits, const std::vector<uint16_t> & offsets, const std::vector<uint8_t> & data, const std::string & command_line, size_t text_size) {
+  size_t note_count = 0;
+  for(size_t i=0; i<melodies.size(); i++)
+    note_count += melodies[i].notes.size();
+
+  fprintf(f, "// Generated by rtttl2bin. Do not edit.\n");
+  fprintf(f, "// Command: %s\n", command_line.c_str());
+  fprintf(f, "// %zu melodies, %zu notes, %zu bytes of binary melodies (%zu bytes as RTTTL text).\n", melodies.size(), note_count, data.size(), text_size);
+  fprintf(f, "\n");
+  fprintf(f, "#ifndef RTTTL_LIBRARY_H\n");
+  fprintf(f, "#define RTTTL_LIBRARY_H\n");
+  fprintf(f, "\n");
+  fprintf(f, "#include \"MelodyCatalog.hpp\"\n");
+  fprintf(f, "\n");
+  fprintf(f, "#define RTTTL_LIBRARY_NOTE_BITS %d\n", note_bits);
+  fprintf(f, "\n");
+
+  fprintf(f, "static constexpr char rtttl_library_names[] PROGMEM =\n");
+  for(size_t i=0; i<melodies.size(); i++)
+    fprintf(f, "  MELODY(\"%s\")%s\n", escape_cstr(melodies[i].name).c_str(), (i + 1 == melodies.size() ? ";" : ""));
+  fprintf(f, "\n");
+
+  fprintf(f, "static const uint16_t rtttl_library_offsets[] PROGMEM = {");
+  for(size_t i=0; i<offsets.size(); i++)
+    fprintf(f, "%s%u,", (i % 16 == 0 ? "\n  " : " "), offsets[i]);
+  fprintf(f, "\n};\n");
+  fprintf(f, "\n");
+
+  fprintf(f, "static const uint8_t rtttl_library_data[] PROGMEM = {");
+  for(size_t i=0; i<data.size(); i++)
+    fprintf(f, "%s0x%02x,", (i % 16 == 0 ? "\n  " : " "), data[i]);
+  fprintf(f, "\n};\n");
+  fprintf(f, "\n");
+  fprintf(f, "#endif // RTTTL_LIBRARY_H\n");
+}
+
+void print_usage() {
+  fprintf(stderr, "Usage: rtttl2bin [-b 10|16] [-o output.h] input.txt [input.txt ...]\n");
+}
+
+int main(int argc, char * argv[]) {
+  int note_bits = 10;
+  const char * output_path = NULL;
+  std::vector<const char *> input_paths;
+  std::string command_line = "rtttl2bin";
+
+  for(int i=1; i<argc; i++) {
+    std::string arg = argv[i];
+    if ((arg == "-b" || arg == "-o") && i + 1 < argc) {
+      if (arg == "-b")
+        note_bits = atoi(argv[i+1]);
+      else
+        output_path = argv[i+1];
+      command_line += " " + arg + " " + argv[i+1];
+      i++;
+    } else if (!arg.empty() && arg[0] != '-') {
+      input_paths.push_back(argv[i]);
+      command_line += " " + arg;
+    } else {
+      print_usage();
+      return 1;
+    }
+  }
+  if (input_paths.empty() || (note_bits != 10 && note_bits != 16)) {
+    print_usage();
+    return 1;
+  }
+
+  CompiledMelodyVector melodies;
+  std::set<std::string> names;
+  size_t text_size = 0;
+  bool success = true;
+  for(size_t i=0; i<input_paths.size(); i++)
+    success &= read_melodies(input_paths[i], melodies, names, text_size);
+  if (!success)
+    return 1;
+
+  std::vector<uint16_t> offsets;
+  std::vector<uint8_t> data;
+  for(size_t i=0; i<melodies.size(); i++) {
+    offsets.push_back((uint16_t)data.size());
+    append_melody(melodies[i], note_bits, data);
+    if (data.size() > MAX_DATA_SIZE) {
+      fprintf(stderr, "error: the library is larger than %zu bytes.\n", MAX_DATA_SIZE);
+      return 1;
+    }
+  }
+
+  FILE * f = stdout;
+  if (output_path) {
+    f = fopen(output_path, "wb");
+    if (!f) {
+      fprintf(stderr, "%s: error: unable to create file.\n", output_path);
+      return 1;
+    }
+  }
+  write_header(f, melodies, note_bits, offsets, data, command_line, text_size);
+  if (output_path)
+    fclose(f);
+
+  fprintf(stderr, "%zu melodies compiled to %zu bytes (%zu bytes as RTTTL text), %zu warnings.\n", melodies.size(), data.size(), text_size, warning_count);
+  return 0;
+}